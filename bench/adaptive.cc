@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <cstdint>
+#include <vector>
+
+
+/*
+ * Sweeps the cost of an item against the number of items, and compares plans which always use the whole thread pool
+ * with plans which choose the number of threads from the learned item cost (PTHREADPOOL_FLAG_ADAPTIVE_THREADS). Items
+ * cost roughly one nanosecond per unit of work. Small and cheap computations are faster on the calling thread alone,
+ * so the serial loop is the baseline for them.
+ */
+
+static void SetWorkAndRange(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgNames({"work", "range"});
+	for (int64_t work = 1; work <= 10000; work *= 10) {
+		for (int64_t range = 16; range <= 65536; range *= 16) {
+			benchmark->Args({work, range});
+		}
+	}
+}
+
+struct ItemContext {
+	size_t work;
+	std::vector<uint32_t> items;
+};
+
+static void compute_item(void* arg, size_t i) {
+	ItemContext* context = static_cast<ItemContext*>(arg);
+	uint32_t value = context->items[i];
+	for (size_t k = 0; k < context->work; k++) {
+		value = value * UINT32_C(1664525) + UINT32_C(1013904223);
+		benchmark::DoNotOptimize(value);
+	}
+	context->items[i] = value;
+}
+
+static void serial(benchmark::State& state) {
+	const size_t range = static_cast<size_t>(state.range(1));
+	ItemContext context = { static_cast<size_t>(state.range(0)), std::vector<uint32_t>(range) };
+	while (state.KeepRunning()) {
+		for (size_t i = 0; i < range; i++) {
+			compute_item(&context, i);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * range);
+}
+BENCHMARK(serial)->UseRealTime()->Apply(SetWorkAndRange);
+
+static void run_plan(benchmark::State& state, uint32_t flags) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	const size_t range = static_cast<size_t>(state.range(1));
+	ItemContext context = { static_cast<size_t>(state.range(0)), std::vector<uint32_t>(range) };
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(threadpool, compute_item, &context, range, flags);
+	while (state.KeepRunning()) {
+		pthreadpool_run_plan(plan);
+	}
+	pthreadpool_destroy_plan(plan);
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * range);
+}
+
+static void pthreadpool_run_plan_all_threads(benchmark::State& state) {
+	run_plan(state, 0 /* flags */);
+}
+BENCHMARK(pthreadpool_run_plan_all_threads)->UseRealTime()->Apply(SetWorkAndRange);
+
+static void pthreadpool_run_plan_adaptive(benchmark::State& state) {
+	run_plan(state, PTHREADPOOL_FLAG_ADAPTIVE_THREADS);
+}
+BENCHMARK(pthreadpool_run_plan_adaptive)->UseRealTime()->Apply(SetWorkAndRange);
+
+
+BENCHMARK_MAIN();
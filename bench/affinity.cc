@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Reruns the same kernel over a working set which fits into the combined L2 caches of the threads, first with the
+ * default dynamic schedule, then with PTHREADPOOL_FLAG_STATIC_SCHEDULE, and reports the speedup of the latter. With the
+ * static schedule every tile is processed by the same thread on every call, so its data stays in that thread's L2.
+ */
+
+static void SetNumberOfThreads(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("threads");
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 2);
+	for (int t = 2; t <= max_threads; t *= 2) {
+		benchmark->Arg(t);
+	}
+}
+
+/* Per-thread share of the working set, sized to fit into a typical L2 cache together with other data */
+static const size_t kL2WorkingSetSize = 192 * 1024;
+static const size_t kRowSize = 256;
+static const size_t kTileRows = 8;
+static const size_t kTileColumns = 64;
+static const size_t kCallsPerMeasurement = 64;
+
+struct scale_context {
+	float* data;
+	size_t row_size;
+};
+
+static void scale_tile_2d(const scale_context* context, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		float* row = context->data + i * context->row_size;
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			row[j] = row[j] * 0.999f + 0.001f;
+		}
+	}
+}
+
+static double MeasureCalls(pthreadpool_t threadpool, const scale_context* context, size_t rows, uint32_t flags) {
+	const auto start = std::chrono::steady_clock::now();
+	for (size_t call = 0; call < kCallsPerMeasurement; call++) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(scale_tile_2d),
+			const_cast<scale_context*>(context),
+			rows, kRowSize,
+			kTileRows, kTileColumns,
+			flags);
+	}
+	const auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+static void pthreadpool_parallelize_2d_tile_2d_l2_resident(benchmark::State& state) {
+	const size_t threads = static_cast<size_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+
+	const size_t rows = threads * kL2WorkingSetSize / (kRowSize * sizeof(float));
+	std::vector<float> data(rows * kRowSize, 1.0f);
+	const scale_context context = { data.data(), kRowSize };
+
+	double dynamic_us = 0.0;
+	double static_us = 0.0;
+	while (state.KeepRunning()) {
+		/* An unmeasured block of calls warms up the caches for the schedule under test */
+		MeasureCalls(threadpool, &context, rows, 0);
+		dynamic_us += MeasureCalls(threadpool, &context, rows, 0);
+		MeasureCalls(threadpool, &context, rows, PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+		static_us += MeasureCalls(threadpool, &context, rows, PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+	}
+	pthreadpool_destroy(threadpool);
+
+	const double calls = double(state.iterations()) * double(kCallsPerMeasurement);
+	state.counters["dynamic_us"] = dynamic_us / calls;
+	state.counters["static_us"] = static_us / calls;
+	state.counters["speedup"] = dynamic_us / static_us;
+}
+BENCHMARK(pthreadpool_parallelize_2d_tile_2d_l2_resident)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Runs a chain of small dependent kernels, as in inference workloads where every layer consumes the output of the
+ * previous one. Separate parallelization calls pay a wake-up and a check-in of all threads per kernel, and serialize on
+ * the calling thread between kernels. The task graph processes the whole chain in a single call, and threads start the
+ * next kernel as soon as the previous one completes.
+ */
+
+static void SetNumberOfThreads(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("threads");
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+	for (int t = 1; t <= max_threads; t *= 2) {
+		benchmark->Arg(t);
+	}
+}
+
+static const size_t kChainLength = 16;
+static const size_t kKernelRange = 1024;
+static const size_t kItemSize = 64;
+
+static void scale_item(void* arg, size_t i) {
+	float* item = static_cast<float*>(arg) + i * kItemSize;
+	for (size_t k = 0; k < kItemSize; k++) {
+		item[k] = item[k] * 0.999f + 0.001f;
+	}
+}
+
+static void chain_parallelize_1d(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	std::vector<float> data(kKernelRange * kItemSize, 1.0f);
+	while (state.KeepRunning()) {
+		for (size_t kernel = 0; kernel < kChainLength; kernel++) {
+			pthreadpool_parallelize_1d(threadpool, scale_item, data.data(), kKernelRange, 0 /* flags */);
+		}
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kChainLength * kKernelRange);
+}
+BENCHMARK(chain_parallelize_1d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void chain_graph(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	std::vector<float> data(kKernelRange * kItemSize, 1.0f);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(threadpool, scale_item, data.data(), kKernelRange, 0 /* flags */);
+	pthreadpool_graph_t graph = pthreadpool_create_graph(threadpool);
+	for (size_t kernel = 0; kernel < kChainLength; kernel++) {
+		pthreadpool_add_graph_node(graph, plan);
+		if (kernel != 0) {
+			pthreadpool_add_graph_edge(graph, kernel - 1, kernel);
+		}
+	}
+	while (state.KeepRunning()) {
+		pthreadpool_run_graph(graph);
+	}
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(plan);
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kChainLength * kKernelRange);
+}
+BENCHMARK(chain_graph)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+BENCHMARK_MAIN();
@@ -89,4 +89,74 @@ static void pthreadpool_parallelize_2d_tile_2d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_2d_tile_2d)->UseRealTime()->Apply(SetNumberOfThreads);
 
 
+static void pthreadpool_run_plan_2d_tile_2d(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_2d_tile_2d(
+		threadpool,
+		compute_2d_tile_2d,
+		nullptr /* context */,
+		1, threads,
+		1, 1,
+		0 /* flags */);
+	while (state.KeepRunning()) {
+		pthreadpool_run_plan(plan);
+	}
+	pthreadpool_destroy_plan(plan);
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_run_plan_2d_tile_2d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+/* Number of dependent kernels in a sequence, such as normalization, matrix multiplication, and activation */
+static const size_t kBatchPlans = 3;
+
+static void pthreadpool_run_plan_sequence_1d(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	pthreadpool_plan_t plans[kBatchPlans];
+	for (pthreadpool_plan_t& plan : plans) {
+		plan = pthreadpool_create_plan_1d(
+			threadpool,
+			compute_1d,
+			nullptr /* context */,
+			threads,
+			0 /* flags */);
+	}
+	while (state.KeepRunning()) {
+		for (pthreadpool_plan_t plan : plans) {
+			pthreadpool_run_plan(plan);
+		}
+	}
+	for (pthreadpool_plan_t plan : plans) {
+		pthreadpool_destroy_plan(plan);
+	}
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_run_plan_sequence_1d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+static void pthreadpool_run_batch_1d(benchmark::State& state) {
+	const uint32_t threads = static_cast<uint32_t>(state.range(0));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+	pthreadpool_plan_t plans[kBatchPlans];
+	for (pthreadpool_plan_t& plan : plans) {
+		plan = pthreadpool_create_plan_1d(
+			threadpool,
+			compute_1d,
+			nullptr /* context */,
+			threads,
+			0 /* flags */);
+	}
+	while (state.KeepRunning()) {
+		pthreadpool_run_batch(threadpool, plans, kBatchPlans);
+	}
+	for (pthreadpool_plan_t plan : plans) {
+		pthreadpool_destroy_plan(plan);
+	}
+	pthreadpool_destroy(threadpool);
+}
+BENCHMARK(pthreadpool_run_batch_1d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
 BENCHMARK_MAIN();
@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Runs a 2-level loop nest with few outer iterations, as layered libraries do when a parallel operator calls a parallel
+ * kernel. Without nested parallelism, only the outer loop is spread between threads, and scaling stops at the number
+ * of outer iterations. With nested calls on the same pool, threads out of outer work help with the inner loops. The
+ * flattened 2D loop is the upper bound.
+ */
+
+static void SetNumberOfThreads(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("threads");
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+	for (int t = 1; t <= max_threads; t *= 2) {
+		benchmark->Arg(t);
+	}
+}
+
+static const size_t kOuterRange = 2;
+static const size_t kInnerRange = 4096;
+static const size_t kItemSize = 256;
+
+struct nested_context {
+	pthreadpool_t threadpool;
+	float* data;
+};
+
+static void compute_item(float* data, size_t i, size_t j) {
+	float* item = data + (i * kInnerRange + j) * kItemSize;
+	for (size_t k = 0; k < kItemSize; k++) {
+		item[k] = item[k] * 0.999f + 0.001f;
+	}
+}
+
+static void compute_inner_item(void* arg, size_t j) {
+	const auto* context = static_cast<const std::pair<nested_context*, size_t>*>(arg);
+	compute_item(context->first->data, context->second, j);
+}
+
+static void compute_outer_item_serial(void* arg, size_t i) {
+	nested_context* context = static_cast<nested_context*>(arg);
+	for (size_t j = 0; j < kInnerRange; j++) {
+		compute_item(context->data, i, j);
+	}
+}
+
+static void compute_outer_item_nested(void* arg, size_t i) {
+	nested_context* context = static_cast<nested_context*>(arg);
+	std::pair<nested_context*, size_t> inner_context(context, i);
+	pthreadpool_parallelize_1d(context->threadpool, compute_inner_item, &inner_context, kInnerRange, 0 /* flags */);
+}
+
+static void compute_item_2d(void* arg, size_t i, size_t j) {
+	compute_item(static_cast<nested_context*>(arg)->data, i, j);
+}
+
+static void outer_parallel_inner_serial(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	std::vector<float> data(kOuterRange * kInnerRange * kItemSize, 1.0f);
+	nested_context context = { threadpool, data.data() };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d(threadpool, compute_outer_item_serial, &context, kOuterRange, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kOuterRange * kInnerRange);
+}
+BENCHMARK(outer_parallel_inner_serial)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void outer_parallel_inner_nested(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	std::vector<float> data(kOuterRange * kInnerRange * kItemSize, 1.0f);
+	nested_context context = { threadpool, data.data() };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d(threadpool, compute_outer_item_nested, &context, kOuterRange, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kOuterRange * kInnerRange);
+}
+BENCHMARK(outer_parallel_inner_nested)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void flattened_2d(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	std::vector<float> data(kOuterRange * kInnerRange * kItemSize, 1.0f);
+	nested_context context = { threadpool, data.data() };
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_2d(threadpool, compute_item_2d, &context, kOuterRange, kInnerRange, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kOuterRange * kInnerRange);
+}
+BENCHMARK(flattened_2d)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Measures the latency of a small latency-critical computation while another thread keeps the thread pool busy with a
+ * background batch computation, with and without PTHREADPOOL_FLAG_HIGH_PRIORITY. Items cost roughly one nanosecond per
+ * unit of work. Reports the median and the 99th percentile of the latency in microseconds; the idle benchmark is the
+ * baseline without background load. The thread pool leaves one processor to the thread which submits the
+ * latency-critical computation, so that the operating system scheduler doesn't add to its latency.
+ */
+
+static void SetWork(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("work");
+	for (int64_t work = 1000; work <= 100000; work *= 10) {
+		benchmark->Arg(work);
+	}
+}
+
+static const size_t kBackgroundWork = 10000;
+static const size_t kBackgroundRange = 100000;
+static const size_t kItemsPerThread = 4;
+
+static void compute_item(void* arg, size_t) {
+	const size_t work = *static_cast<const size_t*>(arg);
+	uint32_t value = 0;
+	for (size_t k = 0; k < work; k++) {
+		value = value * UINT32_C(1664525) + UINT32_C(1013904223);
+		benchmark::DoNotOptimize(value);
+	}
+}
+
+static void run_latency(benchmark::State& state, bool background, uint32_t flags) {
+	const size_t threads_count = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+	pthreadpool_t threadpool = pthreadpool_create(threads_count);
+	size_t work = static_cast<size_t>(state.range(0));
+	const size_t range = pthreadpool_get_threads_count(threadpool) * kItemsPerThread;
+
+	std::atomic_bool stop(false);
+	std::thread background_thread;
+	if (background) {
+		background_thread = std::thread([threadpool, &stop]() {
+			size_t background_work = kBackgroundWork;
+			while (!stop.load(std::memory_order_relaxed)) {
+				pthreadpool_parallelize_1d(threadpool, compute_item, &background_work, kBackgroundRange, 0 /* flags */);
+			}
+		});
+	}
+
+	std::vector<double> latencies;
+	while (state.KeepRunning()) {
+		const auto start = std::chrono::steady_clock::now();
+		pthreadpool_parallelize_1d(threadpool, compute_item, &work, range, flags);
+		const auto end = std::chrono::steady_clock::now();
+		latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+
+	stop.store(true, std::memory_order_relaxed);
+	if (background) {
+		background_thread.join();
+	}
+	pthreadpool_destroy(threadpool);
+
+	std::sort(latencies.begin(), latencies.end());
+	state.counters["p50_us"] = latencies[latencies.size() / 2];
+	state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+	state.SetItemsProcessed(int64_t(state.iterations()) * range);
+}
+
+static void latency_idle(benchmark::State& state) {
+	run_latency(state, false /* background */, 0 /* flags */);
+}
+BENCHMARK(latency_idle)->UseRealTime()->Apply(SetWork);
+
+static void latency_under_load(benchmark::State& state) {
+	run_latency(state, true /* background */, 0 /* flags */);
+}
+BENCHMARK(latency_under_load)->UseRealTime()->Apply(SetWork);
+
+static void latency_under_load_high_priority(benchmark::State& state) {
+	run_latency(state, true /* background */, PTHREADPOOL_FLAG_HIGH_PRIORITY);
+}
+BENCHMARK(latency_under_load_high_priority)->UseRealTime()->Apply(SetWork);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+
+/*
+ * Compares the parallel prefix sums against a serial scan on the calling thread. Scans are computed in place, so the
+ * largest arrays (1e9 elements) need 4 GB of memory for 32-bit elements, and 8 GB for 64-bit elements.
+ */
+
+static void SetNumberOfElements(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("elements");
+	for (int64_t elements = 1000000; elements <= 1000000000; elements *= 10) {
+		benchmark->Arg(elements);
+	}
+}
+
+static void serial_inclusive_scan_u32(benchmark::State& state) {
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<uint32_t> data(elements, 1);
+	while (state.KeepRunning()) {
+		std::partial_sum(data.begin(), data.end(), data.begin());
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(uint32_t));
+}
+BENCHMARK(serial_inclusive_scan_u32)->UseRealTime()->Apply(SetNumberOfElements);
+
+static void pthreadpool_inclusive_scan_u32(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<uint32_t> data(elements, 1);
+	while (state.KeepRunning()) {
+		pthreadpool_inclusive_scan_u32(threadpool, data.data(), data.data(), elements, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(uint32_t));
+}
+BENCHMARK(pthreadpool_inclusive_scan_u32)->UseRealTime()->Apply(SetNumberOfElements);
+
+
+static void serial_exclusive_scan_u64(benchmark::State& state) {
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<uint64_t> data(elements, 1);
+	while (state.KeepRunning()) {
+		uint64_t sum = 0;
+		for (uint64_t& element : data) {
+			const uint64_t value = element;
+			element = sum;
+			sum += value;
+		}
+		benchmark::DoNotOptimize(data.data());
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(uint64_t));
+}
+BENCHMARK(serial_exclusive_scan_u64)->UseRealTime()->Apply(SetNumberOfElements);
+
+static void pthreadpool_exclusive_scan_u64(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<uint64_t> data(elements, 1);
+	while (state.KeepRunning()) {
+		pthreadpool_exclusive_scan_u64(threadpool, data.data(), data.data(), elements, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(uint64_t));
+}
+BENCHMARK(pthreadpool_exclusive_scan_u64)->UseRealTime()->Apply(SetNumberOfElements);
+
+
+static void serial_inclusive_scan_f32(benchmark::State& state) {
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<float> data(elements, 1.0f);
+	while (state.KeepRunning()) {
+		std::partial_sum(data.begin(), data.end(), data.begin());
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(float));
+}
+BENCHMARK(serial_inclusive_scan_f32)->UseRealTime()->Apply(SetNumberOfElements);
+
+static void pthreadpool_inclusive_scan_f32(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	const size_t elements = static_cast<size_t>(state.range(0));
+	std::vector<float> data(elements, 1.0f);
+	while (state.KeepRunning()) {
+		pthreadpool_inclusive_scan_f32(threadpool, data.data(), data.data(), elements, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * elements * sizeof(float));
+}
+BENCHMARK(pthreadpool_inclusive_scan_f32)->UseRealTime()->Apply(SetNumberOfElements);
+
+
+BENCHMARK_MAIN();
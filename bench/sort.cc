@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Compares the parallel sorts against std::sort on the calling thread. The threads argument of the std::sort benchmarks
+ * is ignored, and is only there to line up the results with the pthreadpool benchmarks.
+ */
+
+static void SetNumberOfThreads(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("threads");
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+	for (int t = 1; t <= max_threads; t *= 2) {
+		benchmark->Arg(t);
+	}
+}
+
+static const size_t kSortCount = 1 << 24;
+
+template<class T>
+static std::vector<T> RandomKeys() {
+	std::mt19937_64 rng(kSortCount);
+	std::vector<T> keys(kSortCount);
+	std::generate(keys.begin(), keys.end(), [&rng]() { return static_cast<T>(rng()); });
+	return keys;
+}
+
+static int compare_u32(void*, const void* a, const void* b) {
+	const uint32_t key_a = *static_cast<const uint32_t*>(a);
+	const uint32_t key_b = *static_cast<const uint32_t*>(b);
+	return (key_a > key_b) - (key_a < key_b);
+}
+
+static void std_sort_u32(benchmark::State& state) {
+	const std::vector<uint32_t> input = RandomKeys<uint32_t>();
+	std::vector<uint32_t> keys(kSortCount);
+	while (state.KeepRunning()) {
+		state.PauseTiming();
+		keys = input;
+		state.ResumeTiming();
+
+		std::sort(keys.begin(), keys.end());
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kSortCount);
+}
+BENCHMARK(std_sort_u32)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void pthreadpool_sort_u32(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	const std::vector<uint32_t> input = RandomKeys<uint32_t>();
+	std::vector<uint32_t> keys(kSortCount);
+	while (state.KeepRunning()) {
+		state.PauseTiming();
+		keys = input;
+		state.ResumeTiming();
+
+		pthreadpool_sort_u32(threadpool, keys.data(), kSortCount, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kSortCount);
+}
+BENCHMARK(pthreadpool_sort_u32)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void pthreadpool_sort_u32_compare(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	const std::vector<uint32_t> input = RandomKeys<uint32_t>();
+	std::vector<uint32_t> keys(kSortCount);
+	while (state.KeepRunning()) {
+		state.PauseTiming();
+		keys = input;
+		state.ResumeTiming();
+
+		pthreadpool_sort(threadpool, compare_u32, nullptr, keys.data(), sizeof(uint32_t), kSortCount, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kSortCount);
+}
+BENCHMARK(pthreadpool_sort_u32_compare)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+static void std_sort_u64(benchmark::State& state) {
+	const std::vector<uint64_t> input = RandomKeys<uint64_t>();
+	std::vector<uint64_t> keys(kSortCount);
+	while (state.KeepRunning()) {
+		state.PauseTiming();
+		keys = input;
+		state.ResumeTiming();
+
+		std::sort(keys.begin(), keys.end());
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kSortCount);
+}
+BENCHMARK(std_sort_u64)->UseRealTime()->Apply(SetNumberOfThreads);
+
+static void pthreadpool_sort_u64(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(static_cast<size_t>(state.range(0)));
+	const std::vector<uint64_t> input = RandomKeys<uint64_t>();
+	std::vector<uint64_t> keys(kSortCount);
+	while (state.KeepRunning()) {
+		state.PauseTiming();
+		keys = input;
+		state.ResumeTiming();
+
+		pthreadpool_sort_u64(threadpool, keys.data(), kSortCount, 0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kSortCount);
+}
+BENCHMARK(pthreadpool_sort_u64)->UseRealTime()->Apply(SetNumberOfThreads);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Submits tiny commands with a pause between them, as bursty request handlers do, and compares spin-wait policies.
+ * The latency_us and p99_us counters are the mean and the 99th percentile of the latency of a command, which includes
+ * waking up the workers if they went to sleep during the pause. The cpu_us counter is the processor time the whole
+ * process used per command, including the time workers burned spinning during the pause.
+ */
+
+static void SetGap(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("gap_us");
+	for (int64_t gap = 10; gap <= 100000; gap *= 10) {
+		benchmark->Arg(gap);
+	}
+}
+
+static void compute_nothing(void*, size_t) {
+}
+
+static void run_commands(benchmark::State& state, uint32_t policy, uint64_t max_spin_ns) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	pthreadpool_set_spin_policy(threadpool, policy, max_spin_ns);
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool);
+	const std::chrono::microseconds gap(state.range(0));
+
+	std::vector<double> latencies;
+	const std::clock_t cpu_start = std::clock();
+	while (state.KeepRunning()) {
+		std::this_thread::sleep_for(gap);
+
+		const auto start = std::chrono::steady_clock::now();
+		pthreadpool_parallelize_1d(threadpool, compute_nothing, nullptr, threads_count, 0 /* flags */);
+		const auto end = std::chrono::steady_clock::now();
+
+		latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+	const std::clock_t cpu_end = std::clock();
+	pthreadpool_destroy(threadpool);
+
+	std::sort(latencies.begin(), latencies.end());
+	double total_latency = 0.0;
+	for (double latency : latencies) {
+		total_latency += latency;
+	}
+	state.counters["latency_us"] = total_latency / double(latencies.size());
+	state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+	state.counters["cpu_us"] = double(cpu_end - cpu_start) * 1.0e6 / CLOCKS_PER_SEC / double(state.iterations());
+}
+
+static void no_spin(benchmark::State& state) {
+	run_commands(state, PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+}
+BENCHMARK(no_spin)->UseRealTime()->Apply(SetGap);
+
+static void fixed_spin(benchmark::State& state) {
+	run_commands(state, PTHREADPOOL_SPIN_POLICY_FIXED, 5000000);
+}
+BENCHMARK(fixed_spin)->UseRealTime()->Apply(SetGap);
+
+static void adaptive_spin(benchmark::State& state) {
+	run_commands(state, PTHREADPOOL_SPIN_POLICY_ADAPTIVE, 5000000);
+}
+BENCHMARK(adaptive_spin)->UseRealTime()->Apply(SetGap);
+
+
+BENCHMARK_MAIN();
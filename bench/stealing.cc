@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+static void SetNumberOfThreadsAndStealingMode(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgNames({"threads", "mode"});
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 2);
+	for (int t = 2; t <= max_threads; t *= 2) {
+		for (int mode = 0; mode <= 2; mode++) {
+			benchmark->Args({t, mode});
+		}
+	}
+}
+
+static uint32_t StealingFlags(int64_t mode) {
+	switch (mode) {
+		case 1:
+			return PTHREADPOOL_FLAG_STEAL_RANDOM;
+		case 2:
+			return PTHREADPOOL_FLAG_STEAL_TWO_CHOICES;
+		default:
+			return 0;
+	}
+}
+
+struct skewed_context {
+	/* Items below this index are 64x more expensive than the rest */
+	size_t heavy_items;
+};
+
+static void compute_skewed_1d(skewed_context* context, size_t i) {
+	const uint32_t iterations = i < context->heavy_items ? 64 * 64 : 64;
+	uint32_t x = static_cast<uint32_t>(i);
+	for (uint32_t n = 0; n < iterations; n++) {
+		x = x * UINT32_C(1664525) + UINT32_C(1013904223);
+	}
+	benchmark::DoNotOptimize(x);
+}
+
+static void ReportLatencyPercentiles(benchmark::State& state, std::vector<double>& latencies) {
+	if (latencies.empty()) {
+		return;
+	}
+	std::sort(latencies.begin(), latencies.end());
+	state.counters["p50_us"] = latencies[latencies.size() / 2];
+	state.counters["p99_us"] = latencies[latencies.size() * 99 / 100];
+	state.counters["max_us"] = latencies.back();
+}
+
+static void pthreadpool_parallelize_1d_skewed(benchmark::State& state) {
+	const size_t threads = static_cast<size_t>(state.range(0));
+	const uint32_t flags = StealingFlags(state.range(1));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+
+	/* All expensive items land in the initial range of the first thread, the others have to steal them */
+	const size_t items = 1024 * threads;
+	skewed_context context = { items / threads };
+
+	std::vector<double> latencies;
+	while (state.KeepRunning()) {
+		const auto start = std::chrono::steady_clock::now();
+		pthreadpool_parallelize_1d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_t>(compute_skewed_1d),
+			&context,
+			items,
+			flags);
+		const auto end = std::chrono::steady_clock::now();
+		latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+	pthreadpool_destroy(threadpool);
+
+	ReportLatencyPercentiles(state, latencies);
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_1d_skewed)->UseRealTime()->Apply(SetNumberOfThreadsAndStealingMode);
+
+
+static void compute_skewed_2d_tile_1d(skewed_context* context, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		compute_skewed_1d(context, i);
+	}
+}
+
+static void pthreadpool_parallelize_2d_tile_1d_skewed(benchmark::State& state) {
+	const size_t threads = static_cast<size_t>(state.range(0));
+	const uint32_t flags = StealingFlags(state.range(1));
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+
+	/* Rows in the first half of the grid are expensive */
+	const size_t rows = 16 * threads;
+	skewed_context context = { rows / 2 };
+
+	std::vector<double> latencies;
+	while (state.KeepRunning()) {
+		const auto start = std::chrono::steady_clock::now();
+		pthreadpool_parallelize_2d_tile_1d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(compute_skewed_2d_tile_1d),
+			&context,
+			rows, 64, 4,
+			flags);
+		const auto end = std::chrono::steady_clock::now();
+		latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+	}
+	pthreadpool_destroy(threadpool);
+
+	ReportLatencyPercentiles(state, latencies);
+	state.SetItemsProcessed(int64_t(state.iterations()) * rows * 64);
+}
+BENCHMARK(pthreadpool_parallelize_2d_tile_1d_skewed)->UseRealTime()->Apply(SetNumberOfThreadsAndStealingMode);
+
+
+BENCHMARK_MAIN();
@@ -2,6 +2,9 @@
 
 #include <pthreadpool.h>
 
+#include <cstdint>
+#include <vector>
+
 
 static void compute_1d(void*, size_t) {
 }
@@ -49,6 +52,37 @@ static void pthreadpool_parallelize_1d_tile_1d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_1d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
 
+static void SetItemsAndGrain(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgNames({"items", "grain"});
+	for (int items = 10; items <= 1000000; items *= 10) {
+		for (int grain : {0, 1, 16, 256}) {
+			benchmark->Args({items, grain});
+		}
+	}
+}
+
+static void pthreadpool_parallelize_1d_with_grain(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(2);
+	const size_t threads = pthreadpool_get_threads_count(threadpool);
+	const size_t items = static_cast<size_t>(state.range(0));
+	const size_t grain = static_cast<size_t>(state.range(1));
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_1d_with_grain(
+			threadpool,
+			compute_1d,
+			nullptr /* context */,
+			items * threads,
+			grain,
+			0 /* flags */);
+	}
+	pthreadpool_destroy(threadpool);
+
+	/* Do not normalize by thread */
+	state.SetItemsProcessed(int64_t(state.iterations()) * items);
+}
+BENCHMARK(pthreadpool_parallelize_1d_with_grain)->UseRealTime()->Apply(SetItemsAndGrain);
+
+
 static void compute_2d(void*, size_t, size_t) {
 }
 
@@ -120,6 +154,29 @@ static void pthreadpool_parallelize_2d_tile_2d(benchmark::State& state) {
 BENCHMARK(pthreadpool_parallelize_2d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
 
 
+static void SetItemsAndStealing(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgNames({"items", "stolen"});
+	for (int items = 10; items <= 1000000; items *= 10) {
+		for (int stolen = 0; stolen <= 1; stolen++) {
+			benchmark->Args({items, stolen});
+		}
+	}
+}
+
+/*
+ * In the stolen mode the first thread initially owns all items, and the other threads process their share only in
+ * ranges stolen from it. This measures the per-item cost of processing stolen items, which is dominated by index
+ * decoding if every stolen item is decoded from its linear index separately.
+ */
+static void SetStealingMode(pthreadpool_t threadpool, int64_t stolen) {
+	if (stolen != 0) {
+		std::vector<uint32_t> weights(pthreadpool_get_threads_count(threadpool), 0);
+		weights[0] = 1;
+		pthreadpool_set_thread_weights(threadpool, weights.data());
+	}
+}
+
+
 static void compute_3d(void*, size_t, size_t, size_t) {
 }
 
@@ -127,6 +184,7 @@ static void pthreadpool_parallelize_3d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_3d(
 			threadpool,
@@ -140,7 +198,7 @@ static void pthreadpool_parallelize_3d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_3d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_3d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_3d_tile_1d(void*, size_t, size_t, size_t, size_t) {
@@ -150,6 +208,7 @@ static void pthreadpool_parallelize_3d_tile_1d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_3d_tile_1d(
 			threadpool,
@@ -164,7 +223,7 @@ static void pthreadpool_parallelize_3d_tile_1d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_3d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_3d_tile_1d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_3d_tile_2d(void*, size_t, size_t, size_t, size_t, size_t) {
@@ -174,6 +233,7 @@ static void pthreadpool_parallelize_3d_tile_2d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_3d_tile_2d(
 			threadpool,
@@ -188,7 +248,7 @@ static void pthreadpool_parallelize_3d_tile_2d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_3d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_3d_tile_2d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_4d(void*, size_t, size_t, size_t, size_t) {
@@ -198,6 +258,7 @@ static void pthreadpool_parallelize_4d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_4d(
 			threadpool,
@@ -211,7 +272,7 @@ static void pthreadpool_parallelize_4d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_4d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_4d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_4d_tile_1d(void*, size_t, size_t, size_t, size_t, size_t) {
@@ -221,6 +282,7 @@ static void pthreadpool_parallelize_4d_tile_1d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_4d_tile_1d(
 			threadpool,
@@ -235,7 +297,7 @@ static void pthreadpool_parallelize_4d_tile_1d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_4d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_4d_tile_1d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_4d_tile_2d(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -245,6 +307,7 @@ static void pthreadpool_parallelize_4d_tile_2d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_4d_tile_2d(
 			threadpool,
@@ -259,7 +322,7 @@ static void pthreadpool_parallelize_4d_tile_2d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_4d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_4d_tile_2d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_5d(void*, size_t, size_t, size_t, size_t, size_t) {
@@ -269,6 +332,7 @@ static void pthreadpool_parallelize_5d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_5d(
 			threadpool,
@@ -282,7 +346,7 @@ static void pthreadpool_parallelize_5d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_5d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_5d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_5d_tile_1d(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -292,6 +356,7 @@ static void pthreadpool_parallelize_5d_tile_1d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_5d_tile_1d(
 			threadpool,
@@ -306,7 +371,7 @@ static void pthreadpool_parallelize_5d_tile_1d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_5d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_5d_tile_1d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_5d_tile_2d(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -316,6 +381,7 @@ static void pthreadpool_parallelize_5d_tile_2d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_5d_tile_2d(
 			threadpool,
@@ -330,7 +396,7 @@ static void pthreadpool_parallelize_5d_tile_2d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_5d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_5d_tile_2d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_6d(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -340,6 +406,7 @@ static void pthreadpool_parallelize_6d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_6d(
 			threadpool,
@@ -353,7 +420,7 @@ static void pthreadpool_parallelize_6d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_6d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_6d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_6d_tile_1d(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -363,6 +430,7 @@ static void pthreadpool_parallelize_6d_tile_1d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_6d_tile_1d(
 			threadpool,
@@ -377,7 +445,7 @@ static void pthreadpool_parallelize_6d_tile_1d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_6d_tile_1d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_6d_tile_1d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 static void compute_6d_tile_2d(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
@@ -387,6 +455,7 @@ static void pthreadpool_parallelize_6d_tile_2d(benchmark::State& state) {
 	pthreadpool_t threadpool = pthreadpool_create(2);
 	const size_t threads = pthreadpool_get_threads_count(threadpool);
 	const size_t items = static_cast<size_t>(state.range(0));
+	SetStealingMode(threadpool, state.range(1));
 	while (state.KeepRunning()) {
 		pthreadpool_parallelize_6d_tile_2d(
 			threadpool,
@@ -401,7 +470,7 @@ static void pthreadpool_parallelize_6d_tile_2d(benchmark::State& state) {
 	/* Do not normalize by thread */
 	state.SetItemsProcessed(int64_t(state.iterations()) * items);
 }
-BENCHMARK(pthreadpool_parallelize_6d_tile_2d)->UseRealTime()->RangeMultiplier(10)->Range(10, 1000000);
+BENCHMARK(pthreadpool_parallelize_6d_tile_2d)->UseRealTime()->Apply(SetItemsAndStealing);
 
 
 BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Compares row-major and Z-order (PTHREADPOOL_FLAG_TILE_ORDER_MORTON) assignment of 2D tiles to threads on a GEMM-like
+ * kernel, where a tile of C reads a row panel of A and a column panel of B. Time per iteration reflects the cache reuse
+ * of the panels between consecutive tiles of a thread. When Google Benchmark is built with libpfm, cache misses can be
+ * reported directly with --benchmark_perf_counters=CACHE-MISSES,CYCLES.
+ */
+
+static void SetNumberOfThreadsAndTileOrder(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgNames({"threads", "morton"});
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 1);
+	for (int t = 1; t <= max_threads; t *= 2) {
+		for (int morton = 0; morton <= 1; morton++) {
+			benchmark->Args({t, morton});
+		}
+	}
+}
+
+struct gemm_context {
+	size_t m;
+	size_t n;
+	size_t k;
+	const float* a;
+	const float* b;
+	float* c;
+};
+
+static void compute_gemm_tile(const gemm_context* context, size_t batch, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	const size_t n = context->n;
+	const size_t k = context->k;
+	const float* a = context->a + batch * context->m * k;
+	const float* b = context->b;
+	float* c = context->c + batch * context->m * n;
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		std::fill(c + i * n + start_j, c + i * n + start_j + tile_j, 0.0f);
+		for (size_t kk = 0; kk < k; kk++) {
+			const float a_ik = a[i * k + kk];
+			for (size_t j = start_j; j < start_j + tile_j; j++) {
+				c[i * n + j] += a_ik * b[kk * n + j];
+			}
+		}
+	}
+}
+
+static void compute_gemm_tile_2d(const gemm_context* context, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	compute_gemm_tile(context, 0, start_i, start_j, tile_i, tile_j);
+}
+
+static const size_t kMatrixSize = 512;
+static const size_t kTileSize = 32;
+static const size_t kBatchSize = 2;
+
+static void pthreadpool_parallelize_2d_tile_2d_gemm(benchmark::State& state) {
+	const size_t threads = static_cast<size_t>(state.range(0));
+	const uint32_t flags = state.range(1) != 0 ? PTHREADPOOL_FLAG_TILE_ORDER_MORTON : 0;
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+
+	std::vector<float> a(kMatrixSize * kMatrixSize, 1.0f);
+	std::vector<float> b(kMatrixSize * kMatrixSize, 1.0f);
+	std::vector<float> c(kMatrixSize * kMatrixSize);
+	const gemm_context context = { kMatrixSize, kMatrixSize, kMatrixSize, a.data(), b.data(), c.data() };
+
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(compute_gemm_tile_2d),
+			const_cast<gemm_context*>(&context),
+			kMatrixSize, kMatrixSize,
+			kTileSize, kTileSize,
+			flags);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kMatrixSize * kMatrixSize * kMatrixSize);
+}
+BENCHMARK(pthreadpool_parallelize_2d_tile_2d_gemm)->UseRealTime()->Apply(SetNumberOfThreadsAndTileOrder);
+
+
+static void pthreadpool_parallelize_3d_tile_2d_gemm(benchmark::State& state) {
+	const size_t threads = static_cast<size_t>(state.range(0));
+	const uint32_t flags = state.range(1) != 0 ? PTHREADPOOL_FLAG_TILE_ORDER_MORTON : 0;
+	pthreadpool_t threadpool = pthreadpool_create(threads);
+
+	/* Batch of products with different A and C, but a shared B */
+	std::vector<float> a(kBatchSize * kMatrixSize * kMatrixSize, 1.0f);
+	std::vector<float> b(kMatrixSize * kMatrixSize, 1.0f);
+	std::vector<float> c(kBatchSize * kMatrixSize * kMatrixSize);
+	const gemm_context context = { kMatrixSize, kMatrixSize, kMatrixSize, a.data(), b.data(), c.data() };
+
+	while (state.KeepRunning()) {
+		pthreadpool_parallelize_3d_tile_2d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(compute_gemm_tile),
+			const_cast<gemm_context*>(&context),
+			kBatchSize, kMatrixSize, kMatrixSize,
+			kTileSize, kTileSize,
+			flags);
+	}
+	pthreadpool_destroy(threadpool);
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * kBatchSize * kMatrixSize * kMatrixSize * kMatrixSize);
+}
+BENCHMARK(pthreadpool_parallelize_3d_tile_2d_gemm)->UseRealTime()->Apply(SetNumberOfThreadsAndTileOrder);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <pthreadpool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+
+/*
+ * Submits computations with fewer items than threads to a thread pool whose workers sleep between computations, and
+ * sweeps the number of items. Only as many workers as the computation has items for wake up, so the cost of a
+ * computation should grow with the number of items rather than with the size of the thread pool. The latency_us counter
+ * is the mean latency of a computation, and the cpu_us counter is the processor time the whole process used per
+ * computation, including the time woken workers spent before they went back to sleep.
+ */
+
+static void SetItems(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("items");
+	const int max_threads = std::max<int>(std::thread::hardware_concurrency(), 2);
+	for (int items = 2; items < max_threads; items *= 2) {
+		benchmark->Arg(items);
+	}
+	benchmark->Arg(max_threads);
+}
+
+static void compute_item(void*, size_t) {
+	/* Keep the item busy long enough for woken workers to join the computation */
+	const auto end = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+	while (std::chrono::steady_clock::now() < end) {
+	}
+}
+
+static void wake_sleeping_workers(benchmark::State& state) {
+	pthreadpool_t threadpool = pthreadpool_create(0);
+	/* Without spinning, the workers go to sleep as soon as they run out of work */
+	pthreadpool_set_spin_policy(threadpool, PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	const size_t items = std::min<size_t>(static_cast<size_t>(state.range(0)), pthreadpool_get_threads_count(threadpool));
+
+	double total_latency = 0.0;
+	const std::clock_t cpu_start = std::clock();
+	while (state.KeepRunning()) {
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+		const auto start = std::chrono::steady_clock::now();
+		pthreadpool_parallelize_1d(threadpool, compute_item, nullptr, items, 0 /* flags */);
+		const auto end = std::chrono::steady_clock::now();
+
+		total_latency += std::chrono::duration<double, std::micro>(end - start).count();
+	}
+	const std::clock_t cpu_end = std::clock();
+	pthreadpool_destroy(threadpool);
+
+	state.counters["latency_us"] = total_latency / double(state.iterations());
+	state.counters["cpu_us"] = double(cpu_end - cpu_start) * 1.0e6 / CLOCKS_PER_SEC / double(state.iterations());
+}
+BENCHMARK(wake_sleeping_workers)->UseRealTime()->Apply(SetItems);
+
+
+BENCHMARK_MAIN();
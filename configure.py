@@ -12,7 +12,7 @@ def main(args):
     build.export_cpath("include", ["pthreadpool.h"])
 
     with build.options(source_dir="src", extra_include_dirs="src", deps=build.deps.fxdiv):
-        sources = ["legacy-api.c", "portable-api.c"]
+        sources = ["legacy-api.c", "portable-api.c", "scan.c", "sort.c"]
         if build.target.is_emscripten:
             sources.append("shim.c")
         elif build.target.is_macos:
@@ -30,6 +30,17 @@ def main(args):
         build.benchmark("examples", build.cxx("addition.c"))
         build.benchmark("latency-bench", build.cxx("latency.cc"))
         build.benchmark("throughput-bench", build.cxx("throughput.cc"))
+        build.benchmark("stealing-bench", build.cxx("stealing.cc"))
+        build.benchmark("tile-order-bench", build.cxx("tile-order.cc"))
+        build.benchmark("affinity-bench", build.cxx("affinity.cc"))
+        build.benchmark("scan-bench", build.cxx("scan.cc"))
+        build.benchmark("sort-bench", build.cxx("sort.cc"))
+        build.benchmark("nested-bench", build.cxx("nested.cc"))
+        build.benchmark("graph-bench", build.cxx("graph.cc"))
+        build.benchmark("adaptive-bench", build.cxx("adaptive.cc"))
+        build.benchmark("priority-bench", build.cxx("priority.cc"))
+        build.benchmark("spin-bench", build.cxx("spin.cc"))
+        build.benchmark("wakeup-bench", build.cxx("wakeup.cc"))
 
     return build
 
@@ -1,10 +1,14 @@
 #ifndef PTHREADPOOL_H_
 #define PTHREADPOOL_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 typedef struct pthreadpool* pthreadpool_t;
+typedef struct pthreadpool_plan* pthreadpool_plan_t;
+typedef struct pthreadpool_async* pthreadpool_async_t;
+typedef struct pthreadpool_graph* pthreadpool_graph_t;
 
 // άȵͣڲͬάȵ̳߳زл ÿͽһָ롢һͿѡ߳IDƬС 1D6DͣԼǵƬ
 typedef void (*pthreadpool_task_1d_t)(void*, size_t);
@@ -38,6 +42,18 @@ typedef void (*pthreadpool_task_4d_tile_2d_with_id_t)(void*, uint32_t, size_t, s
 typedef void (*pthreadpool_task_2d_tile_1d_with_id_with_thread_t)(void*, uint32_t, size_t, size_t, size_t, size_t);
 typedef void (*pthreadpool_task_3d_tile_1d_with_id_with_thread_t)(void*, uint32_t, size_t, size_t, size_t, size_t, size_t);
 
+// ԼͣһĿۻۼУϲͣڶֽϲһֽ
+typedef void (*pthreadpool_task_1d_reduce_t)(void*, void*, size_t, size_t);
+typedef void (*pthreadpool_combine_t)(void*, void*, const void*);
+// ȽϺͣһģظֱʾڶСڡڻڵ
+typedef int (*pthreadpool_compare_t)(void*, const void*, const void*);
+// νʺͣԵڶָĿtrueʾĿƥ
+typedef bool (*pthreadpool_task_1d_predicate_t)(void*, size_t);
+// ɻصͣǴݸ첽лĻص
+typedef void (*pthreadpool_async_callback_t)(void*);
+// SPMDͣڶǵ̵߳ıţǲ߳
+typedef void (*pthreadpool_task_spmd_t)(void*, size_t, size_t);
+
 /**
  * ڼڼ䣬޶ȵؽöԷǹ淶ֵ֧֡
  *
@@ -59,6 +75,94 @@ typedef void (*pthreadpool_task_3d_tile_1d_with_id_with_thread_t)(void*, uint32_
   */
 #define PTHREADPOOL_FLAG_YIELD_WORKERS 0x00000002
 
+/**
+ * ˳ѡȡĿ̡߳
+ *
+ * Ĭ£ԼΧ̶̰߳ (thread_number - 1) mod threads_count ˳̣߳
+ п̻߳ἯеͬھϣͬһС
+ ˱־ʹÿ̴߳һѡ߳̿ʼ飬Ӷȡ߷ɢͬĿ̡߳
+ */
+#define PTHREADPOOL_FLAG_STEAL_RANDOM 0x00000004
+
+/**
+ * ʹ"ѡ"power-of-two-choicesѡȡĿ̡߳
+ *
+ * ÿȡǰȡ̣߳ѡʣĿ϶һ
+ ̶߳ûʣĿλÿʼ˳̡߳
+ */
+#define PTHREADPOOL_FLAG_STEAL_TWO_CHOICES 0x00000008
+
+/**
+ * ֮ǰÿ̴߳Ŀѧϰ߳Ȩء
+ *
+ * ùȡ̻߳һֱÿ̴߳Ŀ̳߳еı
+ ˱־ʹ̳߳ڻַΧ֮ǰһͳָͨƶƽϲ߳ȨУ
+ Ӷ칹СˣΪϿ̷߳ϴĳʼΧȡ
+ ѧϰȨؿͨpthreadpool_get_thread_weightsѯ
+ */
+#define PTHREADPOOL_FLAG_LEARN_WEIGHTS 0x00000010
+
+/**
+ * ZMorton˳򣩶˳򽫶άƬ̡߳
+ *
+ * Ĭ£pthreadpool_parallelize_2d_tile_2dpthreadpool_parallelize_3d_tile_2d˳Ƭţ
+ ÿ̵߳Χһˮƽ˱־ʹƬZ߱ţ
+ Ӷÿ̵߳ķΧԼȡһ뷶ΧһյĽ򣬸ģGEMMں˵Ļá
+ pthreadpool_parallelize_3d_tile_2dZӦÿiֵڵ(j, k)Ƭƽ档
+ ڵ߳˳ִʱ˱־ЧлԴ˱־
+ */
+#define PTHREADPOOL_FLAG_TILE_ORDER_MORTON 0x00000020
+
+/**
+ * ʹþ̬ȣÿֻ߳ԼĳʼΧ߳ȡ
+ *
+ * ʼΧֻȡڵΧ߳߳ȨأڷΧͬУͬĿ̴ͬ߳
+ ߳̿һε˽л棨L2еݡ֮߳ĸزⲻͨȡֲ
+ ˴˱־ÿĿļ㡣PTHREADPOOL_FLAG_LEARN_WEIGHTSһʹʱĿ̵߳ӳѧϰȨر仯
+ */
+#define PTHREADPOOL_FLAG_STATIC_SCHEDULE 0x00000040
+
+/**
+ * ֮ǰвõÿĿĿӦѡִмƻ߳
+ *
+ * ѹ̲߳ȴɵĿ㱾޹أ˶Ŀٻ۵ļ㣬ڵ߳ϴд̳߳д졣
+ ˱־ʹpthreadpool_run_plan¼̴߳ÿĿõʱ䣬ָͨƶƽƼƻÿĿĿ
+ һʱֻʹֵܷ㹻̣߳ƵĹ̫Сʱƻڵ߳ϴд
+ ֻһֻȫ̡߳һʹüƻ̡߳
+ *
+ * ˱־ִֻмƻЧֻӰpthreadpool_run_planÿƻֱѧϰԼĿ
+ ӦΪÿõ㴴һƻڶ߳ʹô˱־ͬһƻʱĿĹƿܲ׼ȷӰ졣
+ Ӧƻ̳߳ڽе㲢ִУPTHREADPOOL_FLAG_LEARN_WEIGHTSPTHREADPOOL_FLAG_STATIC_SCHEDULE־
+ лԴ˱־
+ */
+#define PTHREADPOOL_FLAG_ADAPTIVE_THREADS 0x00000080
+
+/**
+ * Ըȼ㣬ʹռ̳߳ڽе㡣
+ *
+ * Ĭ£һ̵߳ĳʱռ̳߳ʱµļֻɵ̺߳ɹ̴߳
+ ˶ӳеļᱻ̨ӡʹô˱־ļΪȼҵ̳߳У
+ ߵḶ́߳ڴ߳ĿƬ֮䷢ָȼҵ
+ ͣǰ㣬Ȱȼҵɺټͣļ㡣ռһĿִе񲻻ᱻжϡ
+ *
+ * ˱־Ӱ첢лpthreadpool_run_planִмƻȼ㲻ᱻȼռ
+ ڲͬһ̳߳صǶ׵ԵȼԴ˱־
+ */
+#define PTHREADPOOL_FLAG_HIGH_PRIORITY 0x00000100
+
+/**
+ * ȴԣ߳ڽ֮ǰȴpthreadpool_set_spin_policyָʱ䡣
+ */
+#define PTHREADPOOL_SPIN_POLICY_FIXED 0
+
+/**
+ * ȴԣݹ۲쵽֮ļӦѡ߳ڽ֮ǰȴʱ䡣
+ *
+ * ʱ䣬߳ԼΪͼʱ䣬Ӷ軽Ѽɴһ
+ ֻ߳ͽߣͻ֮ռô´̳߳صĬϲԡ
+ */
+#define PTHREADPOOL_SPIN_POLICY_ADAPTIVE 1
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -66,6 +170,14 @@ extern "C" {
 	/**
 	 * һָ̳߳߳ء
 	 *
+	 * ̳߳еٴεͬһ̳߳صĲлǶײУǶ׵òȴɣ
+	 ɵ߳㹤̻߳Ƕ׼㲢ȡеĿ
+	 ߳̿ͬʱͬһ̳߳صĲл̳߳ڴһ̵߳ĵʱ
+	 µĵΪҵɵ߳ɹ̺߳͵ȴĹ̻߳벢ҵ
+	 δʹPTHREADPOOL_FLAG_LEARN_WEIGHTSPTHREADPOOL_FLAG_STATIC_SCHEDULE־ʱĿƬ߳ļҲΪҵֻѴ߹̣߳๤̼߳ߡ
+	 Ƕ׼Ͳҵдݸֻ̱߳ڸüΨһͬʱе̱߳ظ
+	 ǺPTHREADPOOL_FLAG_LEARN_WEIGHTSPTHREADPOOL_FLAG_STATIC_SCHEDULE־
+	 *
 	 * @param  threads_count  ̳߳е߳
 	 *    ֵΪ0ͣһ̳߳أ߳ϵͳе߼ͬ
 	 *
@@ -82,6 +194,143 @@ extern "C" {
 	 */
 	size_t pthreadpool_get_threads_count(pthreadpool_t threadpool);
 
+	/**
+	 * ̳߳ÿ̵߳ĻNUMAϢ
+	 *
+	 * ̳߳شʱ¼ÿ߳ʱڴĩNUMAڵ㡣ԼΧ߳ȴ
+	 ĩ߳ȡͬһNUMAڵϵ̡̣߳߳
+	 ˺ڽ̰߳󶨵ضṩ׼ȷˣڵڵϵͳģڵˡ
+	 *
+	 * @note ˺ʹ̳ͬ߳صĲлͬʱá
+	 *
+	 * @param threadpool     Ҫ޸ĵ̳߳ءthreadpoolΪNULL˺ִκβ
+	 * @param cache_domains  pthreadpool_get_threads_count(threadpool)Ԫص飬ÿ̵߳ĩʶ
+	 *    ͬʶ̹߳ĩ档ΪNULL⵽ֵ
+	 * @param numa_domains   pthreadpool_get_threads_count(threadpool)Ԫص飬ÿ̵߳NUMAڵʶ
+	 *    ΪNULL⵽ֵ
+	 */
+	void pthreadpool_set_topology(
+		pthreadpool_t threadpool,
+		const uint32_t* cache_domains,
+		const uint32_t* numa_domains);
+
+	/**
+	 * ̳߳ÿ̵߳Ȩء
+	 *
+	 * л߳ȨصıΧָ̣߳ȨΪ̳߳߳ʼĿ
+	 ȨΪ0̳߳ʼĿֻͨȡùȨȣĬϵȫ0ʱΧƽ֡
+	 *
+	 * @note ˺ʹ̳ͬ߳صĲлͬʱá
+	 *
+	 * @param threadpool  Ҫ޸ĵ̳߳ءthreadpoolΪNULL˺ִκβ
+	 * @param weights     pthreadpool_get_threads_count(threadpool)Ԫص飬ÿ̵߳Ȩء
+	 *    ΪNULLָƽ֡
+	 */
+	void pthreadpool_set_thread_weights(
+		pthreadpool_t threadpool,
+		const uint32_t* weights);
+
+	/**
+	 * ѯ̳߳ÿ̵߳Ȩء
+	 *
+	 * @param threadpool  Ҫѯ̳߳ء
+	 * @param weights     pthreadpool_get_threads_count(threadpool)Ԫص飬ڽÿ̵߳Ȩأ
+	 *    ͨPTHREADPOOL_FLAG_LEARN_WEIGHTSѧϰȨء
+	 */
+	void pthreadpool_get_thread_weights(
+		pthreadpool_t threadpool,
+		uint32_t* weights);
+
+	/**
+	 * ̳߳صȴԡ
+	 *
+	 * ȴĹ̡߳ȴ߳ɵĵ߳Լϴȴ߳ȴһʱ䣬ʱŽߡ
+	 Ա⻽̵߳ӳ٣ڵȴڼռôʱƣmax_spin_ns
+	 ʹPTHREADPOOL_SPIN_POLICY_FIXEDʱ߳max_spin_nsʹPTHREADPOOL_SPIN_POLICY_ADAPTIVEʱ
+	 ̵߳ȴʱ֮ļӦmax_spin_nsΪ0ʱȴ߳ߡ
+	 ´̳߳ʹӦԣʱΪ5롣
+	 *
+	 * @note ˺ʹ̳ͬ߳صĲлͬʱá
+	 *
+	 * @param threadpool   Ҫ޸ĵ̳߳ءthreadpoolΪNULLŶӣ˺ִκβ
+	 * @param policy       PTHREADPOOL_SPIN_POLICY_FIXEDPTHREADPOOL_SPIN_POLICY_ADAPTIVE
+	 * @param max_spin_ns  ȴʱ䣬ơ
+	 */
+	void pthreadpool_set_spin_policy(
+		pthreadpool_t threadpool,
+		uint32_t policy,
+		uint64_t max_spin_ns);
+
+	/**
+	 * ѯ̳߳صĹ̵߳ǰȴʱʱ䡣
+	 *
+	 * @param threadpool  Ҫѯ̳߳ءŶӣŶ̳߳صʱ䡣
+	 *
+	 * @returns  ֮߳̽ǰȴʱ䣬ơthreadpoolΪNULL0
+	 */
+	uint64_t pthreadpool_get_spin_wait_ns(pthreadpool_t threadpool);
+
+	/**
+	 * ̳߳صŶӣ̳߳б[first_thread, first_thread + threads_count)Χڵ߳ɵͼ
+	 *
+	 * ŶӿΪ̳߳شݸвлִмƻ첽ͼŶӵļֻ̳߳ڸŶӵ̣߳
+	 ɵ̺߳Щ̴߳ȴ̳߳ػŶڽеļ㡣ˣһ̳߳ػΪཻŶӣ
+	 öͬʱʹûĲ֣ͬΪÿߴһӵȫ̵̳߳߳ء
+	 ̳߳ص0߳ûжӦϵͳ̣߳ɵ߳䵱0̵߳Ŷthreads_counṭ߳
+	 Ŷthreads_count + 1̣̣߳߳
+	 *
+	 * ŶûԼϵͳ̡̳߳߳رϵõĲлȻʹ̡߳ŶеļΪҵִУ
+	 PTHREADPOOL_FLAG_LEARN_WEIGHTSPTHREADPOOL_FLAG_STATIC_SCHEDULE־Ŷϵpthreadpool_run_spmdʱ
+	 ֻһ߳ϵáÿ߳һŶӣŶصֻ߳ЭŶӡ
+	 *
+	 * @param threadpool     Ҫֵ̳߳أŶӡ
+	 * @param first_thread   Ŷеһ̳߳߳еıš
+	 * @param threads_count  Ŷ̳߳ռõ߳0
+	 *
+	 * @returns  óɹָŶӵָ룻threadpoolΪNULLŶӡ̷߳ΧЧڴʧܣNULLָ롣
+	 */
+	pthreadpool_t pthreadpool_create_team(
+		pthreadpool_t threadpool,
+		size_t first_thread,
+		size_t threads_count);
+
+	/**
+	 * »Ŷӣʹ̳߳б[first_thread, first_thread + threads_count)Χڵ߳ɣ´̡߳
+	 *
+	 * @note ˺Ŷӻʹ̳ͬ߳صŶм㣨δɵ첽㣩ʱá
+	 ΪŶӴִмƻͼʱֹ߳˱»Ŷ֮ǰ٣֮´
+	 *
+	 * @param team           Ҫ»ֵŶӡ
+	 * @param first_thread   Ŷеһ̳߳߳еıš
+	 * @param threads_count  Ŷ̳߳ռõ߳0
+	 *
+	 * @returns  óɹtrueteamŶӻ̷߳ΧЧfalseŶӱֲ䡣
+	 */
+	bool pthreadpool_set_team_threads(
+		pthreadpool_t team,
+		size_t first_thread,
+		size_t threads_count);
+
+	/**
+	 * ͷŶӡŶӵֻ̳߳߳ءŶӱ̳֮߳ǰ٣Ҳڽеļ㡣
+	 *
+	 * @param team  ҪٵŶӡteamΪNULL˺ִκβ
+	 */
+	void pthreadpool_destroy_team(pthreadpool_t team);
+
+	/**
+	 * ȡ̳߳ڽеļ㡣
+	 *
+	 * ˺Ӧִеڲá߳ʣĹΧ㣬ʹֹ߳ͣȡȡĿ
+	 лȡĿϺ󷵻ءȡǾΪģѱ߳ȡĿԻᱻ
+	 ڵ߳ϴִеļ㣨̳߳ΪNULLֻһ̻߳ΧСʱӰ졣
+	 ȡֻӰ쵱ǰ㣬һβлýĿ
+	 *
+	 * @param threadpool  Ҫȡ䵱ǰ̳߳ءthreadpoolΪNULL˺ִκβ
+	 */
+	void pthreadpool_cancel(
+		pthreadpool_t threadpool);
+
 	/**
 	 * һάϴĿ
 	 *
@@ -92,7 +341,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿĿҪõĺ
@@ -117,7 +366,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿĿҪõĺ
@@ -145,7 +394,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿĿҪõĺ
@@ -174,7 +423,7 @@ extern "C" {
 	 *
 	 * ÷ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -191,6 +440,320 @@ extern "C" {
 		size_t tile,
 		uint32_t flags);
 
+	/**
+	 * һάϴĿÿԭӲĿ
+	 *
+	 * úʵ´ƬεĲа汾
+	 *
+	 *   for (size_t i = 0; i < range; i++)
+	 *     function(context, i);
+	 *
+	 * pthreadpool_parallelize_1dͬ߳ÿԭӲԼĹΧgrainĿ
+	 ÿĿִһԭӲӶʹΧͬ
+	 *
+	 * ʱĿѴϣ̳߳׼ý
+	 *
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
+	 * @param function    ÿĿҪõĺ
+	 * @param context     ݸָĵһ
+	 * @param range       ҪһάϵĿָĺΪÿĿһΡ
+	 * @param grain       ÿԭӲĿֵΪ0ͣrange߳Զѡ
+	 ʹÿ̵߳ĳʼΧԼΪ32졣
+	 * @param flags       һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_parallelize_1d_with_grain(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_t function,
+		void* context,
+		size_t range,
+		size_t grain,
+		uint32_t flags);
+
+	/**
+	 * һάϲйԼĿ
+	 *
+	 * úʵ´ƬεĲа汾
+	 *
+	 *   memcpy(result, identity, value_size);
+	 *   for (size_t i = 0; i < range; i += tile)
+	 *     function(context, result, i, min(range - i, tile));
+	 *
+	 * ÿ߳ԼĲֽۻĿֽidentityʼλڶĻϣα
+	 ߳ԼĿڹ߳ϰϲֽÿһнɵ̵߳combineϲֽ
+	 ˵̲߳Ҫкϲвֽ
+	 Ŀ֮߳ķͺϲ˳ȷcombineɺͽɣidentitycombineĵλԪ
+	 *
+	 * ʱĿѴϣresultԼ̳߳׼ý
+	 *
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
+	 * @param function    ÿƬҪõĺƬеĿۻڶָĲֽС
+	 * @param combine     ϲָĲֽϲڶָĲֽС
+	 * @param context     ݸfunctioncombineĵһ
+	 * @param identity    ָԼλԪָ룬ÿֽ䰴ֽڸƳʼ
+	 * @param result      ָԼָ룬СΪvalue_sizeֽڡ
+	 * @param value_size  ֽ͹ԼĴСֽڣ
+	 * @param range       ҪһάϵĿ
+	 * @param tile        ÿκҪһάϵĿֵΪ1ʱĿfunction
+	 * @param flags       һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_parallelize_1d_reduce(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_reduce_t function,
+		pthreadpool_combine_t combine,
+		void* context,
+		const void* identity,
+		void* result,
+		size_t value_size,
+		size_t range,
+		size_t tile,
+		uint32_t flags);
+
+	/**
+	 * һάϲвҵһƥĿ
+	 *
+	 * úʵ´ƬεĲа汾
+	 *
+	 *   for (size_t i = 0; i < range; i++)
+	 *     if (function(context, i))
+	 *       return i;
+	 *   return range;
+	 *
+	 * ÿ̰߳˳ԼĿҵƥ߳ԭӲҵСֹͣԼķΧ
+	 ߳СҵĿʱֹͣƥ֮Ŀ಻ᱻֵ
+	 СڷֵĿѱֵĿҲֵܱfunctionӦֵΧĸá
+	 *
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
+	 * @param function    ÿĿҪõνʺĿƥʱtrue
+	 * @param context     ݸָĵһ
+	 * @param range       ҪһάϵĿ
+	 * @param flags       һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 *
+	 * @returns һƥĿûƥĿ򷵻range
+	 */
+	size_t pthreadpool_parallelize_1d_find_first(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_predicate_t function,
+		void* context,
+		size_t range,
+		uint32_t flags);
+
+	/**
+	 * мʽǰ׺ɨ裨inclusive scan
+	 *
+	 * úʵ´ƬεĲа汾
+	 *
+	 *   accumulator = identity;
+	 *   for (size_t i = 0; i < count; i++) {
+	 *     combine(context, &accumulator, &input[i]);
+	 *     output[i] = accumulator;
+	 *   }
+	 *
+	 * ԪرΪĿ飬㣺һ̳߳ϲйԼÿ飨һ⣩
+	 ڶڵ߳ϼǰ׺̳߳ϴӿǰ׺ʼɨÿ顣
+	 뱻ȡΣдһΡ
+	 * combineɣҪ󽻻ɣidentitycombineĵλԪ
+	 *
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param threadpool    ڲл̳߳ءthreadpoolΪNULLڵ߳ϴɨԪء
+	 * @param combine       ϲָԪغϲڶָۼֵУۼֵ = ۼֵ  Ԫأ
+	 * @param context       ݸcombineĵһ
+	 * @param identity      ָcombineλԪָ롣
+	 * @param input         Ԫ顣
+	 * @param output        Ԫ顣صΪɨмֵС
+	 * @param element_size  ÿԪصĴСֽڣ
+	 * @param count         Ԫ
+	 * @param flags         һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_inclusive_scan(
+		pthreadpool_t threadpool,
+		pthreadpool_combine_t combine,
+		void* context,
+		const void* identity,
+		const void* input,
+		void* output,
+		size_t element_size,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * мʽǰ׺ɨ裨exclusive scan
+	 *
+	 * úʵ´ƬεĲа汾
+	 *
+	 *   accumulator = identity;
+	 *   for (size_t i = 0; i < count; i++) {
+	 *     output[i] = accumulator;
+	 *     combine(context, &accumulator, &input[i]);
+	 *   }
+	 *
+	 * 㷨Ͳpthreadpool_inclusive_scanͬ
+	 */
+	void pthreadpool_exclusive_scan(
+		pthreadpool_t threadpool,
+		pthreadpool_combine_t combine,
+		void* context,
+		const void* identity,
+		const void* input,
+		void* output,
+		size_t element_size,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м32λ޷İʽǰ׺ͣoutput[i] = input[0] + ... + input[i]2^32ȡģ
+	 *
+	 * ʹòʾúͬ32λзoutputԵinputԭɨ裩
+	 * 㷨pthreadpool_inclusive_scanͬ
+	 */
+	void pthreadpool_inclusive_scan_u32(
+		pthreadpool_t threadpool,
+		const uint32_t* input,
+		uint32_t* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м32λ޷ʽǰ׺ͣoutput[0] = 0output[i] = input[0] + ... + input[i - 1]2^32ȡģ
+	 *
+	 * ʹòʾúͬ32λзoutputԵinputԭɨ裩
+	 */
+	void pthreadpool_exclusive_scan_u32(
+		pthreadpool_t threadpool,
+		const uint32_t* input,
+		uint32_t* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м64λ޷İʽǰ׺ͣ2^64ȡģͬ64λзoutputԵinputԭɨ裩
+	 */
+	void pthreadpool_inclusive_scan_u64(
+		pthreadpool_t threadpool,
+		const uint64_t* input,
+		uint64_t* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м64λ޷ʽǰ׺ͣ2^64ȡģͬ64λзoutputԵinputԭɨ裩
+	 */
+	void pthreadpool_exclusive_scan_u64(
+		pthreadpool_t threadpool,
+		const uint64_t* input,
+		uint64_t* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м㵥ȸİʽǰ׺͡outputԵinputԭɨ裩
+	 *
+	 * ĺڲмʱͬ˳ӣ˽봮ɨ費ͬȡ߳
+	 */
+	void pthreadpool_inclusive_scan_f32(
+		pthreadpool_t threadpool,
+		const float* input,
+		float* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м㵥ȸʽǰ׺͡outputԵinputԭɨ裩
+	 *
+	 * ĺڲмʱͬ˳ӣ˽봮ɨ費ͬȡ߳
+	 */
+	void pthreadpool_exclusive_scan_f32(
+		pthreadpool_t threadpool,
+		const float* input,
+		float* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м˫ȸİʽǰ׺͡outputԵinputԭɨ裩
+	 *
+	 * ĺڲмʱͬ˳ӣ˽봮ɨ費ͬȡ߳
+	 */
+	void pthreadpool_inclusive_scan_f64(
+		pthreadpool_t threadpool,
+		const double* input,
+		double* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * м˫ȸʽǰ׺͡outputԵinputԭɨ裩
+	 *
+	 * ĺڲмʱͬ˳ӣ˽봮ɨ費ͬȡ߳
+	 */
+	void pthreadpool_exclusive_scan_f64(
+		pthreadpool_t threadpool,
+		const double* input,
+		double* output,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * ʹ̳߳زСԪء
+	 *
+	 * úʵȶĲй鲢ԪرΪĿ飬ÿһ߳
+	 ȻִϲĶΡÿһֵΪȵĲ֣ÿͨ϶ֲҺϲ·λ룬
+	 ˼ʹֻʣΣϲҲ̱߳æµʹ̳߳еḶ́߳ᴴ̡߳
+	 *
+	 * ҪһСͬʱ޷ʱڵ߳ʹòȶԭض
+	 *
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param threadpool    ڲл̳߳ءthreadpoolΪNULLڵ߳ϴ
+	 * @param compare       ȽϺȵԪط㣬򱣳ǵ˳
+	 * @param context       ݸcompareĵһ
+	 * @param base          ҪԪ顣
+	 * @param element_size  ÿԪصĴСֽڣ
+	 * @param count         Ԫ
+	 * @param flags         һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_sort(
+		pthreadpool_t threadpool,
+		pthreadpool_compare_t compare,
+		void* context,
+		void* base,
+		size_t element_size,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * ʹ̳߳زа32λ޷
+	 *
+	 * úʵLSDÿ鴦8λ֣ͳÿֱͼڵ߳ϼÿƫƣ
+	 Ȼзɢÿļмͬı飨ĸλȫΪʱᱻ
+	 ҪһСͬʱ޷䣬ڵ߳ʹqsort
+	 *
+	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴ
+	 * @param keys        Ҫļ顣
+	 * @param count       
+	 * @param flags       һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_sort_u32(
+		pthreadpool_t threadpool,
+		uint32_t* keys,
+		size_t count,
+		uint32_t flags);
+
+	/**
+	 * ʹ̳߳زа64λ޷㷨pthreadpool_sort_u32ͬҪ8顣
+	 */
+	void pthreadpool_sort_u64(
+		pthreadpool_t threadpool,
+		uint64_t* keys,
+		size_t count,
+		uint32_t flags);
+
 	/**
 	 * ڶάϴĿ
 	 *
@@ -202,7 +765,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿĿҪõĺ
@@ -230,7 +793,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿĿҪõĺ
@@ -258,7 +821,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -291,7 +854,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿƬҪõĺ
@@ -328,7 +891,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿƬҪõĺ
@@ -363,7 +926,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -399,7 +962,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿƬҪõĺ
@@ -436,7 +999,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿĿҪõĺ
@@ -467,7 +1030,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -500,7 +1063,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -536,7 +1099,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿƬҪõĺ
@@ -576,7 +1139,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool           ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function             ÿƬҪõĺ
@@ -617,7 +1180,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -666,7 +1229,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool           the thread pool to use for parallelisation. If
 	 *    threadpool is NULL, all items are processed serially on the calling
@@ -724,7 +1287,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -767,7 +1330,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -814,7 +1377,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -867,7 +1430,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool           the thread pool to use for parallelisation. If
 	 *    threadpool is NULL, all items are processed serially on the calling
@@ -929,7 +1492,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -976,7 +1539,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -1027,7 +1590,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -1080,7 +1643,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -1133,7 +1696,7 @@ extern "C" {
 	 * is ready for a new task.
 	 *
 	 * @note If multiple threads call this function with the same thread pool, the
-	 *    calls are serialized.
+	 *    calls run concurrently, and idle threads of the pool help with all of them.
 	 *
 	 * @param threadpool  the thread pool to use for parallelisation. If threadpool
 	 *    is NULL, all items are processed serially on the calling thread.
@@ -1185,7 +1748,7 @@ extern "C" {
 	 *
 	 * ʱĿѴϣ̳߳׼ý
 	 *
-	 * @note ߳ʹ̳ͬ߳صô˺Щýл
+	 * @note ߳ʹ̳ͬ߳صô˺ЩòִУ̳߳пе߳Эеá
 	 *
 	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLڵ߳ϴдĿ
 	 * @param function    ÿƬҪõĺ
@@ -1215,15 +1778,381 @@ extern "C" {
 		uint32_t flags);
 
 	/**
-	 * ֹ̳߳е̲߳ͷԴ
+	 * Ϊpthreadpool_parallelize_1dôԤִмƻ
 	 *
-	 * @warning ڵô˺̳߳ؽδΪܵ𻵡
+	 * ִмƻԤȼ㲢лݣFXdivƬѡ̺߳Լÿ̵߳ĳʼΧ
+	 pthreadpool_run_planֻ轫ЩݸƵ̳߳ز̣߳ʺͬ״ִеļ㡣
+	 ÿ̵߳ĳʼΧݴƻʱ߳Ȩؼ㣬֮߳Ȩص޸ģPTHREADPOOL_FLAG_LEARN_WEIGHTSӰƻ
 	 *
-	 * @param[in,out]  threadpool  Ҫٵ̳߳ء
+	 * @param threadpool  ڲл̳߳ءthreadpoolΪNULLƻڵ߳ϴдĿ
+	 * @param function    ÿĿҪõĺ
+	 * @param context     ݸָĵһ
+	 * @param range       ҪĿ
+	 * @param flags       һѡ־İλϣpthreadpool_parallelize_1dͬ
+	 *
+	 * @returns  óɹָ͸ִмƻָ룻ڴʧܣNULLָ롣
 	 */
-	void pthreadpool_destroy(pthreadpool_t threadpool);
-
-#ifndef PTHREADPOOL_NO_DEPRECATED_API
+	pthreadpool_plan_t pthreadpool_create_plan_1d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_t function,
+		void* context,
+		size_t range,
+		uint32_t flags);
+
+	/**
+	 * Ϊpthreadpool_parallelize_1d_tile_1dôԤִмƻμpthreadpool_create_plan_1d
+	 */
+	pthreadpool_plan_t pthreadpool_create_plan_1d_tile_1d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_tile_1d_t function,
+		void* context,
+		size_t range,
+		size_t tile,
+		uint32_t flags);
+
+	/**
+	 * Ϊpthreadpool_parallelize_2dôԤִмƻμpthreadpool_create_plan_1d
+	 */
+	pthreadpool_plan_t pthreadpool_create_plan_2d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		uint32_t flags);
+
+	/**
+	 * Ϊpthreadpool_parallelize_2d_tile_1dôԤִмƻμpthreadpool_create_plan_1d
+	 */
+	pthreadpool_plan_t pthreadpool_create_plan_2d_tile_1d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_tile_1d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t tile_j,
+		uint32_t flags);
+
+	/**
+	 * Ϊpthreadpool_parallelize_2d_tile_2dôԤִмƻμpthreadpool_create_plan_1d
+	 */
+	pthreadpool_plan_t pthreadpool_create_plan_2d_tile_2d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_tile_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t tile_i,
+		size_t tile_j,
+		uint32_t flags);
+
+	/**
+	 * Ϊpthreadpool_parallelize_3d_tile_2dôԤִмƻμpthreadpool_create_plan_1d
+	 */
+	pthreadpool_plan_t pthreadpool_create_plan_3d_tile_2d(
+		pthreadpool_t threadpool,
+		pthreadpool_task_3d_tile_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t range_k,
+		size_t tile_j,
+		size_t tile_k,
+		uint32_t flags);
+
+	/**
+	 * ִԤִмƻЧʹôƻʱĲӦĲлͬ
+	 *
+	 * ʱĿѴϣ̳߳׼ý
+	 *
+	 * @note ߳ʹִ̳ͬ߳мƻòлЩòִУ̳߳пе߳Эеá
+	 *
+	 * @param plan  Ҫִеļƻ
+	 */
+	void pthreadpool_run_plan(pthreadpool_plan_t plan);
+
+	/**
+	 * ƴִмƻ߳Ŀٵļ㣺ֻвmax_threads̲߳㣬
+	 ֻЩ̱߳ѣΧֻЩ֮߳仮֣̳߳е̱߳˯ߡ
+	 *
+	 * ޵ļƻȴ̳߳ڽе㣬ִ֮С޵ļƻPTHREADPOOL_FLAG_LEARN_WEIGHTS
+	 PTHREADPOOL_FLAG_STATIC_SCHEDULE־
+	 *
+	 * @param plan         Ҫ޸ĵļƻִ߳иüƻʱô˺
+	 * @param max_threads  ƻ̡߳߳max_threadsΪ1ƻڵ߳ϴд
+	 max_threadsΪ0С̳߳е߳ƻʹ̡߳
+	 ʹPTHREADPOOL_FLAG_ADAPTIVE_THREADS־ļƻڴѡ߳
+	 */
+	void pthreadpool_set_plan_max_threads(pthreadpool_plan_t plan, size_t max_threads);
+
+	/**
+	 * ͷִмƻƻ̳֮߳ǰ١
+	 *
+	 * @param plan  ҪٵļƻplanΪNULL˺ִκβ
+	 */
+	void pthreadpool_destroy_plan(pthreadpool_plan_t plan);
+
+	/**
+	 * 첽ִԤִмƻأȴĿϡ
+	 *
+	 * ̳߳еĹ̴߳߳̿ڴڼִI/O׼һݣ
+	 ֮ͨpthreadpool_wait_asyncȴɡ߳̿Բ㵫Ǳģ
+	 pthreadpool_wait_asyncڵ߳ϴδ߳ȡĹ
+	 ƻֻڴ˺ڶȡغ󼴿ٻٴִС
+	 *
+	 * ̳߳ΪNULLֻһ̡߳ƻڵ߳ϴд̳߳в۶ռã
+	 ڴ˺֮ǰڵ߳ɡ
+	 *
+	 * @warning 첽̳֮߳ǰͨpthreadpool_wait_asyncpthreadpool_destroy_asyncȴɡ
+	 pthreadpool_wait_asyncͷż֮ǰռ̳߳еһۣӦȴɵļ㡣
+	 *
+	 * @param plan              Ҫִеļƻ
+	 * @param callback          ɺһεĺڴһ߳ϵãṇ̀߳
+	 *    ʱĿѴϡcallbackΪNULL򲻵κκ
+	 * @param callback_context  ݸɻصĲ
+	 *
+	 * @returns  óɹָ͸첽ָ룻ڴʧܣNULLָ룬ʱδ
+	 */
+	pthreadpool_async_t pthreadpool_run_plan_async(
+		pthreadpool_plan_t plan,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_1d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_1d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_t function,
+		void* context,
+		size_t range,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_1d_tile_1d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_1d_tile_1d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_1d_tile_1d_t function,
+		void* context,
+		size_t range,
+		size_t tile,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_2d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_2d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_2d_tile_1d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_2d_tile_1d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_tile_1d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t tile_j,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_2d_tile_2d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_2d_tile_2d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_2d_tile_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t tile_i,
+		size_t tile_j,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽ִpthreadpool_parallelize_3d_tile_2d㡣μpthreadpool_run_plan_async
+	 */
+	pthreadpool_async_t pthreadpool_parallelize_3d_tile_2d_async(
+		pthreadpool_t threadpool,
+		pthreadpool_task_3d_tile_2d_t function,
+		void* context,
+		size_t range_i,
+		size_t range_j,
+		size_t range_k,
+		size_t tile_j,
+		size_t tile_k,
+		uint32_t flags,
+		pthreadpool_async_callback_t callback,
+		void* callback_context);
+
+	/**
+	 * 첽Ƿɣ̡߳
+	 *
+	 * @param async  Ҫ첽㡣
+	 *
+	 * @returns  ĿѴɻصѷأtrue򷵻false
+	 */
+	bool pthreadpool_test_async(pthreadpool_async_t async);
+
+	/**
+	 * ȴ첽ɣͷռõĲۡ
+	 *
+	 * ̴߳δ߳ȡĹȻȴ߳ɸȡĹ
+	 ʱĿѴϣɻصѷءɵļٴεô˺ء
+	 *
+	 * @note ͬһ첽㲻ͬʱڶ߳ϵȴ
+	 *
+	 * @param async  Ҫȴ첽㡣
+	 */
+	void pthreadpool_wait_async(pthreadpool_async_t async);
+
+	/**
+	 * ȴ첽ɣμpthreadpool_wait_asyncȻͷ첽
+	 *
+	 * @param async  Ҫٵ첽㡣asyncΪNULL˺ִκβ
+	 */
+	void pthreadpool_destroy_async(pthreadpool_async_t async);
+
+	/**
+	 * յͼ
+	 *
+	 * ͼĽڵִмƻǽڵ֮ϵpthreadpool_run_graph̳߳صһεдͼ
+	 ڵǰɺ̳߳е߳ʼýڵ㣬践ص̣߳Ҳٴλ̡߳
+	 ûϵĽڵͬʱͼԷִС
+	 *
+	 * @param threadpool  ڴͼ̳߳ءthreadpoolΪNULLͼڵ߳ϴд
+	 *
+	 * @returns  óɹָ͸ͼָ룻ڴʧܣNULLָ롣
+	 */
+	pthreadpool_graph_t pthreadpool_create_graph(pthreadpool_t threadpool);
+
+	/**
+	 * ͼӽڵ㡣
+	 *
+	 * @param graph  Ҫ޸ĵͼ
+	 * @param plan   ڵִеļƻʹͼ̳ͬ߳شͼƼƻƻͼ֮٣
+	 *    ÿִͼʱʹüƻĵǰݡ
+	 *
+	 * @returns  óɹؽڵ˳0ʼţƻ̳߳ͼͬڴʧܣSIZE_MAX
+	 */
+	size_t pthreadpool_add_graph_node(
+		pthreadpool_graph_t graph,
+		pthreadpool_plan_t plan);
+
+	/**
+	 * ͼϵsuccessorڵpredecessorڵĿ֮ſʼ
+	 *
+	 * ֻܴӵĽڵָӵĽڵ㣬ͼвڻ
+	 *
+	 * @param graph        Ҫ޸ĵͼ
+	 * @param predecessor  ɵĽڵ
+	 * @param successor    predecessorĽڵpredecessor
+	 *
+	 * @returns  óɹtrueЧڴʧܣfalse
+	 */
+	bool pthreadpool_add_graph_edge(
+		pthreadpool_graph_t graph,
+		size_t predecessor,
+		size_t successor);
+
+	/**
+	 * ִͼенڵ㣬ÿڵǰ֮ʼ
+	 *
+	 * ʱнڵĿѴϡڵԵpthreadpool_cancelȡýڵļ㣬
+	 ⲻӰڵ㡣
+	 *
+	 * @note ߳ʹִ̳ͬ߳ͼòлЩòִУ̳߳пе߳Эеá
+	 ͬһͼͬʱڶִ߳С
+	 *
+	 * @param graph  Ҫִеͼ
+	 */
+	void pthreadpool_run_graph(pthreadpool_graph_t graph);
+
+	/**
+	 * ͷͼͼ̳֮߳ǰ١ڵļƻᱻ١
+	 *
+	 * @param graph  ҪٵͼgraphΪNULL˺ִκβ
+	 */
+	void pthreadpool_destroy_graph(pthreadpool_graph_t graph);
+
+	/**
+	 * ˳ִһִмƻÿƻǰһƻĿ֮ʼ
+	 *
+	 * ƻ̳߳صһεд̳߳е߳ڼƻ֮ͨڲͬ践ص̣߳
+	 Ҳڼƻ֮˯ߺٴλѡϵΪеĶСںˣһ˷ͼ
+	 Ϊ̳߳شļƻԼڵ߳ϴдļƻ󵽴ϵ̴߳д
+	 *
+	 * @note ߳ʹִ̳ͬ߳òлЩòִУڱռõ̳߳زʹϣ
+	 ִмƻ
+	 *
+	 * @param threadpool   ڴƻ̳߳ءthreadpoolΪNULLмƻڵ߳ϴд
+	 * @param plans        Ҫִеļƻ顣
+	 * @param plans_count  plansеļƻ
+	 */
+	void pthreadpool_run_batch(
+		pthreadpool_t threadpool,
+		const pthreadpool_plan_t* plans,
+		size_t plans_count);
+
+	/**
+	 * SPMDݣʽִк̳߳еÿ߳ǡõһκ̱߳ź߳
+	 *
+	 * Եpthreadpool_barrier_wait㻮Ϊ׶Σ߳˽е״ֲ̬׶α
+	 ׶֮践ص̣߳Ҳٴηɡ
+	 *
+	 * ̳߳ΪNULLֻһ̣߳ߴͬһ̳߳صеô˺һ߳ʹø̳߳أ
+	 ֻһ߳ϵһΣ̱߳Ϊ0߳Ϊ1˺ݴֹ߳
+	 Ǽ߳pthreadpool_get_threads_countķֵ
+	 *
+	 * @param threadpool  ִк̳߳ءthreadpoolΪNULLڵִ߳С
+	 * @param function    ÿ߳Ҫõĺ
+	 * @param context     ݸĵһ
+	 * @param flags       һѡ־İλϣPTHREADPOOL_FLAG_DISABLE_DENORMALS  PTHREADPOOL_FLAG_YIELD_WORKERS
+	 */
+	void pthreadpool_run_spmd(
+		pthreadpool_t threadpool,
+		pthreadpool_task_spmd_t function,
+		void* context,
+		uint32_t flags);
+
+	/**
+	 * SPMḌ̶ֱ֮߳ͬ߳߳˴˺
+	 *
+	 * ϲ÷ת㷨Էʹáȴ߳Ȼ˯ߡֻһ̵߳SPMDУ
+	 ԼSPMD֮ʱ˺ء
+	 *
+	 * @warning ÿ̶߳ͬĴô˺Զɡ
+	 *
+	 * @param threadpool  ݸpthreadpool_run_spmd̳߳ء
+	 */
+	void pthreadpool_barrier_wait(pthreadpool_t threadpool);
+
+	/**
+	 * ֹ̳߳е̲߳ͷԴ
+	 *
+	 * @warning ڵô˺̳߳ؽδΪܵ𻵡
+	 *
+	 * @param[in,out]  threadpool  Ҫٵ̳߳ء
+	 */
+	void pthreadpool_destroy(pthreadpool_t threadpool);
+
+#ifndef PTHREADPOOL_NO_DEPRECATED_API
 
 	/* APIԤȴڵûݣ NNPACK */
 #if defined(__GNUC__)
@@ -1300,6 +2229,8 @@ extern "C" {
 
 #ifdef __cplusplus
 
+#include <type_traits>
+
 namespace libpthreadpool {
 	namespace detail {
 		namespace {
@@ -1313,6 +2244,29 @@ namespace libpthreadpool {
 				(*static_cast<const T*>(arg))(range_i, tile_i);
 			}
 
+			template<class T>
+			bool call_wrapper_1d_predicate(void* arg, size_t i) {
+				return (*static_cast<const T*>(arg))(i);
+			}
+
+			template<class Map, class Combine>
+			struct reduce_functors {
+				const Map* map;
+				const Combine* combine;
+			};
+
+			template<class T, class Map, class Combine>
+			void call_wrapper_1d_reduce(void* functors, void* accumulator, size_t start, size_t tile) {
+				(*static_cast<const reduce_functors<Map, Combine>*>(functors)->map)(
+					*static_cast<T*>(accumulator), start, tile);
+			}
+
+			template<class T, class Map, class Combine>
+			void call_wrapper_combine(void* functors, void* accumulator, const void* partial) {
+				(*static_cast<const reduce_functors<Map, Combine>*>(functors)->combine)(
+					*static_cast<T*>(accumulator), *static_cast<const T*>(partial));
+			}
+
 			template<class T>
 			void call_wrapper_2d(void* functor, size_t i, size_t j) {
 				(*static_cast<const T*>(functor))(i, j);
@@ -1432,7 +2386,7 @@ namespace libpthreadpool {
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1469,7 +2423,8 @@ inline void pthreadpool_parallelize_1d(
  * ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool,
- *    the calls are serialized.
+ *    the calls run concurrently, and idle threads of the pool help with all of
+ *    them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1497,6 +2452,151 @@ inline void pthreadpool_parallelize_1d_tile_1d(
 		flags);
 }
 
+/**
+ * Process items on a 1D grid, claiming several items per atomic operation.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i++)
+ *     functor(i);
+ *
+ * When the function returns, all items have been processed and the thread pool
+ * is ready for a new task.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls run concurrently, and idle threads of the pool help with all of them.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the functor to call for each item.
+ * @param range       the number of items on the 1D grid to process. The
+ *    specified functor will be called once for each item.
+ * @param grain       the maximum number of items a worker claims with one
+ *    atomic operation. Zero selects the grain from the range and the number of
+ *    threads.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ */
+template<class T>
+inline void pthreadpool_parallelize_1d_with_grain(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	size_t grain,
+	uint32_t flags = 0)
+{
+	pthreadpool_parallelize_1d_with_grain(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		grain,
+		flags);
+}
+
+/**
+ * Reduce items on a 1D grid in parallel.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   T result = identity;
+ *   for (size_t i = 0; i < range; i += tile)
+ *     map(result, i, min(range - i, tile));
+ *   return result;
+ *
+ * Every thread accumulates its items into a private copy of identity on its
+ * own cache line, and the partial results are combined pairwise on the worker
+ * threads. As items are distributed between threads dynamically, combine must
+ * be associative and commutative, and identity must be its neutral element.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls run concurrently, and idle threads of the pool help with all of them.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param identity    the initial value of every partial result. T must be
+ *    trivially copyable.
+ * @param map         the functor to call for each tile as map(accumulator,
+ *    start, tile), accumulating the items into the T& accumulator.
+ * @param combine     the functor to merge partial results as
+ *    combine(accumulator, partial), with T& accumulator and const T& partial.
+ * @param range       the number of items on the 1D grid to process.
+ * @param tile        the maximum number of items on the 1D grid to process in
+ *    one map call.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ *
+ * @returns the combined result of all items.
+ */
+template<class T, class Map, class Combine>
+inline T pthreadpool_parallelize_1d_reduce(
+	pthreadpool_t threadpool,
+	const T& identity,
+	const Map& map,
+	const Combine& combine,
+	size_t range,
+	size_t tile = 1,
+	uint32_t flags = 0)
+{
+	static_assert(std::is_trivially_copyable<T>::value,
+		"partial results are copied with memcpy");
+	const libpthreadpool::detail::reduce_functors<Map, Combine> functors = { &map, &combine };
+	T result = identity;
+	pthreadpool_parallelize_1d_reduce(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_reduce<T, Map, Combine>,
+		&libpthreadpool::detail::call_wrapper_combine<T, Map, Combine>,
+		const_cast<void*>(static_cast<const void*>(&functors)),
+		&identity,
+		&result,
+		sizeof(T),
+		range,
+		tile,
+		flags);
+	return result;
+}
+
+/**
+ * Find the first matching item on a 1D grid in parallel.
+ *
+ * The function implements a parallel version of the following snippet:
+ *
+ *   for (size_t i = 0; i < range; i++)
+ *     if (functor(i))
+ *       return i;
+ *   return range;
+ *
+ * Items after the first match are mostly skipped, but some of them may still be
+ * evaluated by other threads.
+ *
+ * @note If multiple threads call this function with the same thread pool, the
+ *    calls run concurrently, and idle threads of the pool help with all of them.
+ *
+ * @param threadpool  the thread pool to use for parallelisation. If threadpool
+ *    is NULL, all items are processed serially on the calling thread.
+ * @param functor     the predicate to call for each item, returning true for a
+ *    matching item.
+ * @param range       the number of items on the 1D grid to search.
+ * @param flags       a bitwise combination of zero or more optional flags
+ *    (PTHREADPOOL_FLAG_DISABLE_DENORMALS or PTHREADPOOL_FLAG_YIELD_WORKERS)
+ *
+ * @returns the index of the first matching item, or range if no item matches.
+ */
+template<class T>
+inline size_t pthreadpool_parallelize_1d_find_first(
+	pthreadpool_t threadpool,
+	const T& functor,
+	size_t range,
+	uint32_t flags = 0)
+{
+	return pthreadpool_parallelize_1d_find_first(
+		threadpool,
+		&libpthreadpool::detail::call_wrapper_1d_predicate<const T>,
+		const_cast<void*>(static_cast<const void*>(&functor)),
+		range,
+		flags);
+}
+
 /**
  * Process items on a 2D grid.
  *
@@ -1510,7 +2610,7 @@ inline void pthreadpool_parallelize_1d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1553,7 +2653,7 @@ inline void pthreadpool_parallelize_2d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1601,7 +2701,7 @@ inline void pthreadpool_parallelize_2d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1652,7 +2752,7 @@ inline void pthreadpool_parallelize_2d_tile_2d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1700,7 +2800,7 @@ inline void pthreadpool_parallelize_3d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1753,7 +2853,7 @@ inline void pthreadpool_parallelize_3d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1809,7 +2909,7 @@ inline void pthreadpool_parallelize_3d_tile_2d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1862,7 +2962,7 @@ inline void pthreadpool_parallelize_4d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1920,7 +3020,7 @@ inline void pthreadpool_parallelize_4d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -1981,7 +3081,7 @@ inline void pthreadpool_parallelize_4d_tile_2d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -2039,7 +3139,7 @@ inline void pthreadpool_parallelize_5d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -2102,7 +3202,7 @@ inline void pthreadpool_parallelize_5d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -2168,7 +3268,7 @@ inline void pthreadpool_parallelize_5d_tile_2d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -2233,7 +3333,7 @@ inline void pthreadpool_parallelize_6d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -2301,7 +3401,7 @@ inline void pthreadpool_parallelize_6d_tile_1d(
  * is ready for a new task.
  *
  * @note If multiple threads call this function with the same thread pool, the
- *    calls are serialized.
+ *    calls run concurrently, and idle threads of the pool help with all of them.
  *
  * @param threadpool  the thread pool to use for parallelisation. If threadpool
  *    is NULL, all items are processed serially on the calling thread.
@@ -10,8 +10,10 @@
 
 /* Mach headers */
 #include <dispatch/dispatch.h>
+#include <mach/mach_time.h>
 #include <sys/types.h>
 #include <sys/sysctl.h>
+#include <unistd.h>
 
 /* Public library header */
 #include <pthreadpool.h>
@@ -35,7 +37,7 @@ static void thread_main(void* arg, size_t thread_index) {
 		disable_fpu_denormals();
 	}
 
-	thread_function(threadpool, thread);
+	pthreadpool_run_thread_function(threadpool, thread_function, thread);
 
 	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 		set_fpu_state(saved_fpu_state);
@@ -62,18 +64,23 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		return NULL;
 	}
 	threadpool->threads_count = fxdiv_init_size_t(threads_count);
+	threadpool->urgent_pool = threadpool;
+	pthreadpool_set_spin_policy(threadpool, PTHREADPOOL_SPIN_POLICY_ADAPTIVE, PTHREADPOOL_SPIN_WAIT_MAX_NS);
+	pthreadpool_store_relaxed_size_t(&threadpool->barrier_waiting_threads, threads_count);
 	for (size_t tid = 0; tid < threads_count; tid++) {
 		threadpool->threads[tid].thread_number = tid;
+		threadpool->threads[tid].steal_seed = (uint32_t) (tid + 1) * UINT32_C(0x9E3779B9);
 	}
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
 	if (threads_count > 1) {
 		threadpool->execution_semaphore = dispatch_semaphore_create(1);
+		threadpool->helpers_group = dispatch_group_create();
 	}
 	return threadpool;
 }
 
-PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_with_ranges(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
 	const void* params,
@@ -81,6 +88,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	void* task,
 	void* context,
 	size_t linear_range,
+	const struct pthreadpool_range* ranges,
 	uint32_t flags)
 {
 	assert(threadpool != NULL);
@@ -89,7 +97,13 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(linear_range > 1);
 
 	/* Protect the global threadpool structures */
-	dispatch_semaphore_wait(threadpool->execution_semaphore, DISPATCH_TIME_FOREVER);
+	if (dispatch_semaphore_wait(threadpool->execution_semaphore, DISPATCH_TIME_NOW) != 0) {
+		/* Another thread runs a command on the thread pool: process this one as a concurrent job */
+		pthreadpool_parallelize_concurrently(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, ranges, flags);
+		return;
+	}
 
 	/* Setup global arguments */
 	pthreadpool_store_relaxed_void_p(&threadpool->thread_function, (void*) thread_function);
@@ -105,19 +119,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_partition_range(threadpool, linear_range, ranges, flags);
 
 	dispatch_apply_f(threads_count.value, DISPATCH_APPLY_AUTO, threadpool, thread_main);
 
@@ -125,8 +127,90 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	dispatch_semaphore_signal(threadpool->execution_semaphore);
 }
 
+static void help_job(void* arg) {
+	pthreadpool_help_job((struct pthreadpool_job_slot*) arg);
+}
+
+PTHREADPOOL_INTERNAL uint64_t pthreadpool_get_time_ns(void) {
+	mach_timebase_info_data_t timebase;
+	mach_timebase_info(&timebase);
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wake_helpers(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_job_slot* job_slot,
+	size_t helpers_count)
+{
+	/* Dispatch has no idle workers to wake up: submit one helper block per thread slot which a helper may take */
+	const dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+	const size_t blocks_count = min(helpers_count, threadpool->threads_count.value - 1);
+	for (size_t i = 0; i < blocks_count; i++) {
+		dispatch_group_async_f(threadpool->helpers_group, queue, job_slot, help_job);
+	}
+}
+
+/*
+ * Dispatch may run the threads of a command one after another, so SPMD computations run on a single thread, which
+ * never waits at the barrier. These functions only keep the barrier consistent with the other backends.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_wait_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	while (pthreadpool_load_acquire_uint32_t(&threadpool->barrier_sense) == sense) {
+		pthreadpool_yield();
+	}
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_release_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	pthreadpool_store_release_uint32_t(&threadpool->barrier_sense, sense);
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wait_for_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address,
+	uint32_t value,
+	uint32_t flags)
+{
+	/* Spin-wait */
+	if ((flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
+		const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+		for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
+			if (pthreadpool_load_acquire_uint32_t(address) != value) {
+				return;
+			}
+			pthreadpool_yield();
+		}
+	}
+
+	/* Fall-back to sleeping between checks: the counter has no dispatch object to wait on */
+	while (pthreadpool_load_acquire_uint32_t(address) == value) {
+		usleep(100);
+	}
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_notify_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address)
+{
+	/* Waiting threads poll the counter, so only the thread which completes a change advances it: no wake-up needed */
+	(void) threadpool;
+	pthreadpool_fence_release();
+	uint32_t value = pthreadpool_load_relaxed_uint32_t(address);
+	while (!pthreadpool_compare_exchange_weak_relaxed_uint32_t(address, &value, value + 2));
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 	if (threadpool != NULL) {
+		if (threadpool->helpers_group != NULL) {
+			/* Helper blocks of asynchronous jobs reference the job slots of the thread pool */
+			dispatch_group_wait(threadpool->helpers_group, DISPATCH_TIME_FOREVER);
+			dispatch_release(threadpool->helpers_group);
+		}
 		if (threadpool->execution_semaphore != NULL) {
 			/* Release resources */
 			dispatch_release(threadpool->execution_semaphore);
@@ -21,6 +21,20 @@
 #include "threadpool-utils.h"
 
 
+/* Thread of the command which the calling system thread processes, or NULL outside of thread pool commands */
+static PTHREADPOOL_THREAD_LOCAL struct thread_info* current_thread = NULL;
+/* Job which the calling system thread processes, or NULL outside of nested and concurrent jobs */
+static PTHREADPOOL_THREAD_LOCAL struct pthreadpool* current_job = NULL;
+/* Thread pool whose SPMD computation the calling system thread runs on multiple threads, or NULL */
+static PTHREADPOOL_THREAD_LOCAL struct pthreadpool* current_spmd = NULL;
+
+/* Returns true if the calling system thread processes a command of the thread pool, i.e. runs one of its tasks */
+static inline bool is_nested_call(const struct pthreadpool* threadpool) {
+	const struct thread_info* thread = current_thread;
+	return thread != NULL && thread->thread_number < threadpool->threads_count.value &&
+		&threadpool->threads[thread->thread_number] == thread;
+}
+
 size_t pthreadpool_get_threads_count(struct pthreadpool* threadpool) {
 	if (threadpool == NULL) {
 		return 1;
@@ -29,1611 +43,2550 @@ size_t pthreadpool_get_threads_count(struct pthreadpool* threadpool) {
 	return threadpool->threads_count.value;
 }
 
-static void thread_parallelize_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
-
-	const pthreadpool_task_1d_t task = (pthreadpool_task_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
-
-	/* Process thread's own range of items */
-	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, range_start++);
+void pthreadpool_set_topology(
+	struct pthreadpool* threadpool,
+	const uint32_t* cache_domains,
+	const uint32_t* numa_domains)
+{
+	if (threadpool == NULL) {
+		return;
 	}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			task(argument, index);
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		if (cache_domains != NULL) {
+			threadpool->threads[tid].cache_domain = cache_domains[tid];
+		}
+		if (numa_domains != NULL) {
+			threadpool->threads[tid].numa_domain = numa_domains[tid];
 		}
 	}
-
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+void pthreadpool_set_thread_weights(
+	struct pthreadpool* threadpool,
+	const uint32_t* weights)
+{
+	if (threadpool == NULL) {
+		return;
+	}
 
-	const pthreadpool_task_1d_with_thread_t task = (pthreadpool_task_1d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		threadpool->threads[tid].weight = weights != NULL ? weights[tid] : 0;
+	}
+}
 
-	const size_t thread_number = thread->thread_number;
-	/* Process thread's own range of items */
-	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, thread_number, range_start++);
+void pthreadpool_get_thread_weights(
+	struct pthreadpool* threadpool,
+	uint32_t* weights)
+{
+	if (threadpool == NULL) {
+		weights[0] = 0;
+		return;
 	}
 
-	/* There still may be other threads with work */
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			task(argument, thread_number, index);
-		}
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		weights[tid] = threadpool->threads[tid].weight;
 	}
-
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+void pthreadpool_set_spin_policy(
+	struct pthreadpool* threadpool,
+	uint32_t policy,
+	uint64_t max_spin_ns)
+{
+	if (threadpool == NULL || threadpool->team_threadpool != NULL) {
+		return;
+	}
 
-	const pthreadpool_task_1d_with_id_t task = (pthreadpool_task_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	const size_t spin_ns = max_spin_ns < (uint64_t) SIZE_MAX ? (size_t) max_spin_ns : SIZE_MAX;
+	threadpool->spin_policy = policy;
+	pthreadpool_store_relaxed_size_t(&threadpool->max_spin_ns, spin_ns);
+	/* Until the gaps between commands are known, assume that spinning pays off */
+	pthreadpool_store_relaxed_size_t(&threadpool->spin_wait_ns, spin_ns);
+	threadpool->last_command_end_ns = 0;
+	threadpool->short_gap_ns = 0.5 * (double) spin_ns;
+	threadpool->short_gap_rate = 1.0;
+}
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_1d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_1d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+uint64_t pthreadpool_get_spin_wait_ns(struct pthreadpool* threadpool) {
+	if (threadpool == NULL) {
+		return 0;
+	}
+	if (threadpool->team_threadpool != NULL) {
+		threadpool = threadpool->team_threadpool;
+	}
+	return (uint64_t) pthreadpool_load_relaxed_size_t(&threadpool->spin_wait_ns);
+}
 
-	/* Process thread's own range of items */
-	size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, range_start++);
+PTHREADPOOL_INTERNAL void pthreadpool_learn_spin_wait(struct pthreadpool* threadpool) {
+	if (threadpool->spin_policy != PTHREADPOOL_SPIN_POLICY_ADAPTIVE || threadpool->last_command_end_ns == 0) {
+		return;
 	}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			task(argument, uarch_index, index);
-		}
+	const size_t max_spin_ns = pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	const uint64_t gap_ns = pthreadpool_get_time_ns() - threadpool->last_command_end_ns;
+	/* Exponential moving averages, so that the spin-wait follows changes in how often commands come */
+	const bool short_gap = gap_ns <= (uint64_t) max_spin_ns;
+	threadpool->short_gap_rate = 0.75 * threadpool->short_gap_rate + (short_gap ? 0.25 : 0.0);
+	if (short_gap) {
+		threadpool->short_gap_ns = 0.75 * threadpool->short_gap_ns + 0.25 * (double) gap_ns;
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	/*
+	 * Spinning pays off if the next command likely comes before the spin-wait ends. Then spin for twice the typical gap,
+	 * to cover its variation. Otherwise, spin only briefly before going to sleep.
+	 */
+	double spin_ns = (double) PTHREADPOOL_SPIN_WAIT_MIN_NS;
+	if (threadpool->short_gap_rate >= 0.5 && 2.0 * threadpool->short_gap_ns > spin_ns) {
+		spin_ns = 2.0 * threadpool->short_gap_ns;
+	}
+	pthreadpool_store_relaxed_size_t(&threadpool->spin_wait_ns, spin_ns < (double) max_spin_ns ? (size_t) spin_ns : max_spin_ns);
 }
 
-static void thread_parallelize_1d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
-
-	const pthreadpool_task_1d_tile_1d_t task = (pthreadpool_task_1d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+PTHREADPOOL_INTERNAL void pthreadpool_complete_spin_wait(struct pthreadpool* threadpool) {
+	if (threadpool->spin_policy == PTHREADPOOL_SPIN_POLICY_ADAPTIVE) {
+		threadpool->last_command_end_ns = pthreadpool_get_time_ns();
+	}
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const size_t tile = threadpool->params.parallelize_1d_tile_1d.tile;
-	size_t tile_start = range_start * tile;
+/* Makes the threads [first_thread, first_thread + threads_count) of the thread pool look for jobs of the team */
+static void assign_team_threads(struct pthreadpool* team, size_t first_thread, size_t threads_count) {
+	struct pthreadpool* threadpool = team->team_threadpool;
+	team->team_slot = &threadpool->threads[first_thread].team_slot;
+	for (size_t tid = first_thread; tid < first_thread + threads_count; tid++) {
+		pthreadpool_store_relaxed_void_p(&threadpool->threads[tid].team_job_slot, (void*) team->team_slot);
+	}
 
-	const size_t range = threadpool->params.parallelize_1d_tile_1d.range;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, tile_start, min(range - tile_start, tile));
-		tile_start += tile;
+	/* Thread 0 of the thread pool has no system thread: the thread which calls the team takes its place */
+	const size_t team_threads_count = first_thread == 0 ? threads_count : threads_count + 1;
+	team->threads_count = fxdiv_init_size_t(team_threads_count);
+	for (size_t tid = 0; tid < team_threads_count; tid++) {
+		team->threads[tid].thread_number = tid;
+		team->threads[tid].threadpool = team;
+		team->threads[tid].weight = 0;
 	}
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
+/* Detaches the threads of the thread pool which belong to the team from it */
+static void release_team_threads(struct pthreadpool* team) {
+	struct pthreadpool* threadpool = team->team_threadpool;
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t tile_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const size_t tile_start = tile_index * tile;
-			task(argument, tile_start, min(range - tile_start, tile));
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		if (pthreadpool_load_relaxed_void_p(&thread->team_job_slot) == (void*) team->team_slot) {
+			pthreadpool_store_relaxed_void_p(&thread->team_job_slot, NULL);
 		}
 	}
-
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
-
-	const pthreadpool_task_2d_t task = (pthreadpool_task_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+static inline bool is_valid_team_range(struct pthreadpool* threadpool, size_t first_thread, size_t threads_count) {
+	const size_t pool_threads_count = threadpool->threads_count.value;
+	return threads_count != 0 && first_thread < pool_threads_count && threads_count <= pool_threads_count - first_thread;
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(range_start, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
+struct pthreadpool* pthreadpool_create_team(
+	struct pthreadpool* threadpool,
+	size_t first_thread,
+	size_t threads_count)
+{
+	if (threadpool == NULL || threadpool->team_threadpool != NULL ||
+		!is_valid_team_range(threadpool, first_thread, threads_count))
+	{
+		return NULL;
+	}
 
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j);
-		if (++j == range_j.value) {
-			j = 0;
-			i += 1;
-		}
+	/* Repartitioning may grow the team up to the whole thread pool */
+	struct pthreadpool* team = pthreadpool_allocate(threadpool->threads_count.value);
+	if (team == NULL) {
+		return NULL;
 	}
+	team->team_threadpool = threadpool;
+	team->urgent_pool = threadpool;
+	for (size_t tid = 0; tid < threadpool->threads_count.value; tid++) {
+		team->threads[tid].steal_seed = (uint32_t) (tid + 1) * UINT32_C(0x9E3779B9);
+	}
+	assign_team_threads(team, first_thread, threads_count);
+	return team;
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+bool pthreadpool_set_team_threads(
+	struct pthreadpool* team,
+	size_t first_thread,
+	size_t threads_count)
+{
+	if (team == NULL || team->team_threadpool == NULL ||
+		!is_valid_team_range(team->team_threadpool, first_thread, threads_count))
 	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(linear_index, range_j);
-			task(argument, index_i_j.quotient, index_i_j.remainder);
-		}
+		return false;
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	release_team_threads(team);
+	assign_team_threads(team, first_thread, threads_count);
+	return true;
 }
 
-static void thread_parallelize_2d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+void pthreadpool_destroy_team(struct pthreadpool* team) {
+	if (team == NULL) {
+		return;
+	}
 
-	const pthreadpool_task_2d_with_thread_t task = (pthreadpool_task_2d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	release_team_threads(team);
+	pthreadpool_deallocate(team);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(range_start, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
+/*
+ * Replaces range_length with a read-modify-write operation. Unlike a plain store, it can't overwrite the zero written by
+ * a concurrent pthreadpool_cancel without observing it: either the update happens first and cancellation zeroes it, or
+ * the update reads the zero, and the acquire fence after it makes the cancelled flag visible.
+ */
+static inline void exchange_range_length(struct thread_info* thread, size_t range_length) {
+	size_t old_range_length = pthreadpool_load_relaxed_size_t(&thread->range_length);
+	while (!pthreadpool_compare_exchange_weak_relaxed_size_t(&thread->range_length, &old_range_length, range_length));
+}
 
-	const size_t thread_number = thread->thread_number;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, thread_number, i, j);
-		if (++j == range_j.value) {
-			j = 0;
-			i += 1;
-		}
+void pthreadpool_cancel(
+	struct pthreadpool* threadpool)
+{
+	if (threadpool == NULL) {
+		return;
 	}
 
-	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(linear_index, range_j);
-			task(argument, thread_number, index_i_j.quotient, index_i_j.remainder);
-		}
+	/* A task of a nested or concurrent job cancels only the job */
+	if (current_job != NULL && current_job->parent == threadpool) {
+		threadpool = current_job;
 	}
 
-	/* Make changes by this thread visible to other threads */
+	pthreadpool_store_relaxed_uint32_t(&threadpool->cancelled, 1);
 	pthreadpool_fence_release();
-}
 
-static void thread_parallelize_2d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+	/* Zero all remaining ranges, so that threads stop claiming and stealing items */
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		exchange_range_length(&threadpool->threads[tid], 0);
+	}
+}
 
-	const pthreadpool_task_2d_tile_1d_t task = (pthreadpool_task_2d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+/* Learned weights are normalized so that a thread with average throughput has this weight */
+#define PTHREADPOOL_LEARNED_WEIGHT_UNIT 1024
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d.tile_j;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
+static void learn_thread_weights(struct pthreadpool* threadpool) {
+	struct thread_info* threads = threadpool->threads;
+	const size_t threads_count = threadpool->threads_count.value;
 
-	const size_t range_j = threadpool->params.parallelize_2d_tile_1d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, start_j, min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			i += 1;
-		}
+	uint64_t processed_items_sum = 0;
+	uint64_t weights_sum = 0;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		processed_items_sum += threads[tid].processed_items;
+		weights_sum += threads[tid].weight;
+	}
+	if (processed_items_sum == 0) {
+		/* No statistics from a previous command */
+		return;
 	}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
-		}
+	/*
+	 * With work stealing all threads stay busy until the end of a command, so the share of items a thread processed
+	 * approximates its share of the pool throughput. Blend it into the current weights with an exponential moving
+	 * average to smooth out noise of individual commands.
+	 */
+	const double scale = (double) threads_count * (double) PTHREADPOOL_LEARNED_WEIGHT_UNIT;
+	for (size_t tid = 0; tid < threads_count; tid++) {
+		const double current_weight = weights_sum == 0 ?
+			(double) PTHREADPOOL_LEARNED_WEIGHT_UNIT : (double) threads[tid].weight * scale / (double) weights_sum;
+		const double measured_weight = (double) threads[tid].processed_items * scale / (double) processed_items_sum;
+		const uint32_t weight = (uint32_t) (0.75 * current_weight + 0.25 * measured_weight + 0.5);
+		threads[tid].weight = weight != 0 ? weight : 1;
 	}
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+/*
+ * End of the initial range of thread tid, given the sum of weights of threads [0, tid]. Threads with uniform weights
+ * split the range evenly, otherwise it is cut at points proportional to the prefix sums of weights.
+ */
+static inline size_t initial_range_end(
+	size_t tid,
+	size_t threads_count,
+	size_t linear_range,
+	bool uniform_weights,
+	struct fxdiv_result_size_t even_split,
+	uint64_t weights_prefix_sum,
+	uint64_t weights_sum)
+{
+	if (uniform_weights) {
+		return (tid + 1) * even_split.quotient + min(tid + 1, even_split.remainder);
+	} else if (tid + 1 == threads_count) {
+		/* The last thread takes the rest, whatever the rounding */
+		return linear_range;
+	} else {
+		return (size_t) ((double) linear_range * ((double) weights_prefix_sum / (double) weights_sum));
+	}
 }
 
-static void thread_parallelize_2d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+/*
+ * Splits the linear range between the first threads_count threads of the thread pool. The ranges of the other threads
+ * are empty.
+ */
+static void compute_initial_ranges(
+	struct pthreadpool* threadpool,
+	struct fxdiv_divisor_size_t threads_count,
+	size_t linear_range,
+	struct pthreadpool_range* ranges)
+{
+	struct thread_info* threads = threadpool->threads;
 
-	const pthreadpool_task_2d_tile_1d_with_id_t task = (pthreadpool_task_2d_tile_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	uint64_t weights_sum = 0;
+	bool uniform_weights = true;
+	for (size_t tid = 0; tid < threads_count.value; tid++) {
+		weights_sum += threads[tid].weight;
+		uniform_weights &= threads[tid].weight == threads[0].weight;
+	}
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_1d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_2d_tile_1d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+	const struct fxdiv_result_size_t even_split = fxdiv_divide_size_t(linear_range, threads_count);
+	uint64_t weights_prefix_sum = 0;
+	size_t range_start = 0;
+	for (size_t tid = 0; tid < threads_count.value; tid++) {
+		weights_prefix_sum += threads[tid].weight;
+		const size_t range_end = min(max(
+			initial_range_end(tid, threads_count.value, linear_range, uniform_weights, even_split, weights_prefix_sum, weights_sum),
+			range_start), linear_range);
+		ranges[tid].start = range_start;
+		ranges[tid].end = range_end;
+
+		/* The next subrange starts where the previous ended */
+		range_start = range_end;
+	}
+	for (size_t tid = threads_count.value; tid < threadpool->threads_count.value; tid++) {
+		ranges[tid].start = linear_range;
+		ranges[tid].end = linear_range;
+	}
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_j;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
+PTHREADPOOL_INTERNAL void pthreadpool_partition_range(
+	struct pthreadpool* threadpool,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags)
+{
+	struct thread_info* threads = threadpool->threads;
+	const struct fxdiv_divisor_size_t threads_count = threadpool->threads_count;
+
+	const bool cancelled = pthreadpool_load_relaxed_uint32_t(&threadpool->cancelled) != 0;
+	pthreadpool_store_relaxed_uint32_t(&threadpool->cancelled, 0);
+
+	if (ranges != NULL) {
+		/* Ranges precomputed by a plan */
+		for (size_t tid = 0; tid < threads_count.value; tid++) {
+			struct thread_info* thread = &threads[tid];
+			pthreadpool_store_relaxed_size_t(&thread->range_start, ranges[tid].start);
+			pthreadpool_store_relaxed_size_t(&thread->range_end, ranges[tid].end);
+			pthreadpool_store_relaxed_size_t(&thread->range_length, ranges[tid].end - ranges[tid].start);
+			thread->processed_items = 0;
+			pthreadpool_store_relaxed_uint32_t(&thread->out_of_work, 0);
+		}
+		return;
+	}
 
-	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, start_j, min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			i += 1;
-		}
+	/* Threads of a cancelled command stopped early, so their statistics don't reflect their throughput */
+	if ((flags & PTHREADPOOL_FLAG_LEARN_WEIGHTS) && !cancelled) {
+		learn_thread_weights(threadpool);
 	}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, uarch_index, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
-		}
+	uint64_t weights_sum = 0;
+	bool uniform_weights = true;
+	for (size_t tid = 0; tid < threads_count.value; tid++) {
+		weights_sum += threads[tid].weight;
+		uniform_weights &= threads[tid].weight == threads[0].weight;
+		threads[tid].processed_items = 0;
+		pthreadpool_store_relaxed_uint32_t(&threads[tid].out_of_work, 0);
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	const struct fxdiv_result_size_t even_split = fxdiv_divide_size_t(linear_range, threads_count);
+	uint64_t weights_prefix_sum = 0;
+	size_t range_start = 0;
+	for (size_t tid = 0; tid < threads_count.value; tid++) {
+		struct thread_info* thread = &threads[tid];
+		weights_prefix_sum += thread->weight;
+		const size_t range_end = min(max(
+			initial_range_end(tid, threads_count.value, linear_range, uniform_weights, even_split, weights_prefix_sum, weights_sum),
+			range_start), linear_range);
+		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
+		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
+		pthreadpool_store_relaxed_size_t(&thread->range_length, range_end - range_start);
+
+		/* The next subrange starts where the previous ended */
+		range_start = range_end;
+	}
 }
 
-static void thread_parallelize_2d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+PTHREADPOOL_INTERNAL void pthreadpool_run_thread_function(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	struct thread_info* thread)
+{
+	struct thread_info* saved_thread = current_thread;
+	struct pthreadpool* saved_job = current_job;
+	current_thread = thread;
+	current_job = NULL;
 
-	const pthreadpool_task_2d_tile_1d_with_id_with_thread_t task =
-		(pthreadpool_task_2d_tile_1d_with_id_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	thread_function(threadpool, thread);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_1d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_2d_tile_1d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+	current_thread = saved_thread;
+	current_job = saved_job;
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_j;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
+/* Runs the thread function of a job for one of its thread slots */
+static void run_job_slot(struct pthreadpool* job, size_t slot) {
+	const thread_function_t thread_function =
+		(thread_function_t) pthreadpool_load_relaxed_void_p(&job->thread_function);
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&job->flags);
+
+	struct pthreadpool* saved_job = current_job;
+	current_job = job;
+	struct fpu_state saved_fpu_state = { 0 };
+	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+		saved_fpu_state = get_fpu_state();
+		disable_fpu_denormals();
+	}
 
-	const size_t thread_number = thread->thread_number;
-	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, thread_number, i, start_j, min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			i += 1;
+	thread_function(job, &job->threads[slot]);
+
+	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+		set_fpu_state(saved_fpu_state);
+	}
+	current_job = saved_job;
+
+	struct pthreadpool_async* async = job->async;
+	if (async != NULL) {
+		/* The thread which processes the last thread slot completes the asynchronous computation */
+		if (pthreadpool_decrement_fetch_acquire_release_size_t(&async->pending_slots) == 0) {
+			if (async->callback != NULL) {
+				async->callback(async->callback_context);
+			}
+			pthreadpool_store_release_uint32_t(&async->completed, 1);
 		}
 	}
+}
 
-	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, uarch_index, thread_number, tile_index_i_j.quotient, start_j, min(range_j - start_j, tile_j));
+/* Takes the next of slots_count slots counted by claimed_slots, or returns slots_count if all slots are taken */
+static inline size_t claim_slot(pthreadpool_atomic_size_t* claimed_slots, size_t slots_count) {
+	size_t slot = pthreadpool_load_relaxed_size_t(claimed_slots);
+	while (slot < slots_count) {
+		if (pthreadpool_compare_exchange_weak_relaxed_size_t(claimed_slots, &slot, slot + 1)) {
+			break;
 		}
 	}
+	return min(slot, slots_count);
+}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+/* Returns the thread pool whose threads process the jobs of a thread pool or a team */
+static inline struct pthreadpool* get_workers_threadpool(struct pthreadpool* threadpool) {
+	return threadpool->team_threadpool != NULL ? threadpool->team_threadpool : threadpool;
 }
 
-static void thread_parallelize_2d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+/* Takes the next free thread slot of a job, or returns threads_count if all slots are taken */
+static inline size_t claim_job_slot(struct pthreadpool* job) {
+	return claim_slot(&job->job_slots, job->threads_count.value);
+}
 
-	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+/*
+ * Joins the job published in the slot, if any, and processes one of its thread slots.
+ * Returns true if the calling thread processed a thread slot.
+ */
+static bool join_job(struct pthreadpool_job_slot* job_slot) {
+	size_t state = pthreadpool_load_relaxed_size_t(&job_slot->state);
+	while (state & 1) {
+		if (pthreadpool_compare_exchange_weak_relaxed_size_t(&job_slot->state, &state, state + 2)) {
+			/* The owner can't release the job until we leave */
+			pthreadpool_fence_acquire();
+			struct pthreadpool* job = (struct pthreadpool*) pthreadpool_load_relaxed_void_p(&job_slot->job);
+			const size_t slot = claim_job_slot(job);
+			const bool joined = slot < job->threads_count.value;
+			if (joined) {
+				run_job_slot(job, slot);
+			}
+			/* The job may be released as soon as we leave, but the thread pool outlives its workers */
+			struct pthreadpool* workers_threadpool = get_workers_threadpool(job->parent);
+			pthreadpool_fence_release();
+			if (pthreadpool_subtract_fetch_relaxed_size_t(&job_slot->state, 2) == 2) {
+				/* The last helper left a job which stopped accepting helpers: wake up its owner */
+				pthreadpool_notify_change(workers_threadpool, &job_slot->departures);
+			}
+			return joined;
+		}
+	}
+	return false;
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d.tile_i;
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d.tile_j;
-	size_t start_i = tile_index_i_j.quotient * tile_i;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
+PTHREADPOOL_INTERNAL bool pthreadpool_help_job(struct pthreadpool_job_slot* job_slot) {
+	return join_job(job_slot);
+}
 
-	const size_t range_i = threadpool->params.parallelize_2d_tile_2d.range_i;
-	const size_t range_j = threadpool->params.parallelize_2d_tile_2d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			start_i += tile_i;
-		}
+/* Makes one pass over the job slots of the thread pool, and helps with the first job which accepts helpers */
+static bool join_any_job(struct pthreadpool* threadpool, struct thread_info* thread, bool* all_out_of_work) {
+	/* Threads of a team help with the computations of the team first */
+	struct pthreadpool_job_slot* team_job_slot =
+		(struct pthreadpool_job_slot*) pthreadpool_load_relaxed_void_p(&thread->team_job_slot);
+	if (team_job_slot != NULL && join_job(team_job_slot)) {
+		return true;
 	}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
+	size_t tid = thread->thread_number;
+	for (size_t i = threads_count - 1; i != 0; i--) {
+		tid = modulo_decrement(tid, threads_count);
 		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_i = tile_index_i_j.quotient * tile_i;
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+		if (join_job(&other_thread->nested_slot)) {
+			return true;
 		}
+		*all_out_of_work &= pthreadpool_load_relaxed_uint32_t(&other_thread->out_of_work) != 0;
 	}
-
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	for (size_t i = 0; i < PTHREADPOOL_CONCURRENT_JOB_SLOTS; i++) {
+		if (join_job(&threadpool->concurrent_slots[i])) {
+			return true;
+		}
+	}
+	return false;
 }
 
-static void thread_parallelize_2d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+PTHREADPOOL_INTERNAL bool pthreadpool_help_jobs(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	if (pthreadpool_load_relaxed_uint32_t(&threadpool->has_jobs) == 0) {
+		return false;
+	}
 
-	const pthreadpool_task_2d_tile_2d_with_id_t task = (pthreadpool_task_2d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+	/* Calls from the tasks of the job to the thread pool are nested calls of this thread */
+	struct thread_info* saved_thread = current_thread;
+	current_thread = thread;
+	bool all_out_of_work = true;
+	const bool helped = join_any_job(threadpool, thread, &all_out_of_work);
+	current_thread = saved_thread;
+	return helped;
+}
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_2d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_2d_tile_2d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
+/*
+ * Called when the thread ran out of work in a command of a thread pool which ran jobs. Helps with published jobs until
+ * all threads ran out of work, the spin-wait budget is exhausted, or, with PTHREADPOOL_FLAG_YIELD_WORKERS, no job is
+ * immediately available.
+ */
+static void help_jobs_until_command_completes(struct pthreadpool* threadpool, struct thread_info* thread, uint32_t flags) {
+	#if PTHREADPOOL_USE_GCD
+		/* Dispatch may run the threads of a command one after another: waiting for other threads could stall it */
+		const bool linger = false;
+	#else
+		const bool linger = (flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0;
 	#endif
-
-	/* Process thread's own range of items */
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_range_j;
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_result_size_t index = fxdiv_divide_size_t(range_start, tile_range_j);
-	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_i;
-	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_i;
-	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_j;
-	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_j;
-	size_t start_i = index.quotient * tile_i;
-	size_t start_j = index.remainder * tile_j;
-
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
-		start_j += tile_j;
-		if (start_j >= range_j) {
-			start_j = 0;
-			start_i += tile_i;
-		}
+	const size_t max_spin_ns = pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	uint64_t spin_deadline = pthreadpool_get_time_ns() + max_spin_ns;
+	for (uint32_t i = 0; ; i++) {
+		bool all_out_of_work = true;
+		if (join_any_job(threadpool, thread, &all_out_of_work)) {
+			spin_deadline = pthreadpool_get_time_ns() + max_spin_ns;
+			continue;
+		}
+		if (all_out_of_work || !linger || !pthreadpool_keep_spinning(i, spin_deadline)) {
+			return;
+		}
+		pthreadpool_yield();
 	}
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(linear_index, tile_range_j);
-			const size_t start_i = tile_index_i_j.quotient * tile_i;
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+/*
+ * Runs urgent jobs until none of them accepts more helpers. Threads of a team look at the job slot of the team too,
+ * where the high-priority computations of the team are published.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_run_urgent_jobs(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	struct pthreadpool* urgent_pool = threadpool->urgent_pool;
+	thread->urgent_epoch = pthreadpool_load_relaxed_size_t(&urgent_pool->urgent_epoch);
+	/* Jobs are published before the epoch changes */
+	pthreadpool_fence_acquire();
+
+	struct pthreadpool_job_slot* team_job_slot = NULL;
+	if (current_thread != NULL) {
+		team_job_slot = (struct pthreadpool_job_slot*) pthreadpool_load_relaxed_void_p(&current_thread->team_job_slot);
+	}
+	bool helped;
+	do {
+		helped = false;
+		if (team_job_slot != NULL && pthreadpool_load_relaxed_uint32_t(&team_job_slot->urgent) != 0) {
+			helped |= join_job(team_job_slot);
+		}
+		for (size_t i = 0; i < PTHREADPOOL_CONCURRENT_JOB_SLOTS; i++) {
+			struct pthreadpool_job_slot* job_slot = &urgent_pool->concurrent_slots[i];
+			if (pthreadpool_load_relaxed_uint32_t(&job_slot->urgent) != 0) {
+				helped |= join_job(job_slot);
+			}
 		}
+	} while (helped);
+}
+
+/* Initializes the private pool structure of a job with the arguments of a parallelization function */
+static void init_job(
+	struct pthreadpool* job,
+	struct pthreadpool* threadpool,
+	struct fxdiv_divisor_size_t threads_count,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags)
+{
+	/* Jobs of a team are processed by the threads of the thread pool which the team is part of */
+	struct pthreadpool* workers_threadpool = get_workers_threadpool(threadpool);
+	if (pthreadpool_load_relaxed_uint32_t(&workers_threadpool->has_jobs) == 0) {
+		pthreadpool_store_relaxed_uint32_t(&workers_threadpool->has_jobs, 1);
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	/* Learning weights needs a persistent thread pool, and the static schedule would leave unjoined slots unprocessed */
+	flags &= ~(PTHREADPOOL_FLAG_LEARN_WEIGHTS | PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+	job->threads_count = threads_count;
+	job->parent = threadpool;
+	/* High-priority jobs are never preempted */
+	job->urgent_pool = (flags & PTHREADPOOL_FLAG_HIGH_PRIORITY) ? NULL : threadpool->urgent_pool;
+	const size_t urgent_epoch = pthreadpool_load_relaxed_size_t(&workers_threadpool->urgent_epoch);
+	for (size_t tid = 0; tid < threads_count.value; tid++) {
+		job->threads[tid].thread_number = tid;
+		job->threads[tid].threadpool = job;
+		job->threads[tid].steal_seed = (uint32_t) (tid + 1) * UINT32_C(0x9E3779B9);
+		job->threads[tid].urgent_epoch = urgent_epoch;
+	}
+	pthreadpool_store_relaxed_void_p(&job->thread_function, (void*) thread_function);
+	pthreadpool_store_relaxed_void_p(&job->task, task);
+	pthreadpool_store_relaxed_void_p(&job->argument, context);
+	pthreadpool_store_relaxed_uint32_t(&job->flags, flags);
+	if (params_size != 0) {
+		memcpy(&job->params, params, params_size);
+	}
+	pthreadpool_partition_range(job, linear_range, ranges, flags);
 }
 
-static void thread_parallelize_3d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+/*
+ * Returns the job slots where jobs submitted to the thread pool from outside of its tasks are published, and their
+ * number. Computations of a team go to the job slot of the team, which only the threads of the team look at.
+ */
+static struct pthreadpool_job_slot* get_concurrent_slots(struct pthreadpool* threadpool, size_t* job_slots_count) {
+	if (threadpool->team_threadpool != NULL) {
+		*job_slots_count = 1;
+		return threadpool->team_slot;
+	}
+	*job_slots_count = PTHREADPOOL_CONCURRENT_JOB_SLOTS;
+	return threadpool->concurrent_slots;
+}
 
-	const pthreadpool_task_3d_t task = (pthreadpool_task_3d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+/*
+ * Wakes up as many sleeping workers as the job published in the job slot has thread slots for helpers. The jobs of a
+ * team wake up only the threads of the team, which are the only threads to look at the job slot of the team.
+ */
+static void wake_job_helpers(struct pthreadpool* threadpool, struct pthreadpool_job_slot* job_slot, size_t helpers_count) {
+	pthreadpool_wake_helpers(get_workers_threadpool(threadpool), job_slot, helpers_count);
+}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_3d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(range_start, range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k);
-		if (++k == range_k.value) {
-			k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
+/* Reserves a free job slot and publishes the job in it. Returns NULL if all job slots are taken. */
+static struct pthreadpool_job_slot* publish_job(
+	struct pthreadpool_job_slot* job_slots,
+	size_t job_slots_count,
+	struct pthreadpool* job)
+{
+	for (size_t i = 0; i < job_slots_count; i++) {
+		size_t state = 0;
+		while (!pthreadpool_compare_exchange_weak_relaxed_size_t(&job_slots[i].state, &state, 2) && state == 0);
+		if (state == 0) {
+			const bool urgent = (pthreadpool_load_relaxed_uint32_t(&job->flags) & PTHREADPOOL_FLAG_HIGH_PRIORITY) != 0;
+			pthreadpool_store_relaxed_void_p(&job_slots[i].job, job);
+			pthreadpool_store_relaxed_uint32_t(&job_slots[i].urgent, (uint32_t) urgent);
+			pthreadpool_store_release_size_t(&job_slots[i].state, 3);
+			if (urgent) {
+				/* Tell the threads busy with other computations to look for the job between items */
+				pthreadpool_fence_release();
+				pthreadpool_increment_fetch_relaxed_size_t(&get_workers_threadpool(job->parent)->urgent_epoch);
 			}
+			return &job_slots[i];
 		}
 	}
+	return NULL;
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(linear_index, range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder);
+/*
+ * Waits for the helpers to leave a job which stopped accepting helpers, then frees its job slot. Spins for a while,
+ * then sleeps until the last helper leaves.
+ */
+static void unpublish_job(struct pthreadpool* job, struct pthreadpool_job_slot* job_slot) {
+	struct pthreadpool* workers_threadpool = get_workers_threadpool(job->parent);
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&job->flags);
+	for (;;) {
+		/* Read the departures counter first: the last helper advances it after it leaves, and ends the wait */
+		const uint32_t departures = pthreadpool_load_acquire_uint32_t(&job_slot->departures);
+		if (pthreadpool_load_relaxed_size_t(&job_slot->state) == 2) {
+			break;
+		}
+		pthreadpool_wait_for_change(workers_threadpool, &job_slot->departures, departures, flags);
+	}
+	pthreadpool_fence_acquire();
+	pthreadpool_store_release_size_t(&job_slot->state, 0);
+}
+
+/* Processes the thread slots of a job which no thread took yet */
+static void run_remaining_job_slots(struct pthreadpool* job) {
+	const size_t threads_count = job->threads_count.value;
+	for (size_t slot = claim_job_slot(job); slot < threads_count; slot = claim_job_slot(job)) {
+		run_job_slot(job, slot);
+	}
+}
+
+/* Time the calling thread of a job spent in its own thread slot, and the number of items it processed there */
+struct caller_slot_stats {
+	uint64_t time_ns;
+	size_t processed_items;
+};
+
+/*
+ * Processes a parallelization command in a private pool structure with threads_count thread slots, and publishes it in
+ * one of the job slots, if any is free, for other threads of the pool to join. Every thread slot of the job is
+ * processed exactly once: by a helper thread, or by the calling thread after it finished its own slot. With
+ * wake_helpers, also wakes up as many sleeping workers as the job has thread slots for helpers. If caller_stats is not
+ * NULL, measures how long the calling thread spent in its own thread slot and how many items it processed there.
+ */
+static void run_job(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_job_slot* job_slots,
+	size_t job_slots_count,
+	struct fxdiv_divisor_size_t threads_count,
+	bool wake_helpers,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags,
+	struct caller_slot_stats* caller_stats)
+{
+	/* If memory is short, the calling thread processes the job alone in a pool structure on the stack */
+	PTHREADPOOL_CACHELINE_ALIGNED char fallback_buffer[sizeof(struct pthreadpool) + sizeof(struct thread_info)];
+	struct pthreadpool* job = pthreadpool_allocate(threads_count.value);
+	if (job == NULL) {
+		memset(fallback_buffer, 0, sizeof(fallback_buffer));
+		job = (struct pthreadpool*) fallback_buffer;
+		threads_count = fxdiv_init_size_t(1);
+		ranges = NULL;
+	}
+	init_job(
+		job, threadpool, threads_count,
+		thread_function, params, params_size, task, context, linear_range, ranges, flags);
+	pthreadpool_store_relaxed_size_t(&job->job_slots, 1);
+
+	struct pthreadpool_job_slot* job_slot = NULL;
+	if (threads_count.value > 1) {
+		job_slot = publish_job(job_slots, job_slots_count, job);
+		if (job_slot != NULL && wake_helpers) {
+			wake_job_helpers(threadpool, job_slot, threads_count.value - 1 /* calling thread */);
 		}
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	if (caller_stats != NULL) {
+		const uint64_t start_time = pthreadpool_get_time_ns();
+		run_job_slot(job, 0);
+		caller_stats->time_ns = pthreadpool_get_time_ns() - start_time;
+		caller_stats->processed_items = job->threads[0].processed_items;
+	} else {
+		run_job_slot(job, 0);
+	}
+
+	if (job_slot != NULL) {
+		/* Stop accepting helpers */
+		pthreadpool_subtract_fetch_relaxed_size_t(&job_slot->state, 1);
+	}
+	run_remaining_job_slots(job);
+	if (job_slot != NULL) {
+		unpublish_job(job, job_slot);
+	}
+
+	if (job != (struct pthreadpool*) fallback_buffer) {
+		pthreadpool_deallocate(job);
+	}
 }
 
-static void thread_parallelize_3d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+/*
+ * Processes a parallelization function called by a task of the same thread pool. Waiting for the pool would deadlock,
+ * because the command which runs the task holds the pool until the task returns. Instead, the calling thread runs the
+ * nested computation as a job, published in its own job slot. A thread publishes one nested job at a time: jobs nested
+ * deeper in it run without helpers.
+ */
+static void parallelize_nested(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags)
+{
+	/* Nested computations run at the priority of the task which calls them */
+	run_job(
+		threadpool, &current_thread->nested_slot, 1, threadpool->threads_count, false /* wake helpers */,
+		thread_function, params, params_size, task, context, linear_range, ranges,
+		flags & ~PTHREADPOOL_FLAG_HIGH_PRIORITY, NULL /* caller stats */);
+}
 
-	const pthreadpool_task_3d_tile_1d_t task = (pthreadpool_task_3d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_concurrently(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags)
+{
+	/* Without precomputed work ranges, a computation with fewer items than threads needs no more thread slots */
+	struct fxdiv_divisor_size_t threads_count = threadpool->threads_count;
+	if (ranges == NULL && linear_range < threads_count.value) {
+		threads_count = fxdiv_init_size_t(linear_range);
+	}
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	/*
+	 * Workers of a team sleep while no command runs on the thread pool: wake them up. High-priority jobs wake up
+	 * sleeping workers too, rather than wait for the threads busy with other computations to preempt them. Small
+	 * computations run as jobs to wake up only the workers they need, rather than all workers as a command does.
+	 */
+	const bool wake_helpers = threadpool->team_threadpool != NULL || (flags & PTHREADPOOL_FLAG_HIGH_PRIORITY) != 0 ||
+		threads_count.value < threadpool->threads_count.value;
+	size_t job_slots_count;
+	struct pthreadpool_job_slot* job_slots = get_concurrent_slots(threadpool, &job_slots_count);
+	run_job(
+		threadpool, job_slots, job_slots_count, threads_count, wake_helpers,
+		thread_function, params, params_size, task, context, linear_range, ranges, flags, NULL /* caller stats */);
+}
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	uint32_t flags)
+{
+	if (is_nested_call(threadpool)) {
+		parallelize_nested(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, NULL /* ranges */, flags);
+	} else if (threadpool->team_threadpool != NULL || (flags & PTHREADPOOL_FLAG_HIGH_PRIORITY) ||
+		(linear_range < threadpool->threads_count.value &&
+			(flags & (PTHREADPOOL_FLAG_LEARN_WEIGHTS | PTHREADPOOL_FLAG_STATIC_SCHEDULE)) == 0))
+	{
+		/*
+		 * A team has no worker threads of its own: its computations run as jobs of the thread pool. High-priority
+		 * computations run as jobs too, so that they don't wait for the command which holds the thread pool. So do
+		 * computations with fewer items than threads: a command would wake up every worker, and most would find no work.
+		 */
+		pthreadpool_parallelize_concurrently(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, NULL /* ranges */, flags);
+	} else {
+		pthreadpool_parallelize_with_ranges(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, NULL /* ranges */, flags);
+	}
+}
+
+static inline size_t random_thread_number(struct thread_info* thread, size_t threads_count) {
+	/* Marsaglia's xorshift32 generator */
+	uint32_t seed = thread->steal_seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	thread->steal_seed = seed;
+
+	/* Map the random number to [0, threads_count - 1) without division, and skip over the calling thread */
+	const size_t tid = (size_t) (((uint64_t) seed * (uint64_t) (threads_count - 1)) >> 32);
+	return tid + (size_t) (tid >= thread->thread_number);
+}
+
+static inline size_t remaining_range_length(struct thread_info* thread, size_t range_threshold) {
+	const size_t range_length = pthreadpool_load_relaxed_size_t(&thread->range_length);
+	/* Fast path functions let range_length wrap around below zero, treat such values as an empty range */
+	return range_length < range_threshold ? range_length : 0;
+}
+
+static inline size_t claim_range_items(struct thread_info* thread, size_t max_length) {
+	size_t range_length = pthreadpool_load_relaxed_size_t(&thread->range_length);
+	while (range_length != 0) {
+		const size_t claim_length = min(range_length, max_length);
+		if (pthreadpool_compare_exchange_weak_relaxed_size_t(&thread->range_length, &range_length, range_length - claim_length)) {
+			return claim_length;
 		}
 	}
+	return 0;
+}
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
+static inline uint32_t steal_distance(const struct thread_info* thread, const struct thread_info* victim) {
+	/* 0 if the victim shares the last-level cache, 1 if it shares only the NUMA node, and 2 otherwise */
+	return (uint32_t) (victim->cache_domain != thread->cache_domain) + (uint32_t) (victim->numa_domain != thread->numa_domain);
+}
+
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_find_victim(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct thread_info* last_victim)
+{
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+	const size_t range_threshold = -threads_count;
+	const size_t thread_number = thread->thread_number;
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+
+	size_t tid = modulo_decrement(last_victim->thread_number, threads_count);
+	if (flags & PTHREADPOOL_FLAG_STEAL_TWO_CHOICES) {
+		/* Sample two other threads and pick the one with more remaining work */
+		struct thread_info* first_victim = &threadpool->threads[random_thread_number(thread, threads_count)];
+		struct thread_info* second_victim = &threadpool->threads[random_thread_number(thread, threads_count)];
+		const size_t first_length = remaining_range_length(first_victim, range_threshold);
+		const size_t second_length = remaining_range_length(second_victim, range_threshold);
+		if (first_length == 0) {
+			if (second_length != 0) {
+				return second_victim;
+			}
+		} else if (second_length == 0) {
+			return first_victim;
+		} else {
+			/* Both samples have work: prefer the closer one, then the one with more items */
+			const uint32_t first_distance = steal_distance(thread, first_victim);
+			const uint32_t second_distance = steal_distance(thread, second_victim);
+			if (first_distance != second_distance) {
+				return first_distance < second_distance ? first_victim : second_victim;
+			}
+			return first_length >= second_length ? first_victim : second_victim;
 		}
+		/* Both samples are out of work: fall back to a sweep from a random thread */
+		tid = random_thread_number(thread, threads_count);
+	} else if ((flags & PTHREADPOOL_FLAG_STEAL_RANDOM) && last_victim == thread) {
+		/* Start the sweep from a random thread to spread thieves across victims */
+		tid = random_thread_number(thread, threads_count);
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	/*
+	 * Sweep all threads in modulo_decrement order.
+	 * Return the first thread with work which shares the last-level cache, or else the nearest thread with work.
+	 */
+	struct thread_info* nearest_victim = NULL;
+	uint32_t nearest_distance = UINT32_MAX;
+	for (size_t i = threads_count; i != 0; i--) {
+		if (tid != thread_number) {
+			struct thread_info* other_thread = &threadpool->threads[tid];
+			if (remaining_range_length(other_thread, range_threshold) != 0) {
+				const uint32_t distance = steal_distance(thread, other_thread);
+				if (distance == 0) {
+					return other_thread;
+				}
+				if (distance < nearest_distance) {
+					nearest_distance = distance;
+					nearest_victim = other_thread;
+				}
+			}
+		}
+		tid = modulo_decrement(tid, threads_count);
+	}
+	return nearest_victim;
 }
 
-static void thread_parallelize_3d_tile_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
-	assert(threadpool != NULL);
-	assert(thread != NULL);
+/* Steals half of the remaining items of the nearest thread with work */
+static bool steal_from_victims(struct pthreadpool* threadpool, struct thread_info* thread) {
+	const size_t range_threshold = -threadpool->threads_count.value;
+	for (struct thread_info* victim = pthreadpool_find_victim(threadpool, thread, thread);
+		victim != NULL;
+		victim = pthreadpool_find_victim(threadpool, thread, victim))
+	{
+		/* Announce the steal before touching range_length, so the victim can't recycle its range under us */
+		pthreadpool_increment_fetch_relaxed_size_t(&victim->steal_pending);
+		pthreadpool_fence_release();
+
+		/* Claim the upper half of the remaining items, rounded up so that the last item can be stolen too */
+		size_t steal_length = 0;
+		size_t victim_length = pthreadpool_load_relaxed_size_t(&victim->range_length);
+		while (victim_length != 0 && victim_length < range_threshold) {
+			const size_t half_length = victim_length - victim_length / 2;
+			if (pthreadpool_compare_exchange_weak_relaxed_size_t(&victim->range_length, &victim_length, victim_length - half_length)) {
+				steal_length = half_length;
+				break;
+			}
+		}
 
-	const pthreadpool_task_3d_tile_1d_with_thread_t task = (pthreadpool_task_3d_tile_1d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
-	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+		size_t range_end = 0;
+		if (steal_length != 0) {
+			pthreadpool_fence_acquire();
+			range_end = pthreadpool_subtract_fetch_relaxed_size_t(&victim->range_end, steal_length) + steal_length;
+		}
+		pthreadpool_decrement_fetch_release_size_t(&victim->steal_pending);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+		if (steal_length != 0) {
+			/* Publish the stolen items as our new work range, making them available to other thieves */
+			pthreadpool_store_relaxed_size_t(&thread->range_start, range_end - steal_length);
+			pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
+			pthreadpool_fence_release();
+			exchange_range_length(thread, steal_length);
 
-	const size_t thread_number = thread->thread_number;
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
+			/* Drop the stolen items if the computation was cancelled while we stole them */
+			pthreadpool_fence_acquire();
+			if (pthreadpool_load_relaxed_uint32_t(&threadpool->cancelled) != 0) {
+				exchange_range_length(thread, 0);
+				return false;
 			}
+			return true;
 		}
 	}
+	return false;
+}
 
-	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
+PTHREADPOOL_INTERNAL bool pthreadpool_steal_range(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread)
+{
+	/* Wait for the thieves which claimed items from our exhausted range to finish updating its range_end */
+	pthreadpool_fence_acquire();
+	while (pthreadpool_load_acquire_size_t(&thread->steal_pending) != 0) {
+		pthreadpool_yield();
+	}
+
+	/* Thieves take items from the end of the range, so we processed all items below the final range_end */
+	thread->processed_items +=
+		pthreadpool_load_relaxed_size_t(&thread->range_end) - pthreadpool_load_relaxed_size_t(&thread->range_start);
+
+	const uint32_t flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
+	/* With the static schedule every thread processes exactly its initial range */
+	if ((flags & PTHREADPOOL_FLAG_STATIC_SCHEDULE) == 0 &&
+		pthreadpool_load_relaxed_uint32_t(&threadpool->cancelled) == 0 &&
+		steal_from_victims(threadpool, thread))
 	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, thread_number, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
-		}
+		return true;
 	}
 
-	/* Make changes by this thread visible to other threads */
-	pthreadpool_fence_release();
+	pthreadpool_store_relaxed_uint32_t(&thread->out_of_work, 1);
+	if (pthreadpool_load_relaxed_uint32_t(&threadpool->has_jobs) != 0) {
+		help_jobs_until_command_completes(threadpool, thread, flags);
+	}
+	return false;
 }
 
-static void thread_parallelize_3d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_1d_with_id_t task = (pthreadpool_task_3d_tile_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_t task = (pthreadpool_task_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, range_start++);
 		}
-	#endif
+	} while (pthreadpool_steal_range(threadpool, thread));
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
-		}
-	}
+static void thread_parallelize_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_1d_with_thread_t task = (pthreadpool_task_1d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, thread_number, range_start++);
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_1d_with_id_with_thread_t task =
-		(pthreadpool_task_3d_tile_1d_with_id_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_with_id_t task = (pthreadpool_task_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
+	const uint32_t default_uarch_index = threadpool->params.parallelize_1d_with_uarch.default_uarch_index;
 	uint32_t uarch_index = default_uarch_index;
 	#if PTHREADPOOL_USE_CPUINFO
 		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
+		if (uarch_index > threadpool->params.parallelize_1d_with_uarch.max_uarch_index) {
 			uarch_index = default_uarch_index;
 		}
 	#endif
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
-
-	const size_t thread_number = thread->thread_number;
-	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			if (++j == range_j.value) {
-				j = 0;
-				i += 1;
-			}
-		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, thread_number, index_i_j.quotient, index_i_j.remainder, start_k, min(range_k - start_k, tile_k));
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, range_start++);
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_2d_t task = (pthreadpool_task_3d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_tile_1d_t task = (pthreadpool_task_1d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d.tile_j;
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d.tile_k;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	const size_t tile = threadpool->params.parallelize_1d_tile_1d.tile;
+	const size_t range = threadpool->params.parallelize_1d_tile_1d.range;
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_2d.range_k;
-	const size_t range_j = threadpool->params.parallelize_3d_tile_2d.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			start_j += tile_j;
-			if (start_j >= range_j) {
-				start_j = 0;
-				i += 1;
-			}
-		}
-	}
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		size_t tile_start = range_start * tile;
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, tile_index_i_j.quotient, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, tile_start, min(range - tile_start, tile));
+			tile_start += tile;
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_3d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d_with_grain(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_3d_tile_2d_with_id_t task = (pthreadpool_task_3d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_t task = (pthreadpool_task_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_2d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_3d_tile_2d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+	const size_t grain = threadpool->params.parallelize_1d_with_grain.grain;
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_k;
-	const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
-	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_j;
-	const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_j;
-	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_k;
-	size_t i = tile_index_i_j.quotient;
-	size_t start_j = tile_index_i_j.remainder * tile_j;
-	size_t start_k = tile_index_ij_k.remainder * tile_k;
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
 
-	const size_t range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_k;
-	const size_t range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_j;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
-		start_k += tile_k;
-		if (start_k >= range_k) {
-			start_k = 0;
-			start_j += tile_j;
-			if (start_j >= range_j) {
-				start_j = 0;
-				i += 1;
-			}
-		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(linear_index, tile_range_k);
-			const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
-			const size_t start_j = tile_index_i_j.remainder * tile_j;
-			const size_t start_k = tile_index_ij_k.remainder * tile_k;
-			task(argument, uarch_index, tile_index_i_j.quotient, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+		/* Claim up to grain items with one atomic operation, and process them without touching shared state */
+		size_t claim_length;
+		while ((claim_length = claim_range_items(thread, grain)) != 0) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			const size_t claim_end = range_start + claim_length;
+			do {
+				task(argument, range_start);
+			} while (++range_start != claim_end);
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_4d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d_reduce(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_4d_t task = (pthreadpool_task_4d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_reduce_t task = (pthreadpool_task_1d_reduce_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_4d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(range_start, range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_4d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-
-	const size_t range_k = threadpool->params.parallelize_4d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l);
-		if (++l == range_l.value) {
-			l = 0;
-			if (++k == range_k) {
-				k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+	const size_t tile = threadpool->params.parallelize_1d_reduce.tile;
+	const size_t range = threadpool->params.parallelize_1d_reduce.range;
+	const size_t partial_stride = threadpool->params.parallelize_1d_reduce.partial_stride;
+	char *const partials = threadpool->params.parallelize_1d_reduce.partials;
 
-	/* There still may be other threads with work */
 	const size_t thread_number = thread->thread_number;
+	void *const partial = partials + thread_number * partial_stride;
+	memcpy(partial, threadpool->params.parallelize_1d_reduce.identity, threadpool->params.parallelize_1d_reduce.value_size);
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		size_t tile_start = range_start * tile;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, partial, tile_start, min(range - tile_start, tile));
+			tile_start += tile;
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/*
+	 * Combine partial results up a binary tree. On level L, the partial result of thread n + L is merged into the
+	 * partial result of thread n (n is a multiple of 2L) by whichever of the two subtrees finishes last; the other
+	 * thread leaves the tree. The partial result of thread 0 holds the combined result when all threads are done.
+	 */
+	const pthreadpool_combine_t combine = threadpool->params.parallelize_1d_reduce.combine;
+	pthreadpool_atomic_size_t* arrivals = threadpool->params.parallelize_1d_reduce.arrivals;
 	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(linear_index, range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder);
-		}
+	size_t node = thread_number;
+	for (size_t level = 1; level < threads_count; level *= 2) {
+		const size_t lower_node = node & ~level;
+		const size_t upper_node = lower_node + level;
+		if (upper_node >= threads_count) {
+			/* No sibling subtree on this level */
+			continue;
+		}
+		if (pthreadpool_decrement_fetch_acquire_release_size_t(&arrivals[upper_node]) != 0) {
+			/* The sibling subtree is still running, and will merge our partial result when done */
+			break;
+		}
+		combine(argument, partials + lower_node * partial_stride, partials + upper_node * partial_stride);
+		node = lower_node;
 	}
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_4d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_1d_find_first(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_4d_tile_1d_t task = (pthreadpool_task_4d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_1d_predicate_t task = (pthreadpool_task_1d_predicate_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
-
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_1d.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_1d.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_1d.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = tile_index_k_l.quotient;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
-
-	const size_t range_k = threadpool->params.parallelize_4d_tile_1d.range_k;
-	const size_t range_l = threadpool->params.parallelize_4d_tile_1d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, start_l, min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			if (++k == range_k) {
-				k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
+	pthreadpool_atomic_size_t* first_index = threadpool->params.parallelize_1d_find_first.first_index;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			size_t found_index = pthreadpool_load_relaxed_size_t(first_index);
+			if (range_start >= found_index) {
+				/* Items are processed in increasing order, so none of the remaining items can precede the match */
+				exchange_range_length(thread, 0);
+				break;
 			}
+			if (task(argument, range_start)) {
+				/* Lower the first index unless another thread found a preceding item in the meantime */
+				while (range_start < found_index &&
+					!pthreadpool_compare_exchange_weak_relaxed_size_t(first_index, &found_index, range_start));
+				exchange_range_length(thread, 0);
+				break;
+			}
+			range_start++;
 		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, index_i_j.quotient, index_i_j.remainder, tile_index_k_l.quotient, start_l, min(range_l - start_l, tile_l));
-		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_4d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_4d_tile_2d_t task = (pthreadpool_task_4d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_t task = (pthreadpool_task_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d.tile_k;
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_k_l.quotient * tile_k;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_2d.range_j;
 
-	const size_t range_l = threadpool->params.parallelize_4d_tile_2d.range_l;
-	const size_t range_k = threadpool->params.parallelize_4d_tile_2d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			start_k += tile_k;
-			if (start_k >= range_k) {
-				start_k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
-			}
-		}
-	}
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(range_start, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_k = tile_index_k_l.quotient * tile_k;
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, index_i_j.quotient, index_i_j.remainder, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j);
+			if (++j == range_j.value) {
+				j = 0;
+				i += 1;
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_4d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_4d_tile_2d_with_id_t task = (pthreadpool_task_4d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_with_thread_t task = (pthreadpool_task_2d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	const uint32_t default_uarch_index = threadpool->params.parallelize_4d_tile_2d_with_uarch.default_uarch_index;
-	uint32_t uarch_index = default_uarch_index;
-	#if PTHREADPOOL_USE_CPUINFO
-		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-		if (uarch_index > threadpool->params.parallelize_4d_tile_2d_with_uarch.max_uarch_index) {
-			uarch_index = default_uarch_index;
-		}
-	#endif
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_2d.range_j;
+	const size_t thread_number = thread->thread_number;
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_kl;
-	const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_l;
-	const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_k;
-	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_l;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t start_k = tile_index_k_l.quotient * tile_k;
-	size_t start_l = tile_index_k_l.remainder * tile_l;
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(range_start, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
 
-	const size_t range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_l;
-	const size_t range_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, uarch_index, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		start_l += tile_l;
-		if (start_l >= range_l) {
-			start_l = 0;
-			start_k += tile_k;
-			if (start_k >= range_k) {
-				start_k = 0;
-				if (++j == range_j.value) {
-					j = 0;
-					i += 1;
-				}
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, thread_number, i, j);
+			if (++j == range_j.value) {
+				j = 0;
+				i += 1;
 			}
 		}
-	}
-
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(linear_index, tile_range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
-			const size_t start_k = tile_index_k_l.quotient * tile_k;
-			const size_t start_l = tile_index_k_l.remainder * tile_l;
-			task(argument, uarch_index, index_i_j.quotient, index_i_j.remainder, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
-		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_5d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_5d_t task = (pthreadpool_task_5d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_1d_t task = (pthreadpool_task_2d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_lm = threadpool->params.parallelize_5d.range_lm;
-	const struct fxdiv_result_size_t index_ijk_lm = fxdiv_divide_size_t(range_start, range_lm);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lm.quotient, range_k);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_5d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_ijk_lm.remainder, range_m);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d.tile_range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d.tile_j;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_1d.range_j;
 
-	const size_t range_l = threadpool->params.parallelize_5d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m);
-		if (++m == range_m.value) {
-			m = 0;
-			if (++l == range_l) {
-				l = 0;
-				if (++k == range_k.value) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
-		}
-	}
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
+		size_t i = tile_index_i_j.quotient;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ijk_lm = fxdiv_divide_size_t(linear_index, range_lm);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lm.quotient, range_k);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_ijk_lm.remainder, range_m);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder);
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, start_j, min(range_j - start_j, tile_j));
+			start_j += tile_j;
+			if (start_j >= range_j) {
+				start_j = 0;
+				i += 1;
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_5d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_5d_tile_1d_t task = (pthreadpool_task_5d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_1d_with_id_t task = (pthreadpool_task_2d_tile_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_1d.tile_range_m;
-	const struct fxdiv_result_size_t tile_index_ijkl_m = fxdiv_divide_size_t(range_start, tile_range_m);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_5d_tile_1d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_m.quotient, range_kl);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_5d_tile_1d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	const size_t tile_m = threadpool->params.parallelize_5d_tile_1d.tile_m;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-	size_t start_m = tile_index_ijkl_m.remainder * tile_m;
-
-	const size_t range_m = threadpool->params.parallelize_5d_tile_1d.range_m;
-	const size_t range_k = threadpool->params.parallelize_5d_tile_1d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, start_m, min(range_m - start_m, tile_m));
-		start_m += tile_m;
-		if (start_m >= range_m) {
-			start_m = 0;
-			if (++l == range_l.value) {
-				l = 0;
-				if (++k == range_k) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
+	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_1d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_2d_tile_1d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
 		}
-	}
+	#endif
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijkl_m = fxdiv_divide_size_t(linear_index, tile_range_m);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_m.quotient, range_kl);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			size_t start_m = tile_index_ijkl_m.remainder * tile_m;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder, start_m,
-				min(range_m - start_m, tile_m));
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_j;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
+		size_t i = tile_index_i_j.quotient;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, i, start_j, min(range_j - start_j, tile_j));
+			start_j += tile_j;
+			if (start_j >= range_j) {
+				start_j = 0;
+				i += 1;
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_5d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_5d_tile_2d_t task = (pthreadpool_task_5d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_1d_with_id_with_thread_t task =
+		(pthreadpool_task_2d_tile_1d_with_id_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_lm = threadpool->params.parallelize_5d_tile_2d.tile_range_lm;
-	const struct fxdiv_result_size_t tile_index_ijk_lm = fxdiv_divide_size_t(range_start, tile_range_lm);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d_tile_2d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lm.quotient, range_k);
-	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_2d.tile_range_m;
-	const struct fxdiv_result_size_t tile_index_l_m = fxdiv_divide_size_t(tile_index_ijk_lm.remainder, tile_range_m);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const size_t tile_l = threadpool->params.parallelize_5d_tile_2d.tile_l;
-	const size_t tile_m = threadpool->params.parallelize_5d_tile_2d.tile_m;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t start_l = tile_index_l_m.quotient * tile_l;
-	size_t start_m = tile_index_l_m.remainder * tile_m;
-
-	const size_t range_m = threadpool->params.parallelize_5d_tile_2d.range_m;
-	const size_t range_l = threadpool->params.parallelize_5d_tile_2d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, start_l, start_m, min(range_l - start_l, tile_l), min(range_m - start_m, tile_m));
-		start_m += tile_m;
-		if (start_m >= range_m) {
-			start_m = 0;
-			start_l += tile_l;
-			if (start_l >= range_l) {
-				start_l = 0;
-				if (++k == range_k.value) {
-					k = 0;
-					if (++j == range_j.value) {
-						j = 0;
-						i += 1;
-					}
-				}
-			}
+	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_1d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_2d_tile_1d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
 		}
-	}
+	#endif
 
-	/* There still may be other threads with work */
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.tile_j;
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijk_lm = fxdiv_divide_size_t(linear_index, tile_range_lm);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lm.quotient, range_k);
-			const struct fxdiv_result_size_t tile_index_l_m = fxdiv_divide_size_t(tile_index_ijk_lm.remainder, tile_range_m);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const size_t start_l = tile_index_l_m.quotient * tile_l;
-			const size_t start_m = tile_index_l_m.remainder * tile_m;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder,
-				start_l, start_m, min(range_l - start_l, tile_l), min(range_m - start_m, tile_m));
+	const size_t range_j = threadpool->params.parallelize_2d_tile_1d_with_uarch.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
+		size_t i = tile_index_i_j.quotient;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, thread_number, i, start_j, min(range_j - start_j, tile_j));
+			start_j += tile_j;
+			if (start_j >= range_j) {
+				start_j = 0;
+				i += 1;
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_6d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_6d_t task = (pthreadpool_task_6d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t range_lmn = threadpool->params.parallelize_6d.range_lmn;
-	const struct fxdiv_result_size_t index_ijk_lmn = fxdiv_divide_size_t(range_start, range_lmn);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lmn.quotient, range_k);
-	const struct fxdiv_divisor_size_t range_n = threadpool->params.parallelize_6d.range_n;
-	const struct fxdiv_result_size_t index_lm_n = fxdiv_divide_size_t(index_ijk_lmn.remainder, range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_lm_n.quotient, range_m);
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
-	size_t n = index_lm_n.remainder;
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d.tile_range_j;
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d.tile_i;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d.tile_j;
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d.range_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d.range_j;
 
-	const size_t range_l = threadpool->params.parallelize_6d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m, n);
-		if (++n == range_n.value) {
-			n = 0;
-			if (++m == range_m.value) {
-				m = 0;
-				if (++l == range_l) {
-					l = 0;
-					if (++k == range_k.value) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
-				}
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(range_start, tile_range_j);
+		size_t start_i = tile_index_i_j.quotient * tile_i;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+			start_j += tile_j;
+			if (start_j >= range_j) {
+				start_j = 0;
+				start_i += tile_i;
 			}
 		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+/* Extract the even bits of a Morton code */
+static inline size_t morton_compact_bits(uint64_t code) {
+	code &= UINT64_C(0x5555555555555555);
+	code = (code | (code >> 1)) & UINT64_C(0x3333333333333333);
+	code = (code | (code >> 2)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+	code = (code | (code >> 4)) & UINT64_C(0x00FF00FF00FF00FF);
+	code = (code | (code >> 8)) & UINT64_C(0x0000FFFF0000FFFF);
+	code = (code | (code >> 16)) & UINT64_C(0x00000000FFFFFFFF);
+	return (size_t) code;
+}
+
+/* Smallest power of 2 not less than range_i and range_j */
+static inline size_t morton_curve_size(size_t range_i, size_t range_j) {
+	const size_t range = max(range_i, range_j);
+	size_t size = 1;
+	while (size < range) {
+		size *= 2;
+	}
+	return size;
+}
+
+/*
+ * Map the index of a tile in Z-order to its coordinates in a range_i x range_j grid of tiles.
+ *
+ * The grid is embedded into a square Z-order curve of morton_size x morton_size tiles, and tiles outside of the grid
+ * are skipped, so that consecutive indices cover compact square-ish blocks of the grid for any grid shape. The
+ * function descends the quadrants of the curve, counting the tiles of the grid in the quadrants it skips, until it
+ * reaches a quadrant which lies entirely in the grid, where the index is a plain Morton code.
+ */
+static inline void morton_decode_tile_index(
+	size_t index,
+	size_t range_i,
+	size_t range_j,
+	size_t morton_size,
+	size_t* index_i_ptr,
+	size_t* index_j_ptr)
+{
+	size_t index_i = 0;
+	size_t index_j = 0;
+	while (index_i + morton_size > range_i || index_j + morton_size > range_j) {
+		const size_t half_size = morton_size / 2;
+		const size_t top_rows = min(range_i - index_i, half_size);
+		const size_t bottom_rows = range_i - index_i > half_size ? min(range_i - index_i - half_size, half_size) : 0;
+		const size_t left_columns = min(range_j - index_j, half_size);
+		const size_t right_columns = range_j - index_j > half_size ? min(range_j - index_j - half_size, half_size) : 0;
+
+		morton_size = half_size;
+		const size_t top_left_tiles = top_rows * left_columns;
+		if (index < top_left_tiles) {
+			continue;
+		}
+		index -= top_left_tiles;
+		const size_t top_right_tiles = top_rows * right_columns;
+		if (index < top_right_tiles) {
+			index_j += half_size;
+			continue;
+		}
+		index -= top_right_tiles;
+		const size_t bottom_left_tiles = bottom_rows * left_columns;
+		if (index < bottom_left_tiles) {
+			index_i += half_size;
+			continue;
+		}
+		index -= bottom_left_tiles;
+		index_i += half_size;
+		index_j += half_size;
 	}
+	*index_i_ptr = index_i + morton_compact_bits((uint64_t) index >> 1);
+	*index_j_ptr = index_j + morton_compact_bits((uint64_t) index);
+}
+
+static void thread_parallelize_2d_tile_2d_morton(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
 
+	const pthreadpool_task_2d_tile_2d_t task = (pthreadpool_task_2d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t index_ijk_lmn = fxdiv_divide_size_t(linear_index, range_lmn);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lmn.quotient, range_k);
-			const struct fxdiv_result_size_t index_lm_n = fxdiv_divide_size_t(index_ijk_lmn.remainder, range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_lm_n.quotient, range_m);
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder, index_lm_n.remainder);
+	const size_t tile_range_i = threadpool->params.parallelize_2d_tile_2d_morton.tile_range_i;
+	const size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d_morton.tile_range_j;
+	const size_t morton_size = threadpool->params.parallelize_2d_tile_2d_morton.morton_size;
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_morton.tile_i;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_morton.tile_j;
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_morton.range_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_morton.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		size_t tile_index = pthreadpool_load_relaxed_size_t(&thread->range_start);
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			size_t tile_index_i, tile_index_j;
+			morton_decode_tile_index(tile_index++, tile_range_i, tile_range_j, morton_size, &tile_index_i, &tile_index_j);
+			const size_t start_i = tile_index_i * tile_i;
+			const size_t start_j = tile_index_j * tile_j;
+			task(argument, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_6d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_2d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_6d_tile_1d_t task = (pthreadpool_task_6d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_2d_tile_2d_with_id_t task = (pthreadpool_task_2d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_lmn = threadpool->params.parallelize_6d_tile_1d.tile_range_lmn;
-	const struct fxdiv_result_size_t tile_index_ijk_lmn = fxdiv_divide_size_t(range_start, tile_range_lmn);
-	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d_tile_1d.range_k;
-	const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lmn.quotient, range_k);
-	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_1d.tile_range_n;
-	const struct fxdiv_result_size_t tile_index_lm_n = fxdiv_divide_size_t(tile_index_ijk_lmn.remainder, tile_range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_1d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d_tile_1d.range_m;
-	const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(tile_index_lm_n.quotient, range_m);
-	const size_t tile_n = threadpool->params.parallelize_6d_tile_1d.tile_n;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_ij_k.remainder;
-	size_t l = index_l_m.quotient;
-	size_t m = index_l_m.remainder;
-	size_t start_n = tile_index_lm_n.remainder * tile_n;
+	const uint32_t default_uarch_index = threadpool->params.parallelize_2d_tile_2d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_2d_tile_2d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
+		}
+	#endif
 
-	const size_t range_n = threadpool->params.parallelize_6d_tile_1d.range_n;
-	const size_t range_l = threadpool->params.parallelize_6d_tile_1d.range_l;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, m, start_n, min(range_n - start_n, tile_n));
-		start_n += tile_n;
-		if (start_n >= range_n) {
-			start_n = 0;
-			if (++m == range_m.value) {
-				m = 0;
-				if (++l == range_l) {
-					l = 0;
-					if (++k == range_k.value) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
-				}
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_range_j;
+	const size_t range_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_i;
+	const size_t tile_i = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_i;
+	const size_t range_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.range_j;
+	const size_t tile_j = threadpool->params.parallelize_2d_tile_2d_with_uarch.tile_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index = fxdiv_divide_size_t(range_start, tile_range_j);
+		size_t start_i = index.quotient * tile_i;
+		size_t start_j = index.remainder * tile_j;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, start_i, start_j, min(range_i - start_i, tile_i), min(range_j - start_j, tile_j));
+			start_j += tile_j;
+			if (start_j >= range_j) {
+				start_j = 0;
+				start_i += tile_i;
 			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
 
+static void thread_parallelize_3d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
 
-	/* There still may be other threads with work */
-	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijk_lmn = fxdiv_divide_size_t(linear_index, tile_range_lmn);
-			const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lmn.quotient, range_k);
-			const struct fxdiv_result_size_t tile_index_lm_n = fxdiv_divide_size_t(tile_index_ijk_lmn.remainder, tile_range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
-			const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(tile_index_lm_n.quotient, range_m);
-			const size_t start_n = tile_index_lm_n.remainder * tile_n;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_ij_k.remainder, index_l_m.quotient, index_l_m.remainder,
-				start_n, min(range_n - start_n, tile_n));
+	const pthreadpool_task_3d_t task = (pthreadpool_task_3d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_3d.range_k;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(range_start, range_k);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_ij_k.remainder;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k);
+			if (++k == range_k.value) {
+				k = 0;
+				if (++j == range_j.value) {
+					j = 0;
+					i += 1;
+				}
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-static void thread_parallelize_6d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+static void thread_parallelize_3d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
 	assert(threadpool != NULL);
 	assert(thread != NULL);
 
-	const pthreadpool_task_6d_tile_2d_t task = (pthreadpool_task_6d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	const pthreadpool_task_3d_tile_1d_t task = (pthreadpool_task_3d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
 	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* Process thread's own range of items */
-	const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
-	const struct fxdiv_divisor_size_t tile_range_mn = threadpool->params.parallelize_6d_tile_2d.tile_range_mn;
-	const struct fxdiv_result_size_t tile_index_ijkl_mn = fxdiv_divide_size_t(range_start, tile_range_mn);
-	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_6d_tile_2d.range_kl;
-	const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_mn.quotient, range_kl);
-	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_2d.tile_range_n;
-	const struct fxdiv_result_size_t tile_index_m_n = fxdiv_divide_size_t(tile_index_ijkl_mn.remainder, tile_range_n);
-	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_2d.range_j;
-	const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_6d_tile_2d.range_l;
-	const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-	const size_t tile_m = threadpool->params.parallelize_6d_tile_2d.tile_m;
-	const size_t tile_n = threadpool->params.parallelize_6d_tile_2d.tile_n;
-	size_t i = index_i_j.quotient;
-	size_t j = index_i_j.remainder;
-	size_t k = index_k_l.quotient;
-	size_t l = index_k_l.remainder;
-	size_t start_m = tile_index_m_n.quotient * tile_m;
-	size_t start_n = tile_index_m_n.remainder * tile_n;
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
 
-	const size_t range_n = threadpool->params.parallelize_6d_tile_2d.range_n;
-	const size_t range_m = threadpool->params.parallelize_6d_tile_2d.range_m;
-	const size_t range_k = threadpool->params.parallelize_6d_tile_2d.range_k;
-	while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
-		task(argument, i, j, k, l, start_m, start_n, min(range_m - start_m, tile_m), min(range_n - start_n, tile_n));
-		start_n += tile_n;
-		if (start_n >= range_n) {
-			start_n = 0;
-			start_m += tile_m;
-			if (start_m >= range_m) {
-				start_m = 0;
-				if (++l == range_l.value) {
-					l = 0;
-					if (++k == range_k) {
-						k = 0;
-						if (++j == range_j.value) {
-							j = 0;
-							i += 1;
-						}
-					}
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, start_k, min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				if (++j == range_j.value) {
+					j = 0;
+					i += 1;
 				}
 			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_3d_tile_1d_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_1d_with_thread_t task = (pthreadpool_task_3d_tile_1d_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
 
-	/* There still may be other threads with work */
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d.tile_range_k;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d.range_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d.tile_k;
 	const size_t thread_number = thread->thread_number;
-	const size_t threads_count = threadpool->threads_count.value;
-	for (size_t tid = modulo_decrement(thread_number, threads_count);
-		tid != thread_number;
-		tid = modulo_decrement(tid, threads_count))
-	{
-		struct thread_info* other_thread = &threadpool->threads[tid];
-		while (pthreadpool_try_decrement_relaxed_size_t(&other_thread->range_length)) {
-			const size_t linear_index = pthreadpool_decrement_fetch_relaxed_size_t(&other_thread->range_end);
-			const struct fxdiv_result_size_t tile_index_ijkl_mn = fxdiv_divide_size_t(linear_index, tile_range_mn);
-			const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_mn.quotient, range_kl);
-			const struct fxdiv_result_size_t tile_index_m_n = fxdiv_divide_size_t(tile_index_ijkl_mn.remainder, tile_range_n);
-			const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
-			const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
-			const size_t start_m = tile_index_m_n.quotient * tile_m;
-			const size_t start_n = tile_index_m_n.remainder * tile_n;
-			task(argument, index_i_j.quotient, index_i_j.remainder, index_k_l.quotient, index_k_l.remainder,
-				start_m, start_n, min(range_m - start_m, tile_m), min(range_n - start_n, tile_n));
+	const size_t range_k = threadpool->params.parallelize_3d_tile_1d.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				if (++j == range_j.value) {
+					j = 0;
+					i += 1;
+				}
+			}
 		}
-	}
+	} while (pthreadpool_steal_range(threadpool, thread));
 
 	/* Make changes by this thread visible to other threads */
 	pthreadpool_fence_release();
 }
 
-void pthreadpool_parallelize_1d(
-	struct pthreadpool* threadpool,
-	pthreadpool_task_1d_t task,
-	void* argument,
-	size_t range,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
-		for (size_t i = 0; i < range; i++) {
-			task(argument, i);
-		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+static void thread_parallelize_3d_tile_1d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_1d_with_id_t task = (pthreadpool_task_3d_tile_1d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
 		}
-	} else {
-		thread_function_t parallelize_1d = &thread_parallelize_1d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_1d = &pthreadpool_thread_parallelize_1d_fastpath;
+	#endif
+
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, i, j, start_k, min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				if (++j == range_j.value) {
+					j = 0;
+					i += 1;
+				}
 			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_1d, NULL, 0,
-			(void*) task, argument, range, flags);
-	}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
 }
 
-void pthreadpool_parallelize_1d_with_thread(
-	struct pthreadpool* threadpool,
-	pthreadpool_task_1d_with_thread_t task,
-	void* argument,
-	size_t range,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
+static void thread_parallelize_3d_tile_1d_with_uarch_with_thread(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_1d_with_id_with_thread_t task =
+		(pthreadpool_task_3d_tile_1d_with_id_with_thread_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_1d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_3d_tile_1d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
+		}
+	#endif
+
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_range_k;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.tile_k;
+	const size_t thread_number = thread->thread_number;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_1d_with_uarch.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, thread_number, i, j, start_k, min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				if (++j == range_j.value) {
+					j = 0;
+					i += 1;
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_3d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_2d_t task = (pthreadpool_task_3d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d.tile_range_k;
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d.tile_range_j;
+	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d.tile_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d.tile_k;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_2d.range_k;
+	const size_t range_j = threadpool->params.parallelize_3d_tile_2d.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
+		size_t i = tile_index_i_j.quotient;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				start_j += tile_j;
+				if (start_j >= range_j) {
+					start_j = 0;
+					i += 1;
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_3d_tile_2d_morton(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_2d_t task = (pthreadpool_task_3d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_jk = threadpool->params.parallelize_3d_tile_2d_morton.tile_range_jk;
+	const size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d_morton.tile_range_j;
+	const size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d_morton.tile_range_k;
+	const size_t morton_size = threadpool->params.parallelize_3d_tile_2d_morton.morton_size;
+	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d_morton.tile_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d_morton.tile_k;
+	const size_t range_j = threadpool->params.parallelize_3d_tile_2d_morton.range_j;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_2d_morton.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_i_jk = fxdiv_divide_size_t(range_start, tile_range_jk);
+		size_t i = tile_index_i_jk.quotient;
+		size_t tile_index_jk = tile_index_i_jk.remainder;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			size_t tile_index_j, tile_index_k;
+			morton_decode_tile_index(tile_index_jk, tile_range_j, tile_range_k, morton_size, &tile_index_j, &tile_index_k);
+			const size_t start_j = tile_index_j * tile_j;
+			const size_t start_k = tile_index_k * tile_k;
+			task(argument, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+			if (++tile_index_jk == tile_range_jk.value) {
+				tile_index_jk = 0;
+				i += 1;
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_3d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_3d_tile_2d_with_id_t task = (pthreadpool_task_3d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const uint32_t default_uarch_index = threadpool->params.parallelize_3d_tile_2d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_3d_tile_2d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
+		}
+	#endif
+
+	const struct fxdiv_divisor_size_t tile_range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_k;
+	const struct fxdiv_divisor_size_t tile_range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_range_j;
+	const size_t tile_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_j;
+	const size_t tile_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.tile_k;
+	const size_t range_k = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_k;
+	const size_t range_j = threadpool->params.parallelize_3d_tile_2d_with_uarch.range_j;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_k = fxdiv_divide_size_t(range_start, tile_range_k);
+		const struct fxdiv_result_size_t tile_index_i_j = fxdiv_divide_size_t(tile_index_ij_k.quotient, tile_range_j);
+		size_t i = tile_index_i_j.quotient;
+		size_t start_j = tile_index_i_j.remainder * tile_j;
+		size_t start_k = tile_index_ij_k.remainder * tile_k;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, i, start_j, start_k, min(range_j - start_j, tile_j), min(range_k - start_k, tile_k));
+			start_k += tile_k;
+			if (start_k >= range_k) {
+				start_k = 0;
+				start_j += tile_j;
+				if (start_j >= range_j) {
+					start_j = 0;
+					i += 1;
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_4d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_4d_t task = (pthreadpool_task_4d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_4d.range_kl;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d.range_j;
+	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_4d.range_l;
+	const size_t range_k = threadpool->params.parallelize_4d.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(range_start, range_kl);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_k_l.quotient;
+		size_t l = index_k_l.remainder;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l);
+			if (++l == range_l.value) {
+				l = 0;
+				if (++k == range_k) {
+					k = 0;
+					if (++j == range_j.value) {
+						j = 0;
+						i += 1;
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_4d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_4d_tile_1d_t task = (pthreadpool_task_4d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_1d.tile_range_kl;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_1d.range_j;
+	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_1d.tile_range_l;
+	const size_t tile_l = threadpool->params.parallelize_4d_tile_1d.tile_l;
+	const size_t range_k = threadpool->params.parallelize_4d_tile_1d.range_k;
+	const size_t range_l = threadpool->params.parallelize_4d_tile_1d.range_l;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = tile_index_k_l.quotient;
+		size_t start_l = tile_index_k_l.remainder * tile_l;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, start_l, min(range_l - start_l, tile_l));
+			start_l += tile_l;
+			if (start_l >= range_l) {
+				start_l = 0;
+				if (++k == range_k) {
+					k = 0;
+					if (++j == range_j.value) {
+						j = 0;
+						i += 1;
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_4d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_4d_tile_2d_t task = (pthreadpool_task_4d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d.tile_range_kl;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d.range_j;
+	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d.tile_range_l;
+	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d.tile_k;
+	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d.tile_l;
+	const size_t range_l = threadpool->params.parallelize_4d_tile_2d.range_l;
+	const size_t range_k = threadpool->params.parallelize_4d_tile_2d.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_k_l.quotient * tile_k;
+		size_t start_l = tile_index_k_l.remainder * tile_l;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
+			start_l += tile_l;
+			if (start_l >= range_l) {
+				start_l = 0;
+				start_k += tile_k;
+				if (start_k >= range_k) {
+					start_k = 0;
+					if (++j == range_j.value) {
+						j = 0;
+						i += 1;
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_4d_tile_2d_with_uarch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_4d_tile_2d_with_id_t task = (pthreadpool_task_4d_tile_2d_with_id_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const uint32_t default_uarch_index = threadpool->params.parallelize_4d_tile_2d_with_uarch.default_uarch_index;
+	uint32_t uarch_index = default_uarch_index;
+	#if PTHREADPOOL_USE_CPUINFO
+		uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+		if (uarch_index > threadpool->params.parallelize_4d_tile_2d_with_uarch.max_uarch_index) {
+			uarch_index = default_uarch_index;
+		}
+	#endif
+
+	const struct fxdiv_divisor_size_t tile_range_kl = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_kl;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_j;
+	const struct fxdiv_divisor_size_t tile_range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_range_l;
+	const size_t tile_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_k;
+	const size_t tile_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.tile_l;
+	const size_t range_l = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_l;
+	const size_t range_k = threadpool->params.parallelize_4d_tile_2d_with_uarch.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ij_kl = fxdiv_divide_size_t(range_start, tile_range_kl);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(tile_index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t tile_index_k_l = fxdiv_divide_size_t(tile_index_ij_kl.remainder, tile_range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t start_k = tile_index_k_l.quotient * tile_k;
+		size_t start_l = tile_index_k_l.remainder * tile_l;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, uarch_index, i, j, start_k, start_l, min(range_k - start_k, tile_k), min(range_l - start_l, tile_l));
+			start_l += tile_l;
+			if (start_l >= range_l) {
+				start_l = 0;
+				start_k += tile_k;
+				if (start_k >= range_k) {
+					start_k = 0;
+					if (++j == range_j.value) {
+						j = 0;
+						i += 1;
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_5d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_5d_t task = (pthreadpool_task_5d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t range_lm = threadpool->params.parallelize_5d.range_lm;
+	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d.range_k;
+	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_5d.range_m;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d.range_j;
+	const size_t range_l = threadpool->params.parallelize_5d.range_l;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_ijk_lm = fxdiv_divide_size_t(range_start, range_lm);
+		const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lm.quotient, range_k);
+		const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_ijk_lm.remainder, range_m);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_ij_k.remainder;
+		size_t l = index_l_m.quotient;
+		size_t m = index_l_m.remainder;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l, m);
+			if (++m == range_m.value) {
+				m = 0;
+				if (++l == range_l) {
+					l = 0;
+					if (++k == range_k.value) {
+						k = 0;
+						if (++j == range_j.value) {
+							j = 0;
+							i += 1;
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_5d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_5d_tile_1d_t task = (pthreadpool_task_5d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_1d.tile_range_m;
+	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_5d_tile_1d.range_kl;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_1d.range_j;
+	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_5d_tile_1d.range_l;
+	const size_t tile_m = threadpool->params.parallelize_5d_tile_1d.tile_m;
+	const size_t range_m = threadpool->params.parallelize_5d_tile_1d.range_m;
+	const size_t range_k = threadpool->params.parallelize_5d_tile_1d.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ijkl_m = fxdiv_divide_size_t(range_start, tile_range_m);
+		const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_m.quotient, range_kl);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_k_l.quotient;
+		size_t l = index_k_l.remainder;
+		size_t start_m = tile_index_ijkl_m.remainder * tile_m;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l, start_m, min(range_m - start_m, tile_m));
+			start_m += tile_m;
+			if (start_m >= range_m) {
+				start_m = 0;
+				if (++l == range_l.value) {
+					l = 0;
+					if (++k == range_k) {
+						k = 0;
+						if (++j == range_j.value) {
+							j = 0;
+							i += 1;
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_5d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_5d_tile_2d_t task = (pthreadpool_task_5d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_lm = threadpool->params.parallelize_5d_tile_2d.tile_range_lm;
+	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_5d_tile_2d.range_k;
+	const struct fxdiv_divisor_size_t tile_range_m = threadpool->params.parallelize_5d_tile_2d.tile_range_m;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_5d_tile_2d.range_j;
+	const size_t tile_l = threadpool->params.parallelize_5d_tile_2d.tile_l;
+	const size_t tile_m = threadpool->params.parallelize_5d_tile_2d.tile_m;
+	const size_t range_m = threadpool->params.parallelize_5d_tile_2d.range_m;
+	const size_t range_l = threadpool->params.parallelize_5d_tile_2d.range_l;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ijk_lm = fxdiv_divide_size_t(range_start, tile_range_lm);
+		const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lm.quotient, range_k);
+		const struct fxdiv_result_size_t tile_index_l_m = fxdiv_divide_size_t(tile_index_ijk_lm.remainder, tile_range_m);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_ij_k.remainder;
+		size_t start_l = tile_index_l_m.quotient * tile_l;
+		size_t start_m = tile_index_l_m.remainder * tile_m;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, start_l, start_m, min(range_l - start_l, tile_l), min(range_m - start_m, tile_m));
+			start_m += tile_m;
+			if (start_m >= range_m) {
+				start_m = 0;
+				start_l += tile_l;
+				if (start_l >= range_l) {
+					start_l = 0;
+					if (++k == range_k.value) {
+						k = 0;
+						if (++j == range_j.value) {
+							j = 0;
+							i += 1;
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_6d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_6d_t task = (pthreadpool_task_6d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t range_lmn = threadpool->params.parallelize_6d.range_lmn;
+	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d.range_k;
+	const struct fxdiv_divisor_size_t range_n = threadpool->params.parallelize_6d.range_n;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d.range_j;
+	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d.range_m;
+	const size_t range_l = threadpool->params.parallelize_6d.range_l;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t index_ijk_lmn = fxdiv_divide_size_t(range_start, range_lmn);
+		const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(index_ijk_lmn.quotient, range_k);
+		const struct fxdiv_result_size_t index_lm_n = fxdiv_divide_size_t(index_ijk_lmn.remainder, range_n);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
+		const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(index_lm_n.quotient, range_m);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_ij_k.remainder;
+		size_t l = index_l_m.quotient;
+		size_t m = index_l_m.remainder;
+		size_t n = index_lm_n.remainder;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l, m, n);
+			if (++n == range_n.value) {
+				n = 0;
+				if (++m == range_m.value) {
+					m = 0;
+					if (++l == range_l) {
+						l = 0;
+						if (++k == range_k.value) {
+							k = 0;
+							if (++j == range_j.value) {
+								j = 0;
+								i += 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_6d_tile_1d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_6d_tile_1d_t task = (pthreadpool_task_6d_tile_1d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_lmn = threadpool->params.parallelize_6d_tile_1d.tile_range_lmn;
+	const struct fxdiv_divisor_size_t range_k = threadpool->params.parallelize_6d_tile_1d.range_k;
+	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_1d.tile_range_n;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_1d.range_j;
+	const struct fxdiv_divisor_size_t range_m = threadpool->params.parallelize_6d_tile_1d.range_m;
+	const size_t tile_n = threadpool->params.parallelize_6d_tile_1d.tile_n;
+	const size_t range_n = threadpool->params.parallelize_6d_tile_1d.range_n;
+	const size_t range_l = threadpool->params.parallelize_6d_tile_1d.range_l;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ijk_lmn = fxdiv_divide_size_t(range_start, tile_range_lmn);
+		const struct fxdiv_result_size_t index_ij_k = fxdiv_divide_size_t(tile_index_ijk_lmn.quotient, range_k);
+		const struct fxdiv_result_size_t tile_index_lm_n = fxdiv_divide_size_t(tile_index_ijk_lmn.remainder, tile_range_n);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_k.quotient, range_j);
+		const struct fxdiv_result_size_t index_l_m = fxdiv_divide_size_t(tile_index_lm_n.quotient, range_m);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_ij_k.remainder;
+		size_t l = index_l_m.quotient;
+		size_t m = index_l_m.remainder;
+		size_t start_n = tile_index_lm_n.remainder * tile_n;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l, m, start_n, min(range_n - start_n, tile_n));
+			start_n += tile_n;
+			if (start_n >= range_n) {
+				start_n = 0;
+				if (++m == range_m.value) {
+					m = 0;
+					if (++l == range_l) {
+						l = 0;
+						if (++k == range_k.value) {
+							k = 0;
+							if (++j == range_j.value) {
+								j = 0;
+								i += 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static void thread_parallelize_6d_tile_2d(struct pthreadpool* threadpool, struct thread_info* thread) {
+	assert(threadpool != NULL);
+	assert(thread != NULL);
+
+	const pthreadpool_task_6d_tile_2d_t task = (pthreadpool_task_6d_tile_2d_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	const struct fxdiv_divisor_size_t tile_range_mn = threadpool->params.parallelize_6d_tile_2d.tile_range_mn;
+	const struct fxdiv_divisor_size_t range_kl = threadpool->params.parallelize_6d_tile_2d.range_kl;
+	const struct fxdiv_divisor_size_t tile_range_n = threadpool->params.parallelize_6d_tile_2d.tile_range_n;
+	const struct fxdiv_divisor_size_t range_j = threadpool->params.parallelize_6d_tile_2d.range_j;
+	const struct fxdiv_divisor_size_t range_l = threadpool->params.parallelize_6d_tile_2d.range_l;
+	const size_t tile_m = threadpool->params.parallelize_6d_tile_2d.tile_m;
+	const size_t tile_n = threadpool->params.parallelize_6d_tile_2d.tile_n;
+	const size_t range_n = threadpool->params.parallelize_6d_tile_2d.range_n;
+	const size_t range_m = threadpool->params.parallelize_6d_tile_2d.range_m;
+	const size_t range_k = threadpool->params.parallelize_6d_tile_2d.range_k;
+
+	/* Process thread's own range of items, then ranges stolen from other threads */
+	do {
+		const size_t range_start = pthreadpool_load_relaxed_size_t(&thread->range_start);
+		const struct fxdiv_result_size_t tile_index_ijkl_mn = fxdiv_divide_size_t(range_start, tile_range_mn);
+		const struct fxdiv_result_size_t index_ij_kl = fxdiv_divide_size_t(tile_index_ijkl_mn.quotient, range_kl);
+		const struct fxdiv_result_size_t tile_index_m_n = fxdiv_divide_size_t(tile_index_ijkl_mn.remainder, tile_range_n);
+		const struct fxdiv_result_size_t index_i_j = fxdiv_divide_size_t(index_ij_kl.quotient, range_j);
+		const struct fxdiv_result_size_t index_k_l = fxdiv_divide_size_t(index_ij_kl.remainder, range_l);
+		size_t i = index_i_j.quotient;
+		size_t j = index_i_j.remainder;
+		size_t k = index_k_l.quotient;
+		size_t l = index_k_l.remainder;
+		size_t start_m = tile_index_m_n.quotient * tile_m;
+		size_t start_n = tile_index_m_n.remainder * tile_n;
+
+		while (pthreadpool_try_decrement_relaxed_size_t(&thread->range_length)) {
+			pthreadpool_check_urgent_jobs(threadpool, thread);
+			task(argument, i, j, k, l, start_m, start_n, min(range_m - start_m, tile_m), min(range_n - start_n, tile_n));
+			start_n += tile_n;
+			if (start_n >= range_n) {
+				start_n = 0;
+				start_m += tile_m;
+				if (start_m >= range_m) {
+					start_m = 0;
+					if (++l == range_l.value) {
+						l = 0;
+						if (++k == range_k) {
+							k = 0;
+							if (++j == range_j.value) {
+								j = 0;
+								i += 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	} while (pthreadpool_steal_range(threadpool, thread));
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+static thread_function_t prepare_parallelize_1d(size_t threads_count, size_t range) {
+	thread_function_t parallelize_1d = &thread_parallelize_1d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (range < range_threshold) {
+			parallelize_1d = &pthreadpool_thread_parallelize_1d_fastpath;
+		}
+	#else
+		(void) threads_count;
+		(void) range;
+	#endif
+	return parallelize_1d;
+}
+
+void pthreadpool_parallelize_1d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		pthreadpool_parallelize(
+			threadpool, prepare_parallelize_1d(threads_count, range), NULL, 0,
+			(void*) task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_with_thread(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_with_thread_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
 		for (size_t i = 0; i < range; i++) {
 			task(argument, 0, i);
 		}
@@ -1641,30 +2594,648 @@ void pthreadpool_parallelize_1d_with_thread(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		thread_function_t parallelize_1d_with_thread = &thread_parallelize_1d_with_thread;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_1d_with_thread = &pthreadpool_thread_parallelize_1d_with_thread_fastpath;
-			}
-		#endif
+		thread_function_t parallelize_1d_with_thread = &thread_parallelize_1d_with_thread;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d_with_thread = &pthreadpool_thread_parallelize_1d_with_thread_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_with_thread, NULL, 0,
+			(void*) task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_with_uarch(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_with_id_t task,
+	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, uarch_index, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const struct pthreadpool_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+		};
+		thread_function_t parallelize_1d_with_uarch = &thread_parallelize_1d_with_uarch;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_1d_with_uarch = &pthreadpool_thread_parallelize_1d_with_uarch_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_with_uarch, &params, sizeof(params),
+			task, argument, range, flags);
+	}
+}
+
+static thread_function_t prepare_parallelize_1d_tile_1d(
+	size_t threads_count,
+	size_t range,
+	size_t tile,
+	union pthreadpool_params* params,
+	size_t* params_size,
+	size_t* tile_range)
+{
+	*tile_range = divide_round_up(range, tile);
+	params->parallelize_1d_tile_1d = (struct pthreadpool_1d_tile_1d_params) {
+		.range = range,
+		.tile = tile,
+	};
+	*params_size = sizeof(params->parallelize_1d_tile_1d);
+	thread_function_t parallelize_1d_tile_1d = &thread_parallelize_1d_tile_1d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (range < range_threshold) {
+			parallelize_1d_tile_1d = &pthreadpool_thread_parallelize_1d_tile_1d_fastpath;
+		}
+	#else
+		(void) threads_count;
+	#endif
+	return parallelize_1d_tile_1d;
+}
+
+void pthreadpool_parallelize_1d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i += tile) {
+			task(argument, i, min(range - i, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		union pthreadpool_params params;
+		size_t params_size, tile_range;
+		const thread_function_t parallelize_1d_tile_1d =
+			prepare_parallelize_1d_tile_1d(threads_count, range, tile, &params, &params_size, &tile_range);
+		pthreadpool_parallelize(
+			threadpool, parallelize_1d_tile_1d, &params, params_size,
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_with_grain(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	size_t grain,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= max(grain, 1)) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			task(argument, i);
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		if (grain == 0) {
+			/* Split the initial range of each thread into about 32 claims */
+			grain = max(range / (threads_count * 32), 1);
+		}
+		const struct pthreadpool_1d_with_grain_params params = {
+			.grain = grain,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_with_grain, &params, sizeof(params),
+			(void*) task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_1d_reduce(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_reduce_t task,
+	pthreadpool_combine_t combine,
+	void* argument,
+	const void* identity,
+	void* result,
+	size_t value_size,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	size_t threads_count;
+	size_t partial_stride = 0;
+	void* buffer = NULL;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && range > tile) {
+		/* Per-thread partial results on separate cache lines, followed by arrival counters of the combining tree */
+		partial_stride = divide_round_up(max(value_size, 1), PTHREADPOOL_CACHELINE_SIZE) * PTHREADPOOL_CACHELINE_SIZE;
+		buffer = malloc(threads_count * (partial_stride + sizeof(pthreadpool_atomic_size_t)) + PTHREADPOOL_CACHELINE_SIZE - 1);
+	}
+
+	if (buffer == NULL) {
+		/* No thread pool used, or no memory for partial results: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		memcpy(result, identity, value_size);
+		for (size_t i = 0; i < range; i += tile) {
+			task(argument, result, i, min(range - i, tile));
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		char* partials = (char*) (((uintptr_t) buffer + PTHREADPOOL_CACHELINE_SIZE - 1) & -(uintptr_t) PTHREADPOOL_CACHELINE_SIZE);
+		pthreadpool_atomic_size_t* arrivals = (pthreadpool_atomic_size_t*) (partials + threads_count * partial_stride);
+		for (size_t tid = 1; tid < threads_count; tid++) {
+			pthreadpool_store_relaxed_size_t(&arrivals[tid], 2);
+		}
+
+		const struct pthreadpool_1d_reduce_params params = {
+			.range = range,
+			.tile = tile,
+			.combine = combine,
+			.identity = identity,
+			.value_size = value_size,
+			.partial_stride = partial_stride,
+			.partials = partials,
+			.arrivals = arrivals,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_reduce, &params, sizeof(params),
+			(void*) task, argument, divide_round_up(range, tile), flags);
+
+		memcpy(result, partials, value_size);
+		free(buffer);
+	}
+}
+
+size_t pthreadpool_parallelize_1d_find_first(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_predicate_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	size_t first_index = range;
+	if (threadpool == NULL || threadpool->threads_count.value <= 1 || range <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range; i++) {
+			if (task(argument, i)) {
+				first_index = i;
+				break;
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		pthreadpool_atomic_size_t shared_first_index;
+		pthreadpool_store_relaxed_size_t(&shared_first_index, range);
+
+		const struct pthreadpool_1d_find_first_params params = {
+			.first_index = &shared_first_index,
+		};
+		pthreadpool_parallelize(
+			threadpool, &thread_parallelize_1d_find_first, &params, sizeof(params),
+			(void*) task, argument, range, flags);
+
+		first_index = pthreadpool_load_relaxed_size_t(&shared_first_index);
+	}
+	return first_index;
+}
+
+static thread_function_t prepare_parallelize_2d(
+	size_t threads_count,
+	size_t range_i,
+	size_t range_j,
+	union pthreadpool_params* params,
+	size_t* params_size,
+	size_t* range)
+{
+	*range = range_i * range_j;
+	params->parallelize_2d = (struct pthreadpool_2d_params) {
+		.range_j = fxdiv_init_size_t(range_j),
+	};
+	*params_size = sizeof(params->parallelize_2d);
+	thread_function_t parallelize_2d = &thread_parallelize_2d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (*range < range_threshold) {
+			parallelize_2d = &pthreadpool_thread_parallelize_2d_fastpath;
+		}
+	#else
+		(void) threads_count;
+	#endif
+	return parallelize_2d;
+}
+
+void pthreadpool_parallelize_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				task(argument, i, j);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		union pthreadpool_params params;
+		size_t params_size, range;
+		const thread_function_t parallelize_2d =
+			prepare_parallelize_2d(threads_count, range_i, range_j, &params, &params_size, &range);
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d, &params, params_size,
+			task, argument, range, flags);
+	}
+}
+
+void pthreadpool_parallelize_2d_with_thread(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_with_thread_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				task(argument, 0, i, j);
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t range = range_i * range_j;
+		const struct pthreadpool_2d_params params = {
+			.range_j = fxdiv_init_size_t(range_j),
+		};
+		thread_function_t parallelize_2d_with_thread = &thread_parallelize_2d_with_thread;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (range < range_threshold) {
+				parallelize_2d_with_thread = &pthreadpool_thread_parallelize_2d_with_thread_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d_with_thread, &params, sizeof(params),
+			task, argument, range, flags);
+	}
+}
+
+static thread_function_t prepare_parallelize_2d_tile_1d(
+	size_t threads_count,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	union pthreadpool_params* params,
+	size_t* params_size,
+	size_t* tile_range)
+{
+	const size_t tile_range_j = divide_round_up(range_j, tile_j);
+	*tile_range = range_i * tile_range_j;
+	params->parallelize_2d_tile_1d = (struct pthreadpool_2d_tile_1d_params) {
+		.range_j = range_j,
+		.tile_j = tile_j,
+		.tile_range_j = fxdiv_init_size_t(tile_range_j),
+	};
+	*params_size = sizeof(params->parallelize_2d_tile_1d);
+	thread_function_t parallelize_2d_tile_1d = &thread_parallelize_2d_tile_1d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (*tile_range < range_threshold) {
+			parallelize_2d_tile_1d = &pthreadpool_thread_parallelize_2d_tile_1d_fastpath;
+		}
+	#else
+		(void) threads_count;
+	#endif
+	return parallelize_2d_tile_1d;
+}
+
+void pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, i, j, min(range_j - j, tile_j));
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		union pthreadpool_params params;
+		size_t params_size, tile_range;
+		const thread_function_t parallelize_2d_tile_1d =
+			prepare_parallelize_2d_tile_1d(threads_count, range_i, range_j, tile_j, &params, &params_size, &tile_range);
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d_tile_1d, &params, params_size,
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_with_id_t task,
+	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, uarch_index, i, j, min(range_j - j, tile_j));
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		};
+		thread_function_t parallelize_2d_tile_1d_with_uarch = &thread_parallelize_2d_tile_1d_with_uarch;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d_tile_1d_with_uarch, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_with_id_with_thread_t task,
+	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, uarch_index, 0, i, j, min(range_j - j, tile_j));
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		};
+		thread_function_t parallelize_2d_tile_1d_with_uarch_with_thread = &thread_parallelize_2d_tile_1d_with_uarch_with_thread;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+static thread_function_t prepare_parallelize_2d_tile_2d(
+	size_t threads_count,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags,
+	union pthreadpool_params* params,
+	size_t* params_size,
+	size_t* tile_range)
+{
+	const size_t tile_range_i = divide_round_up(range_i, tile_i);
+	const size_t tile_range_j = divide_round_up(range_j, tile_j);
+	*tile_range = tile_range_i * tile_range_j;
+	if (flags & PTHREADPOOL_FLAG_TILE_ORDER_MORTON) {
+		params->parallelize_2d_tile_2d_morton = (struct pthreadpool_2d_tile_2d_morton_params) {
+			.range_i = range_i,
+			.tile_i = tile_i,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_i = tile_range_i,
+			.tile_range_j = tile_range_j,
+			.morton_size = morton_curve_size(tile_range_i, tile_range_j),
+		};
+		*params_size = sizeof(params->parallelize_2d_tile_2d_morton);
+		return &thread_parallelize_2d_tile_2d_morton;
+	}
+	params->parallelize_2d_tile_2d = (struct pthreadpool_2d_tile_2d_params) {
+		.range_i = range_i,
+		.tile_i = tile_i,
+		.range_j = range_j,
+		.tile_j = tile_j,
+		.tile_range_j = fxdiv_init_size_t(tile_range_j),
+	};
+	*params_size = sizeof(params->parallelize_2d_tile_2d);
+	thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (*tile_range < range_threshold) {
+			parallelize_2d_tile_2d = &pthreadpool_thread_parallelize_2d_tile_2d_fastpath;
+		}
+	#else
+		(void) threads_count;
+	#endif
+	return parallelize_2d_tile_2d;
+}
+
+void pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i += tile_i) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		union pthreadpool_params params;
+		size_t params_size, tile_range;
+		const thread_function_t parallelize_2d_tile_2d = prepare_parallelize_2d_tile_2d(
+			threads_count, range_i, range_j, tile_i, tile_j, flags, &params, &params_size, &tile_range);
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_with_thread, NULL, 0,
-			(void*) task, argument, range, flags);
+			threadpool, parallelize_2d_tile_2d, &params, params_size,
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_1d_with_uarch(
+void pthreadpool_parallelize_2d_tile_2d_with_uarch(
 	pthreadpool_t threadpool,
-	pthreadpool_task_1d_with_id_t task,
+	pthreadpool_task_2d_tile_2d_with_id_t task,
 	void* argument,
 	uint32_t default_uarch_index,
 	uint32_t max_uarch_index,
-	size_t range,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 
 		uint32_t uarch_index = default_uarch_index;
@@ -1680,81 +3251,148 @@ void pthreadpool_parallelize_1d_with_uarch(
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range; i++) {
-			task(argument, uarch_index, i);
+		for (size_t i = 0; i < range_i; i += tile_i) {
+			for (size_t j = 0; j < range_j; j += tile_j) {
+				task(argument, uarch_index, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const struct pthreadpool_1d_with_uarch_params params = {
+		const size_t tile_range_i = divide_round_up(range_i, tile_i);
+		const size_t tile_range_j = divide_round_up(range_j, tile_j);
+		const size_t tile_range = tile_range_i * tile_range_j;
+		const struct pthreadpool_2d_tile_2d_with_uarch_params params = {
 			.default_uarch_index = default_uarch_index,
 			.max_uarch_index = max_uarch_index,
+			.range_i = range_i,
+			.tile_i = tile_i,
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.tile_range_j = fxdiv_init_size_t(tile_range_j),
 		};
-		thread_function_t parallelize_1d_with_uarch = &thread_parallelize_1d_with_uarch;
+		thread_function_t parallelize_2d_tile_2d_with_uarch = &thread_parallelize_2d_tile_2d_with_uarch;
+		#if PTHREADPOOL_USE_FASTPATH
+			const size_t range_threshold = -threads_count;
+			if (tile_range < range_threshold) {
+				parallelize_2d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_2d_with_uarch_fastpath;
+			}
+		#endif
+		pthreadpool_parallelize(
+			threadpool, parallelize_2d_tile_2d_with_uarch, &params, sizeof(params),
+			task, argument, tile_range, flags);
+	}
+}
+
+void pthreadpool_parallelize_3d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_3d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t range_k,
+	uint32_t flags)
+{
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k) <= 1) {
+		/* No thread pool used: execute task sequentially on the calling thread */
+		struct fpu_state saved_fpu_state = { 0 };
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			saved_fpu_state = get_fpu_state();
+			disable_fpu_denormals();
+		}
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k++) {
+					task(argument, i, j, k);
+				}
+			}
+		}
+		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+			set_fpu_state(saved_fpu_state);
+		}
+	} else {
+		const size_t range = range_i * range_j * range_k;
+		const struct pthreadpool_3d_params params = {
+			.range_j = fxdiv_init_size_t(range_j),
+			.range_k = fxdiv_init_size_t(range_k),
+		};
+		thread_function_t parallelize_3d = &thread_parallelize_3d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (range < range_threshold) {
-				parallelize_1d_with_uarch = &pthreadpool_thread_parallelize_1d_with_uarch_fastpath;
+				parallelize_3d = &pthreadpool_thread_parallelize_3d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_3d, &params, sizeof(params),
 			task, argument, range, flags);
 	}
 }
 
-void pthreadpool_parallelize_1d_tile_1d(
+void pthreadpool_parallelize_3d_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_1d_tile_1d_t task,
+	pthreadpool_task_3d_tile_1d_t task,
 	void* argument,
-	size_t range,
-	size_t tile,
+	size_t range_i,
+	size_t range_j,
+	size_t range_k,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || range <= tile) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range; i += tile) {
-			task(argument, i, min(range - i, tile));
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, i, j, k, min(range_k - k, tile_k));
+				}
+			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range = divide_round_up(range, tile);
-		const struct pthreadpool_1d_tile_1d_params params = {
-			.range = range,
-			.tile = tile,
+		const size_t tile_range_k = divide_round_up(range_k, tile_k);
+		const size_t tile_range = range_i * range_j * tile_range_k;
+		const struct pthreadpool_3d_tile_1d_params params = {
+			.range_k = range_k,
+			.tile_k = tile_k,
+			.range_j = fxdiv_init_size_t(range_j),
+			.tile_range_k = fxdiv_init_size_t(tile_range_k),
 		};
-		thread_function_t parallelize_1d_tile_1d = &thread_parallelize_1d_tile_1d;
+		thread_function_t parallelize_3d_tile_1d = &thread_parallelize_3d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_1d_tile_1d = &pthreadpool_thread_parallelize_1d_tile_1d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_3d_tile_1d = &pthreadpool_thread_parallelize_3d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_1d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d(
+void pthreadpool_parallelize_3d_tile_1d_with_thread(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_t task,
+	pthreadpool_task_3d_tile_1d_with_thread_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
+	size_t range_k,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -1763,41 +3401,60 @@ void pthreadpool_parallelize_2d(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				task(argument, i, j);
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, 0, i, j, k, min(range_k - k, tile_k));
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j;
-		const struct pthreadpool_2d_params params = {
+		const size_t tile_range_k = divide_round_up(range_k, tile_k);
+		const size_t tile_range = range_i * range_j * tile_range_k;
+		const struct pthreadpool_3d_tile_1d_params params = {
+			.range_k = range_k,
+			.tile_k = tile_k,
 			.range_j = fxdiv_init_size_t(range_j),
+			.tile_range_k = fxdiv_init_size_t(tile_range_k),
 		};
-		thread_function_t parallelize_2d = &thread_parallelize_2d;
+		thread_function_t parallelize_3d_tile_1d_with_thread = &thread_parallelize_3d_tile_1d_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_2d = &pthreadpool_thread_parallelize_2d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_3d_tile_1d_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_3d_tile_1d_with_thread, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_with_thread(
+void pthreadpool_parallelize_3d_tile_1d_with_uarch(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_with_thread_t task,
+	pthreadpool_task_3d_tile_1d_with_id_t task,
 	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t range_k,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -1805,99 +3462,165 @@ void pthreadpool_parallelize_2d_with_thread(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				task(argument, 0, i, j);
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, uarch_index, i, j, k, min(range_k - k, tile_k));
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j;
-		const struct pthreadpool_2d_params params = {
+		const size_t tile_range_k = divide_round_up(range_k, tile_k);
+		const size_t tile_range = range_i * range_j * tile_range_k;
+		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_k = range_k,
+			.tile_k = tile_k,
 			.range_j = fxdiv_init_size_t(range_j),
+			.tile_range_k = fxdiv_init_size_t(tile_range_k),
 		};
-		thread_function_t parallelize_2d_with_thread = &thread_parallelize_2d_with_thread;
+		thread_function_t parallelize_3d_tile_1d_with_uarch = &thread_parallelize_3d_tile_1d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_2d_with_thread = &pthreadpool_thread_parallelize_2d_with_thread_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_3d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_with_thread, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_3d_tile_1d_with_uarch, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d(
+void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_t task,
+	pthreadpool_task_3d_tile_1d_with_id_with_thread_t task,
 	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
-	size_t tile_j,
+	size_t range_k,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
 		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, i, j, min(range_j - j, tile_j));
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, uarch_index, 0, i, j, k, min(range_k - k, tile_k));
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_params params = {
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		const size_t tile_range_k = divide_round_up(range_k, tile_k);
+		const size_t tile_range = range_i * range_j * tile_range_k;
+		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
+			.range_k = range_k,
+			.tile_k = tile_k,
+			.range_j = fxdiv_init_size_t(range_j),
+			.tile_range_k = fxdiv_init_size_t(tile_range_k),
 		};
-		thread_function_t parallelize_2d_tile_1d = &thread_parallelize_2d_tile_1d;
+		thread_function_t parallelize_3d_tile_1d_with_uarch_with_thread = &thread_parallelize_3d_tile_1d_with_uarch_with_thread;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d = &pthreadpool_thread_parallelize_2d_tile_1d_fastpath;
+				parallelize_3d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d_with_uarch(
+static thread_function_t prepare_parallelize_3d_tile_2d(
+	size_t threads_count,
+	size_t range_i,
+	size_t range_j,
+	size_t range_k,
+	size_t tile_j,
+	size_t tile_k,
+	uint32_t flags,
+	union pthreadpool_params* params,
+	size_t* params_size,
+	size_t* tile_range)
+{
+	const size_t tile_range_j = divide_round_up(range_j, tile_j);
+	const size_t tile_range_k = divide_round_up(range_k, tile_k);
+	*tile_range = range_i * tile_range_j * tile_range_k;
+	if (flags & PTHREADPOOL_FLAG_TILE_ORDER_MORTON) {
+		params->parallelize_3d_tile_2d_morton = (struct pthreadpool_3d_tile_2d_morton_params) {
+			.range_j = range_j,
+			.tile_j = tile_j,
+			.range_k = range_k,
+			.tile_k = tile_k,
+			.tile_range_j = tile_range_j,
+			.tile_range_k = tile_range_k,
+			.morton_size = morton_curve_size(tile_range_j, tile_range_k),
+			.tile_range_jk = fxdiv_init_size_t(tile_range_j * tile_range_k),
+		};
+		*params_size = sizeof(params->parallelize_3d_tile_2d_morton);
+		return &thread_parallelize_3d_tile_2d_morton;
+	}
+	params->parallelize_3d_tile_2d = (struct pthreadpool_3d_tile_2d_params) {
+		.range_j = range_j,
+		.tile_j = tile_j,
+		.range_k = range_k,
+		.tile_k = tile_k,
+		.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		.tile_range_k = fxdiv_init_size_t(tile_range_k),
+	};
+	*params_size = sizeof(params->parallelize_3d_tile_2d);
+	thread_function_t parallelize_3d_tile_2d = &thread_parallelize_3d_tile_2d;
+	#if PTHREADPOOL_USE_FASTPATH
+		const size_t range_threshold = -threads_count;
+		if (*tile_range < range_threshold) {
+			parallelize_3d_tile_2d = &pthreadpool_thread_parallelize_3d_tile_2d_fastpath;
+		}
+	#else
+		(void) threads_count;
+	#endif
+	return parallelize_3d_tile_2d;
+}
+
+void pthreadpool_parallelize_3d_tile_2d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_t task,
+	pthreadpool_task_3d_tile_2d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t range_k,
 	size_t tile_j,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -1905,48 +3628,40 @@ void pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, uarch_index, i, j, min(range_j - j, tile_j));
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, i, j, k, min(range_j - j, tile_j), min(range_k - k, tile_k));
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-		};
-		thread_function_t parallelize_2d_tile_1d_with_uarch = &thread_parallelize_2d_tile_1d_with_uarch;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_fastpath;
-			}
-		#endif
+		union pthreadpool_params params;
+		size_t params_size, tile_range;
+		const thread_function_t parallelize_3d_tile_2d = prepare_parallelize_3d_tile_2d(
+			threads_count, range_i, range_j, range_k, tile_j, tile_k, flags, &params, &params_size, &tile_range);
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_2d, &params, params_size,
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+void pthreadpool_parallelize_3d_tile_2d_with_uarch(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_1d_with_id_with_thread_t task,
+	pthreadpool_task_3d_tile_2d_with_id_t task,
 	void* argument,
 	uint32_t default_uarch_index,
 	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
+	size_t range_k,
 	size_t tile_j,
+	size_t tile_k,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 
 		uint32_t uarch_index = default_uarch_index;
@@ -1964,7 +3679,9 @@ void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, uarch_index, 0, i, j, min(range_j - j, tile_j));
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					task(argument, uarch_index, i, j, k, min(range_j - j, tile_j), min(range_k - k, tile_k));
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -1972,151 +3689,153 @@ void pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		}
 	} else {
 		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_1d_with_uarch_params params = {
+		const size_t tile_range_k = divide_round_up(range_k, tile_k);
+		const size_t tile_range = range_i * tile_range_j * tile_range_k;
+		const struct pthreadpool_3d_tile_2d_with_uarch_params params = {
 			.default_uarch_index = default_uarch_index,
 			.max_uarch_index = max_uarch_index,
 			.range_j = range_j,
 			.tile_j = tile_j,
+			.range_k = range_k,
+			.tile_k = tile_k,
 			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+			.tile_range_k = fxdiv_init_size_t(tile_range_k),
 		};
-		thread_function_t parallelize_2d_tile_1d_with_uarch_with_thread = &thread_parallelize_2d_tile_1d_with_uarch_with_thread;
+		thread_function_t parallelize_3d_tile_2d_with_uarch = &thread_parallelize_3d_tile_2d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_2d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_2d_tile_1d_with_uarch_with_thread_fastpath;
+				parallelize_3d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_2d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
+			threadpool, parallelize_3d_tile_2d_with_uarch, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_2d(
+void pthreadpool_parallelize_4d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_2d_t task,
+	pthreadpool_task_4d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
-	size_t tile_i,
-	size_t tile_j,
+	size_t range_k,
+	size_t range_l,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i += tile_i) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l++) {
+						task(argument, i, j, k, l);
+					}
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_i = divide_round_up(range_i, tile_i);
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = tile_range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_2d_params params = {
-			.range_i = range_i,
-			.tile_i = tile_i,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		const size_t range_kl = range_k * range_l;
+		const size_t range = range_i * range_j * range_kl;
+		const struct pthreadpool_4d_params params = {
+			.range_k = range_k,
+			.range_j = fxdiv_init_size_t(range_j),
+			.range_kl = fxdiv_init_size_t(range_kl),
+			.range_l = fxdiv_init_size_t(range_l),
 		};
-		thread_function_t parallelize_2d_tile_2d = &thread_parallelize_2d_tile_2d;
+		thread_function_t parallelize_4d = &thread_parallelize_4d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_2d_tile_2d = &pthreadpool_thread_parallelize_2d_tile_2d_fastpath;
+			if (range < range_threshold) {
+				parallelize_4d = &pthreadpool_thread_parallelize_4d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, parallelize_4d, &params, sizeof(params),
+			task, argument, range, flags);
 	}
 }
 
-void pthreadpool_parallelize_2d_tile_2d_with_uarch(
+void pthreadpool_parallelize_4d_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_2d_tile_2d_with_id_t task,
+	pthreadpool_task_4d_tile_1d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
-	size_t tile_i,
-	size_t tile_j,
+	size_t range_k,
+	size_t range_l,
+	size_t tile_l,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= tile_i && range_j <= tile_j)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i += tile_i) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				task(argument, uarch_index, i, j, min(range_i - i, tile_i), min(range_j - j, tile_j));
+		for (size_t i = 0; i < range_i; i++) {
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l += tile_l) {
+						task(argument, i, j, k, l, min(range_l - l, tile_l));
+					}
+				}
 			}
 		}
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_i = divide_round_up(range_i, tile_i);
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range = tile_range_i * tile_range_j;
-		const struct pthreadpool_2d_tile_2d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_i = range_i,
-			.tile_i = tile_i,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
+		const size_t tile_range_l = divide_round_up(range_l, tile_l);
+		const size_t tile_range_kl = range_k * tile_range_l;
+		const size_t tile_range = range_i * range_j * tile_range_kl;
+		const struct pthreadpool_4d_tile_1d_params params = {
+			.range_k = range_k,
+			.range_l = range_l,
+			.tile_l = tile_l,
+			.range_j = fxdiv_init_size_t(range_j),
+			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
+			.tile_range_l = fxdiv_init_size_t(tile_range_l),
 		};
-		thread_function_t parallelize_2d_tile_2d_with_uarch = &thread_parallelize_2d_tile_2d_with_uarch;
+		thread_function_t parallelize_4d_tile_1d = &thread_parallelize_4d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_2d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_2d_tile_2d_with_uarch_fastpath;
+				parallelize_4d_tile_1d = &pthreadpool_thread_parallelize_4d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_2d_tile_2d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_4d_tile_1d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d(
+void pthreadpool_parallelize_4d_tile_2d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_t task,
+	pthreadpool_task_4d_tile_2d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
+	size_t range_l,
+	size_t tile_k,
+	size_t tile_l,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -2125,8 +3844,11 @@ void pthreadpool_parallelize_3d(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					task(argument, i, j, k);
+				for (size_t k = 0; k < range_k; k += tile_k) {
+					for (size_t l = 0; l < range_l; l += tile_l) {
+						task(argument, i, j, k, l,
+							min(range_k - k, tile_k), min(range_l - l, tile_l));
+					}
 				}
 			}
 		}
@@ -2134,37 +3856,57 @@ void pthreadpool_parallelize_3d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range = range_i * range_j * range_k;
-		const struct pthreadpool_3d_params params = {
+		const size_t tile_range_l = divide_round_up(range_l, tile_l);
+		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
+		const size_t tile_range = range_i * range_j * tile_range_kl;
+		const struct pthreadpool_4d_tile_2d_params params = {
+			.range_k = range_k,
+			.tile_k = tile_k,
+			.range_l = range_l,
+			.tile_l = tile_l,
 			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
+			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
+			.tile_range_l = fxdiv_init_size_t(tile_range_l),
 		};
-		thread_function_t parallelize_3d = &thread_parallelize_3d;
+		thread_function_t parallelize_4d_tile_2d = &thread_parallelize_4d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_3d = &pthreadpool_thread_parallelize_3d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_4d_tile_2d = &pthreadpool_thread_parallelize_4d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_4d_tile_2d, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_1d(
+void pthreadpool_parallelize_4d_tile_2d_with_uarch(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_1d_t task,
+	pthreadpool_task_4d_tile_2d_with_id_t task,
 	void* argument,
+	uint32_t default_uarch_index,
+	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
+	size_t range_l,
 	size_t tile_k,
+	size_t tile_l,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
+
+		uint32_t uarch_index = default_uarch_index;
+		#if PTHREADPOOL_USE_CPUINFO
+			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
+			if (uarch_index > max_uarch_index) {
+				uarch_index = default_uarch_index;
+			}
+		#endif
+
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -2173,7 +3915,10 @@ void pthreadpool_parallelize_3d_tile_1d(
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
 				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, i, j, k, min(range_k - k, tile_k));
+					for (size_t l = 0; l < range_l; l += tile_l) {
+						task(argument, uarch_index, i, j, k, l,
+							min(range_k - k, tile_k), min(range_l - l, tile_l));
+					}
 				}
 			}
 		}
@@ -2181,39 +3926,46 @@ void pthreadpool_parallelize_3d_tile_1d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_params params = {
+		const size_t tile_range_l = divide_round_up(range_l, tile_l);
+		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
+		const size_t tile_range = range_i * range_j * tile_range_kl;
+		const struct pthreadpool_4d_tile_2d_with_uarch_params params = {
+			.default_uarch_index = default_uarch_index,
+			.max_uarch_index = max_uarch_index,
 			.range_k = range_k,
 			.tile_k = tile_k,
+			.range_l = range_l,
+			.tile_l = tile_l,
 			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
+			.tile_range_l = fxdiv_init_size_t(tile_range_l),
 		};
-		thread_function_t parallelize_3d_tile_1d = &thread_parallelize_3d_tile_1d;
+		thread_function_t parallelize_4d_tile_2d_with_uarch = &thread_parallelize_4d_tile_2d_with_uarch;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d = &pthreadpool_thread_parallelize_3d_tile_1d_fastpath;
+				parallelize_4d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_4d_tile_2d_with_uarch_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d, &params, sizeof(params),
+			threadpool, parallelize_4d_tile_2d_with_uarch, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_1d_with_thread(
+void pthreadpool_parallelize_5d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_1d_with_thread_t task,
+	pthreadpool_task_5d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t tile_k,
+	size_t range_l,
+	size_t range_m,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -2222,8 +3974,12 @@ void pthreadpool_parallelize_3d_tile_1d_with_thread(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, 0, i, j, k, min(range_k - k, tile_k));
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l++) {
+						for (size_t m = 0; m < range_m; m++) {
+							task(argument, i, j, k, l, m);
+						}
+					}
 				}
 			}
 		}
@@ -2231,51 +3987,43 @@ void pthreadpool_parallelize_3d_tile_1d_with_thread(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_params params = {
-			.range_k = range_k,
-			.tile_k = tile_k,
+		const size_t range_lm = range_l * range_m;
+		const size_t range = range_i * range_j * range_k * range_lm;
+		const struct pthreadpool_5d_params params = {
+			.range_l = range_l,
 			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+			.range_k = fxdiv_init_size_t(range_k),
+			.range_lm = fxdiv_init_size_t(range_lm),
+			.range_m = fxdiv_init_size_t(range_m),
 		};
-		thread_function_t parallelize_3d_tile_1d_with_thread = &thread_parallelize_3d_tile_1d_with_thread;
+		thread_function_t parallelize_5d = &thread_parallelize_5d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_thread_fastpath;
+			if (range < range_threshold) {
+				parallelize_5d = &pthreadpool_thread_parallelize_5d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_thread, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, parallelize_5d, &params, sizeof(params),
+			task, argument, range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_1d_with_uarch(
+void pthreadpool_parallelize_5d_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_1d_with_id_t task,
+	pthreadpool_task_5d_tile_1d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t tile_k,
+	size_t range_l,
+	size_t range_m,
+	size_t tile_m,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -2283,8 +4031,12 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, uarch_index, i, j, k, min(range_k - k, tile_k));
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l++) {
+						for (size_t m = 0; m < range_m; m += tile_m) {
+							task(argument, i, j, k, l, m, min(range_m - m, tile_m));
+						}
+					}
 				}
 			}
 		}
@@ -2292,53 +4044,47 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
+		const size_t tile_range_m = divide_round_up(range_m, tile_m);
+		const size_t range_kl = range_k * range_l;
+		const size_t tile_range = range_i * range_j * range_kl * tile_range_m;
+		const struct pthreadpool_5d_tile_1d_params params = {
 			.range_k = range_k,
-			.tile_k = tile_k,
+			.range_m = range_m,
+			.tile_m = tile_m,
 			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+			.range_kl = fxdiv_init_size_t(range_kl),
+			.range_l = fxdiv_init_size_t(range_l),
+			.tile_range_m = fxdiv_init_size_t(tile_range_m),
 		};
-		thread_function_t parallelize_3d_tile_1d_with_uarch = &thread_parallelize_3d_tile_1d_with_uarch;
+		thread_function_t parallelize_5d_tile_1d = &thread_parallelize_5d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_fastpath;
+				parallelize_5d_tile_1d = &pthreadpool_thread_parallelize_5d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_5d_tile_1d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+void pthreadpool_parallelize_5d_tile_2d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_1d_with_id_with_thread_t task,
+	pthreadpool_task_5d_tile_2d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t tile_k,
+	size_t range_l,
+	size_t range_m,
+	size_t tile_l,
+	size_t tile_m,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l && range_m <= tile_m)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
@@ -2346,8 +4092,13 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		}
 		for (size_t i = 0; i < range_i; i++) {
 			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, uarch_index, 0, i, j, k, min(range_k - k, tile_k));
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l += tile_l) {
+						for (size_t m = 0; m < range_m; m += tile_m) {
+							task(argument, i, j, k, l, m,
+								min(range_l - l, tile_l), min(range_m - m, tile_m));
+						}
+					}
 				}
 			}
 		}
@@ -2355,42 +4106,46 @@ void pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_1d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_k = range_k,
-			.tile_k = tile_k,
+		const size_t tile_range_m = divide_round_up(range_m, tile_m);
+		const size_t tile_range_lm = divide_round_up(range_l, tile_l) * tile_range_m;
+		const size_t tile_range = range_i * range_j * range_k * tile_range_lm;
+		const struct pthreadpool_5d_tile_2d_params params = {
+			.range_l = range_l,
+			.tile_l = tile_l,
+			.range_m = range_m,
+			.tile_m = tile_m,
 			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+			.range_k = fxdiv_init_size_t(range_k),
+			.tile_range_lm = fxdiv_init_size_t(tile_range_lm),
+			.tile_range_m = fxdiv_init_size_t(tile_range_m),
 		};
-		thread_function_t parallelize_3d_tile_1d_with_uarch_with_thread = &thread_parallelize_3d_tile_1d_with_uarch_with_thread;
+		thread_function_t parallelize_5d_tile_2d = &thread_parallelize_5d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_1d_with_uarch_with_thread = &pthreadpool_thread_parallelize_3d_tile_1d_with_uarch_with_thread_fastpath;
+				parallelize_5d_tile_2d = &pthreadpool_thread_parallelize_5d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_1d_with_uarch_with_thread, &params, sizeof(params),
+			threadpool, parallelize_5d_tile_2d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_2d(
+void pthreadpool_parallelize_6d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_2d_t task,
+	pthreadpool_task_6d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t tile_j,
-	size_t tile_k,
+	size_t range_l,
+	size_t range_m,
+	size_t range_n,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m | range_n) <= 1) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -2398,9 +4153,15 @@ void pthreadpool_parallelize_3d_tile_2d(
 			disable_fpu_denormals();
 		}
 		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, i, j, k, min(range_j - j, tile_j), min(range_k - k, tile_k));
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l++) {
+						for (size_t m = 0; m < range_m; m++) {
+							for (size_t n = 0; n < range_n; n++) {
+								task(argument, i, j, k, l, m, n);
+							}
+						}
+					}
 				}
 			}
 		}
@@ -2408,64 +4169,60 @@ void pthreadpool_parallelize_3d_tile_2d(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * tile_range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_2d_params params = {
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+		const size_t range_lmn = range_l * range_m * range_n;
+		const size_t range = range_i * range_j * range_k * range_lmn;
+		const struct pthreadpool_6d_params params = {
+			.range_l = range_l,
+			.range_j = fxdiv_init_size_t(range_j),
+			.range_k = fxdiv_init_size_t(range_k),
+			.range_lmn = fxdiv_init_size_t(range_lmn),
+			.range_m = fxdiv_init_size_t(range_m),
+			.range_n = fxdiv_init_size_t(range_n),
 		};
-		thread_function_t parallelize_3d_tile_2d = &thread_parallelize_3d_tile_2d;
+		thread_function_t parallelize_6d = &thread_parallelize_6d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_3d_tile_2d = &pthreadpool_thread_parallelize_3d_tile_2d_fastpath;
+			if (range < range_threshold) {
+				parallelize_6d = &pthreadpool_thread_parallelize_6d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, parallelize_6d, &params, sizeof(params),
+			task, argument, range, flags);
 	}
 }
 
-void pthreadpool_parallelize_3d_tile_2d_with_uarch(
+void pthreadpool_parallelize_6d_tile_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_3d_tile_2d_with_id_t task,
+	pthreadpool_task_6d_tile_1d_t task,
 	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t tile_j,
-	size_t tile_k,
+	size_t range_l,
+	size_t range_m,
+	size_t range_n,
+	size_t tile_n,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i <= 1 && range_j <= tile_j && range_k <= tile_k)) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l | range_m) <= 1 && range_n <= tile_n)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
-
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
-
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
 		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j += tile_j) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					task(argument, uarch_index, i, j, k, min(range_j - j, tile_j), min(range_k - k, tile_k));
+			for (size_t j = 0; j < range_j; j++) {
+				for (size_t k = 0; k < range_k; k++) {
+					for (size_t l = 0; l < range_l; l++) {
+						for (size_t m = 0; m < range_m; m++) {
+							for (size_t n = 0; n < range_n; n += tile_n) {
+								task(argument, i, j, k, l, m, n, min(range_n - n, tile_n));
+							}
+						}
+					}
 				}
 			}
 		}
@@ -2473,44 +4230,48 @@ void pthreadpool_parallelize_3d_tile_2d_with_uarch(
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t tile_range_j = divide_round_up(range_j, tile_j);
-		const size_t tile_range_k = divide_round_up(range_k, tile_k);
-		const size_t tile_range = range_i * tile_range_j * tile_range_k;
-		const struct pthreadpool_3d_tile_2d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_j = range_j,
-			.tile_j = tile_j,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.tile_range_j = fxdiv_init_size_t(tile_range_j),
-			.tile_range_k = fxdiv_init_size_t(tile_range_k),
+		const size_t tile_range_n = divide_round_up(range_n, tile_n);
+		const size_t tile_range_lmn = range_l * range_m * tile_range_n;
+		const size_t tile_range = range_i * range_j * range_k * tile_range_lmn;
+		const struct pthreadpool_6d_tile_1d_params params = {
+			.range_l = range_l,
+			.range_n = range_n,
+			.tile_n = tile_n,
+			.range_j = fxdiv_init_size_t(range_j),
+			.range_k = fxdiv_init_size_t(range_k),
+			.tile_range_lmn = fxdiv_init_size_t(tile_range_lmn),
+			.range_m = fxdiv_init_size_t(range_m),
+			.tile_range_n = fxdiv_init_size_t(tile_range_n),
 		};
-		thread_function_t parallelize_3d_tile_2d_with_uarch = &thread_parallelize_3d_tile_2d_with_uarch;
+		thread_function_t parallelize_6d_tile_1d = &thread_parallelize_6d_tile_1d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
 			if (tile_range < range_threshold) {
-				parallelize_3d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_3d_tile_2d_with_uarch_fastpath;
+				parallelize_6d_tile_1d = &pthreadpool_thread_parallelize_6d_tile_1d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_3d_tile_2d_with_uarch, &params, sizeof(params),
+			threadpool, parallelize_6d_tile_1d, &params, sizeof(params),
 			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_4d(
+void pthreadpool_parallelize_6d_tile_2d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_4d_t task,
+	pthreadpool_task_6d_tile_2d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
 	size_t range_l,
+	size_t range_m,
+	size_t range_n,
+	size_t tile_m,
+	size_t tile_n,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l) <= 1) {
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m && range_n <= tile_n)) {
 		/* No thread pool used: execute task sequentially on the calling thread */
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -2521,7 +4282,12 @@ void pthreadpool_parallelize_4d(
 			for (size_t j = 0; j < range_j; j++) {
 				for (size_t k = 0; k < range_k; k++) {
 					for (size_t l = 0; l < range_l; l++) {
-						task(argument, i, j, k, l);
+						for (size_t m = 0; m < range_m; m += tile_m) {
+							for (size_t n = 0; n < range_n; n += tile_n) {
+								task(argument, i, j, k, l, m, n,
+									min(range_m - m, tile_m), min(range_n - n, tile_n));
+							}
+						}
 					}
 				}
 			}
@@ -2531,581 +4297,935 @@ void pthreadpool_parallelize_4d(
 		}
 	} else {
 		const size_t range_kl = range_k * range_l;
-		const size_t range = range_i * range_j * range_kl;
-		const struct pthreadpool_4d_params params = {
+		const size_t tile_range_n = divide_round_up(range_n, tile_n);
+		const size_t tile_range_mn = divide_round_up(range_m, tile_m) * tile_range_n;
+		const size_t tile_range = range_i * range_j * range_kl * tile_range_mn;
+		const struct pthreadpool_6d_tile_2d_params params = {
 			.range_k = range_k,
+			.range_m = range_m,
+			.tile_m = tile_m,
+			.range_n = range_n,
+			.tile_n = tile_n,
 			.range_j = fxdiv_init_size_t(range_j),
 			.range_kl = fxdiv_init_size_t(range_kl),
 			.range_l = fxdiv_init_size_t(range_l),
+			.tile_range_mn = fxdiv_init_size_t(tile_range_mn),
+			.tile_range_n = fxdiv_init_size_t(tile_range_n),
 		};
-		thread_function_t parallelize_4d = &thread_parallelize_4d;
+		thread_function_t parallelize_6d_tile_2d = &thread_parallelize_6d_tile_2d;
 		#if PTHREADPOOL_USE_FASTPATH
 			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_4d = &pthreadpool_thread_parallelize_4d_fastpath;
+			if (tile_range < range_threshold) {
+				parallelize_6d_tile_2d = &pthreadpool_thread_parallelize_6d_tile_2d_fastpath;
 			}
 		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_4d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, parallelize_6d_tile_2d, &params, sizeof(params),
+			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_4d_tile_1d(
+static struct pthreadpool_plan* allocate_plan(
+	struct pthreadpool* threadpool,
+	void (*run_sequentially)(const struct pthreadpool_plan* plan),
+	void* task,
+	void* argument,
+	uint32_t flags)
+{
+	const size_t threads_count = threadpool != NULL ? threadpool->threads_count.value : 0;
+	struct pthreadpool_plan* plan = malloc(sizeof(struct pthreadpool_plan) + threads_count * sizeof(struct pthreadpool_range));
+	if (plan == NULL) {
+		return NULL;
+	}
+	memset(plan, 0, sizeof(struct pthreadpool_plan));
+	plan->threadpool = threadpool;
+	plan->run_sequentially = run_sequentially;
+	plan->task = task;
+	plan->argument = argument;
+	plan->flags = flags;
+	return plan;
+}
+
+static void init_plan_ranges(struct pthreadpool_plan* plan, thread_function_t thread_function, size_t linear_range) {
+	plan->thread_function = thread_function;
+	plan->linear_range = linear_range;
+	plan->threads_count = plan->threadpool->threads_count;
+	compute_initial_ranges(plan->threadpool, plan->threads_count, linear_range, plan->ranges);
+}
+
+static void run_plan_1d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_1d(NULL,
+		(pthreadpool_task_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_1d(
 	pthreadpool_t threadpool,
-	pthreadpool_task_4d_tile_1d_t task,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_1d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range;
+
+	size_t threads_count;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && range > 1) {
+		init_plan_ranges(plan, prepare_parallelize_1d(threads_count, range), range);
+	}
+	return plan;
+}
+
+static void run_plan_1d_tile_1d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_1d_tile_1d(NULL,
+		(pthreadpool_task_1d_tile_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->tile[0], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_1d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_1d_tile_1d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range;
+	plan->tile[0] = tile;
+
+	size_t threads_count;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && range > tile) {
+		size_t tile_range;
+		const thread_function_t thread_function =
+			prepare_parallelize_1d_tile_1d(threads_count, range, tile, &plan->params, &plan->params_size, &tile_range);
+		init_plan_ranges(plan, thread_function, tile_range);
+	}
+	return plan;
+}
+
+static void run_plan_2d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d(NULL,
+		(pthreadpool_task_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_2d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range_i;
+	plan->range[1] = range_j;
+
+	size_t threads_count;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && (range_i | range_j) > 1) {
+		size_t range;
+		const thread_function_t thread_function =
+			prepare_parallelize_2d(threads_count, range_i, range_j, &plan->params, &plan->params_size, &range);
+		init_plan_ranges(plan, thread_function, range);
+	}
+	return plan;
+}
+
+static void run_plan_2d_tile_1d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d_tile_1d(NULL,
+		(pthreadpool_task_2d_tile_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->tile[0], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_2d_tile_1d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_2d_tile_1d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range_i;
+	plan->range[1] = range_j;
+	plan->tile[0] = tile_j;
+
+	size_t threads_count;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && (range_i > 1 || range_j > tile_j)) {
+		size_t tile_range;
+		const thread_function_t thread_function = prepare_parallelize_2d_tile_1d(
+			threads_count, range_i, range_j, tile_j, &plan->params, &plan->params_size, &tile_range);
+		init_plan_ranges(plan, thread_function, tile_range);
+	}
+	return plan;
+}
+
+static void run_plan_2d_tile_2d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d_tile_2d(NULL,
+		(pthreadpool_task_2d_tile_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->tile[0], plan->tile[1], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_2d_tile_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_2d_tile_2d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range_i;
+	plan->range[1] = range_j;
+	plan->tile[0] = tile_i;
+	plan->tile[1] = tile_j;
+
+	size_t threads_count;
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && (range_i > tile_i || range_j > tile_j)) {
+		size_t tile_range;
+		const thread_function_t thread_function = prepare_parallelize_2d_tile_2d(
+			threads_count, range_i, range_j, tile_i, tile_j, flags, &plan->params, &plan->params_size, &tile_range);
+		init_plan_ranges(plan, thread_function, tile_range);
+	}
+	return plan;
+}
+
+static void run_plan_3d_tile_2d_sequentially(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_3d_tile_2d(NULL,
+		(pthreadpool_task_3d_tile_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->range[2], plan->tile[0], plan->tile[1], plan->flags);
+}
+
+pthreadpool_plan_t pthreadpool_create_plan_3d_tile_2d(
+	pthreadpool_t threadpool,
+	pthreadpool_task_3d_tile_2d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t range_l,
-	size_t tile_l,
+	size_t tile_j,
+	size_t tile_k,
 	uint32_t flags)
 {
+	struct pthreadpool_plan* plan = allocate_plan(threadpool, &run_plan_3d_tile_2d_sequentially, (void*) task, argument, flags);
+	if (plan == NULL) {
+		return NULL;
+	}
+	plan->range[0] = range_i;
+	plan->range[1] = range_j;
+	plan->range[2] = range_k;
+	plan->tile[0] = tile_j;
+	plan->tile[1] = tile_k;
+
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l += tile_l) {
-						task(argument, i, j, k, l, min(range_l - l, tile_l));
-					}
-				}
-			}
-		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+	if (threadpool != NULL && (threads_count = threadpool->threads_count.value) > 1 && (range_i > 1 || range_j > tile_j || range_k > tile_k)) {
+		size_t tile_range;
+		const thread_function_t thread_function = prepare_parallelize_3d_tile_2d(
+			threads_count, range_i, range_j, range_k, tile_j, tile_k, flags, &plan->params, &plan->params_size, &tile_range);
+		init_plan_ranges(plan, thread_function, tile_range);
+	}
+	return plan;
+}
+
+void pthreadpool_set_plan_max_threads(pthreadpool_plan_t plan, size_t max_threads) {
+	if (plan->thread_function != NULL) {
+		const size_t pool_threads_count = plan->threadpool->threads_count.value;
+		const size_t threads_count = max_threads != 0 ? min(max_threads, pool_threads_count) : pool_threads_count;
+		plan->threads_count = fxdiv_init_size_t(threads_count);
+		compute_initial_ranges(plan->threadpool, plan->threads_count, plan->linear_range, plan->ranges);
+	}
+}
+
+/*
+ * Runs a plan as a job with threads_count thread slots. Only as many sleeping workers as the job has thread slots for
+ * helpers wake up, and the job doesn't wait for other commands.
+ */
+static void run_plan_as_job(
+	const struct pthreadpool_plan* plan,
+	struct fxdiv_divisor_size_t threads_count,
+	const struct pthreadpool_range* ranges,
+	struct caller_slot_stats* caller_stats)
+{
+	struct pthreadpool* threadpool = plan->threadpool;
+	if (is_nested_call(threadpool)) {
+		/* Nested computations run at the priority of the task which calls them */
+		run_job(
+			threadpool, &current_thread->nested_slot, 1, threads_count, false /* wake helpers */,
+			plan->thread_function, &plan->params, plan->params_size, plan->task, plan->argument,
+			plan->linear_range, ranges, plan->flags & ~PTHREADPOOL_FLAG_HIGH_PRIORITY, caller_stats);
+	} else {
+		size_t job_slots_count;
+		struct pthreadpool_job_slot* job_slots = get_concurrent_slots(threadpool, &job_slots_count);
+		run_job(
+			threadpool, job_slots, job_slots_count, threads_count, true /* wake helpers */,
+			plan->thread_function, &plan->params, plan->params_size,
+			plan->task, plan->argument, plan->linear_range, ranges, plan->flags, caller_stats);
+	}
+}
+
+/*
+ * Chooses the number of threads for the next run of an adaptive plan: as many as get at least
+ * PTHREADPOOL_ADAPTIVE_THREAD_WORK_NS of the estimated work each, but no more than the thread limit of the plan.
+ */
+static size_t choose_adaptive_threads_count(const struct pthreadpool_plan* plan, size_t item_cost) {
+	if (item_cost == 0) {
+		/* No estimate before the first run */
+		return plan->threads_count.value;
+	}
+
+	const double work_ns = (double) plan->linear_range * (double) item_cost * 1.0e-3;
+	const double threads_count = work_ns / (double) PTHREADPOOL_ADAPTIVE_THREAD_WORK_NS;
+	if (threads_count < 2.0) {
+		return 1;
+	}
+	return threads_count < (double) plan->threads_count.value ? (size_t) threads_count : plan->threads_count.value;
+}
+
+/*
+ * Runs a plan with PTHREADPOOL_FLAG_ADAPTIVE_THREADS on the number of threads which suits its estimated work, and
+ * refines the estimate of the item cost from the time the calling thread spent per item.
+ */
+static void run_adaptive_plan(struct pthreadpool_plan* plan) {
+	const size_t item_cost = pthreadpool_load_relaxed_size_t(&plan->item_cost);
+	const size_t threads_count = choose_adaptive_threads_count(plan, item_cost);
+
+	struct caller_slot_stats caller_stats;
+	if (threads_count == 1) {
+		const uint64_t start_time = pthreadpool_get_time_ns();
+		plan->run_sequentially(plan);
+		caller_stats.time_ns = pthreadpool_get_time_ns() - start_time;
+		caller_stats.processed_items = plan->linear_range;
+	} else if (threads_count == plan->threads_count.value) {
+		run_plan_as_job(plan, plan->threads_count, plan->ranges, &caller_stats);
+	} else {
+		/* Precomputed ranges are for a different number of threads: split the range evenly */
+		run_plan_as_job(plan, fxdiv_init_size_t(threads_count), NULL, &caller_stats);
+	}
+
+	if (caller_stats.processed_items != 0) {
+		/* Exponential moving average, so that the estimate follows gradual changes in the cost of items */
+		const double measured_cost = (double) caller_stats.time_ns * 1.0e3 / (double) caller_stats.processed_items;
+		const double estimated_cost = item_cost == 0 ? measured_cost : 0.75 * (double) item_cost + 0.25 * measured_cost;
+		/* Zero means no estimate: round the cost of nearly free items up to 1 picosecond */
+		const size_t new_item_cost = estimated_cost < 1.0 ? 1 :
+			estimated_cost < (double) SIZE_MAX ? (size_t) estimated_cost : SIZE_MAX;
+		pthreadpool_store_relaxed_size_t(&plan->item_cost, new_item_cost);
+	}
+}
+
+void pthreadpool_run_plan(pthreadpool_plan_t plan) {
+	if (plan->thread_function == NULL || plan->threads_count.value == 1) {
+		plan->run_sequentially(plan);
+	} else if (plan->flags & PTHREADPOOL_FLAG_ADAPTIVE_THREADS) {
+		run_adaptive_plan(plan);
+	} else if (plan->threads_count.value < plan->threadpool->threads_count.value ||
+		plan->threadpool->team_threadpool != NULL || (plan->flags & PTHREADPOOL_FLAG_HIGH_PRIORITY))
+	{
+		/* Computations of teams, high-priority computations, and computations on fewer threads run as jobs */
+		run_plan_as_job(plan, plan->threads_count, plan->ranges, NULL /* caller stats */);
+	} else {
+		/* Divisors, parameters, and work ranges are precomputed: only copy them into the thread pool */
+		if (is_nested_call(plan->threadpool)) {
+			parallelize_nested(
+				plan->threadpool, plan->thread_function, &plan->params, plan->params_size,
+				plan->task, plan->argument, plan->linear_range, plan->ranges, plan->flags);
+		} else {
+			pthreadpool_parallelize_with_ranges(
+				plan->threadpool, plan->thread_function, &plan->params, plan->params_size,
+				plan->task, plan->argument, plan->linear_range, plan->ranges, plan->flags);
 		}
+	}
+}
+
+void pthreadpool_destroy_plan(pthreadpool_plan_t plan) {
+	free(plan);
+}
+
+/*
+ * Starts an asynchronous computation of a plan as a job, published in one of the concurrent job slots of the thread
+ * pool. No thread slot of the job is reserved for the calling thread: woken up workers may process all of them.
+ */
+static struct pthreadpool_async* start_async(
+	struct pthreadpool_plan* plan,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	struct pthreadpool_async* async = malloc(sizeof(struct pthreadpool_async));
+	if (async == NULL) {
+		return NULL;
+	}
+	memset(async, 0, sizeof(struct pthreadpool_async));
+	async->callback = callback;
+	async->callback_context = callback_context;
+
+	struct pthreadpool* threadpool = plan->threadpool;
+	struct pthreadpool* job = NULL;
+	if (plan->thread_function != NULL && plan->threads_count.value > 1) {
+		job = pthreadpool_allocate(plan->threads_count.value);
+	}
+	if (job == NULL) {
+		/* The plan runs on the calling thread, or memory is short: complete the computation before returning */
+		pthreadpool_run_plan(plan);
+		if (callback != NULL) {
+			callback(callback_context);
+		}
+		pthreadpool_store_release_uint32_t(&async->completed, 1);
+		return async;
+	}
+
+	init_job(
+		job, threadpool, plan->threads_count,
+		plan->thread_function, &plan->params, plan->params_size, plan->task, plan->argument,
+		plan->linear_range, plan->ranges, plan->flags);
+	job->async = async;
+	async->job = job;
+	pthreadpool_store_relaxed_size_t(&async->pending_slots, plan->threads_count.value);
+
+	size_t job_slots_count;
+	struct pthreadpool_job_slot* job_slots = get_concurrent_slots(threadpool, &job_slots_count);
+	async->job_slot = publish_job(job_slots, job_slots_count, job);
+	if (async->job_slot != NULL) {
+		wake_job_helpers(threadpool, async->job_slot, plan->threads_count.value);
 	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = range_k * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_1d_params params = {
-			.range_k = range_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
-		thread_function_t parallelize_4d_tile_1d = &thread_parallelize_4d_tile_1d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_4d_tile_1d = &pthreadpool_thread_parallelize_4d_tile_1d_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_1d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+		/* All concurrent job slots are taken: process the job on the calling thread */
+		run_remaining_job_slots(job);
+	}
+	return async;
+}
+
+/* Starts an asynchronous computation of a plan created for this call only, then destroys the plan */
+static struct pthreadpool_async* start_async_once(
+	struct pthreadpool_plan* plan,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	if (plan == NULL) {
+		return NULL;
 	}
+	struct pthreadpool_async* async = start_async(plan, callback, callback_context);
+	pthreadpool_destroy_plan(plan);
+	return async;
+}
+
+pthreadpool_async_t pthreadpool_run_plan_async(
+	pthreadpool_plan_t plan,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async(plan, callback, callback_context);
+}
+
+pthreadpool_async_t pthreadpool_parallelize_1d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async_once(
+		pthreadpool_create_plan_1d(threadpool, task, argument, range, flags),
+		callback, callback_context);
+}
+
+pthreadpool_async_t pthreadpool_parallelize_1d_tile_1d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async_once(
+		pthreadpool_create_plan_1d_tile_1d(threadpool, task, argument, range, tile, flags),
+		callback, callback_context);
+}
+
+pthreadpool_async_t pthreadpool_parallelize_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async_once(
+		pthreadpool_create_plan_2d(threadpool, task, argument, range_i, range_j, flags),
+		callback, callback_context);
+}
+
+pthreadpool_async_t pthreadpool_parallelize_2d_tile_1d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_1d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async_once(
+		pthreadpool_create_plan_2d_tile_1d(threadpool, task, argument, range_i, range_j, tile_j, flags),
+		callback, callback_context);
+}
+
+pthreadpool_async_t pthreadpool_parallelize_2d_tile_2d_async(
+	pthreadpool_t threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	return start_async_once(
+		pthreadpool_create_plan_2d_tile_2d(threadpool, task, argument, range_i, range_j, tile_i, tile_j, flags),
+		callback, callback_context);
 }
 
-void pthreadpool_parallelize_4d_tile_2d(
+pthreadpool_async_t pthreadpool_parallelize_3d_tile_2d_async(
 	pthreadpool_t threadpool,
-	pthreadpool_task_4d_tile_2d_t task,
+	pthreadpool_task_3d_tile_2d_t task,
 	void* argument,
 	size_t range_i,
 	size_t range_j,
 	size_t range_k,
-	size_t range_l,
+	size_t tile_j,
 	size_t tile_k,
-	size_t tile_l,
-	uint32_t flags)
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
 {
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
+	return start_async_once(
+		pthreadpool_create_plan_3d_tile_2d(threadpool, task, argument, range_i, range_j, range_k, tile_j, tile_k, flags),
+		callback, callback_context);
+}
+
+bool pthreadpool_test_async(pthreadpool_async_t async) {
+	return pthreadpool_load_acquire_uint32_t(&async->completed) != 0;
+}
+
+void pthreadpool_wait_async(pthreadpool_async_t async) {
+	struct pthreadpool_job_slot* job_slot = async->job_slot;
+	if (job_slot != NULL) {
+		/* Stop accepting helpers, and process the thread slots which no worker took yet */
+		pthreadpool_subtract_fetch_relaxed_size_t(&job_slot->state, 1);
+		run_remaining_job_slots(async->job);
+
+		/* Helpers leave the job after they processed their thread slots, the last one completing the computation */
+		unpublish_job(async->job, job_slot);
+		async->job_slot = NULL;
+	}
+	assert(pthreadpool_load_relaxed_uint32_t(&async->completed) != 0);
+}
+
+void pthreadpool_destroy_async(pthreadpool_async_t async) {
+	if (async != NULL) {
+		pthreadpool_wait_async(async);
+		if (async->job != NULL) {
+			pthreadpool_deallocate(async->job);
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					for (size_t l = 0; l < range_l; l += tile_l) {
-						task(argument, i, j, k, l,
-							min(range_k - k, tile_k), min(range_l - l, tile_l));
-					}
-				}
-			}
+		free(async);
+	}
+}
+
+pthreadpool_graph_t pthreadpool_create_graph(pthreadpool_t threadpool) {
+	struct pthreadpool_graph* graph = malloc(sizeof(struct pthreadpool_graph));
+	if (graph == NULL) {
+		return NULL;
+	}
+	memset(graph, 0, sizeof(struct pthreadpool_graph));
+	graph->threadpool = threadpool;
+	return graph;
+}
+
+size_t pthreadpool_add_graph_node(pthreadpool_graph_t graph, pthreadpool_plan_t plan) {
+	if (plan->thread_function != NULL && plan->threadpool != graph->threadpool) {
+		return SIZE_MAX;
+	}
+
+	if (graph->nodes_count == graph->nodes_capacity) {
+		const size_t nodes_capacity = max(graph->nodes_capacity * 2, 4);
+		struct pthreadpool_graph_node* nodes = realloc(graph->nodes, nodes_capacity * sizeof(struct pthreadpool_graph_node));
+		if (nodes == NULL) {
+			return SIZE_MAX;
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+		graph->nodes = nodes;
+		graph->nodes_capacity = nodes_capacity;
+	}
+
+	struct pthreadpool_graph_node* node = &graph->nodes[graph->nodes_count];
+	memset(node, 0, sizeof(struct pthreadpool_graph_node));
+	node->plan = plan;
+	if (plan->thread_function != NULL && plan->threads_count.value > 1) {
+		/* The thread limit of the plan may change before the graph runs: size the job for any limit */
+		node->job = pthreadpool_allocate(graph->threadpool->threads_count.value);
+		if (node->job == NULL) {
+			return SIZE_MAX;
 		}
-	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_2d_params params = {
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
-		thread_function_t parallelize_4d_tile_2d = &thread_parallelize_4d_tile_2d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_4d_tile_2d = &pthreadpool_thread_parallelize_4d_tile_2d_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
 	}
+	graph->flags |= plan->flags & PTHREADPOOL_FLAG_YIELD_WORKERS;
+	return graph->nodes_count++;
 }
 
-void pthreadpool_parallelize_4d_tile_2d_with_uarch(
-	pthreadpool_t threadpool,
-	pthreadpool_task_4d_tile_2d_with_id_t task,
-	void* argument,
-	uint32_t default_uarch_index,
-	uint32_t max_uarch_index,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t tile_k,
-	size_t tile_l,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j) <= 1 && range_k <= tile_k && range_l <= tile_l)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
+bool pthreadpool_add_graph_edge(pthreadpool_graph_t graph, size_t predecessor, size_t successor) {
+	/* Edges only point to nodes added later, so the graph has no cycles */
+	if (predecessor >= successor || successor >= graph->nodes_count) {
+		return false;
+	}
 
-		uint32_t uarch_index = default_uarch_index;
-		#if PTHREADPOOL_USE_CPUINFO
-			uarch_index = cpuinfo_get_current_uarch_index_with_default(default_uarch_index);
-			if (uarch_index > max_uarch_index) {
-				uarch_index = default_uarch_index;
-			}
-		#endif
+	struct pthreadpool_graph_node* node = &graph->nodes[predecessor];
+	if (node->successors_count == node->successors_capacity) {
+		const size_t successors_capacity = max(node->successors_capacity * 2, 4);
+		size_t* successors = realloc(node->successors, successors_capacity * sizeof(size_t));
+		if (successors == NULL) {
+			return false;
+		}
+		node->successors = successors;
+		node->successors_capacity = successors_capacity;
+	}
+	node->successors[node->successors_count++] = successor;
+	graph->nodes[successor].predecessors_count += 1;
+	return true;
+}
 
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
+/* Processes one slot of a node, and releases its successors if this was the last slot of the node to complete */
+static void run_graph_node_slot(struct pthreadpool_graph* graph, struct pthreadpool_graph_node* node, size_t slot) {
+	if (node->slots_count > 1) {
+		run_job_slot(node->job, slot);
+	} else {
+		node->plan->run_sequentially(node->plan);
+	}
+
+	if (pthreadpool_decrement_fetch_acquire_release_size_t(&node->pending_slots) == 0) {
+		for (size_t i = 0; i < node->successors_count; i++) {
+			pthreadpool_decrement_fetch_release_size_t(&graph->nodes[node->successors[i]].pending_predecessors);
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k += tile_k) {
-					for (size_t l = 0; l < range_l; l += tile_l) {
-						task(argument, uarch_index, i, j, k, l,
-							min(range_k - k, tile_k), min(range_l - l, tile_l));
-					}
-				}
+		pthreadpool_decrement_fetch_release_size_t(&graph->pending_nodes);
+		/* Successors of the node may be ready now, or the graph completed: wake up the threads waiting for either */
+		if (graph->threadpool != NULL) {
+			pthreadpool_notify_change(get_workers_threadpool(graph->threadpool), &graph->progress);
+		}
+	}
+}
+
+/*
+ * Processes slots of the nodes whose predecessors completed, in topological order, until all nodes of the graph
+ * complete. Threads wait only while every slot of the ready nodes is claimed by other threads: they spin for a while,
+ * then sleep until a node completes.
+ */
+static void run_graph_nodes(struct pthreadpool_graph* graph) {
+	const size_t nodes_count = graph->nodes_count;
+	/* Nodes before first_node have all their slots claimed */
+	size_t first_node = 0;
+	for (;;) {
+		/* Read the progress counter first: nodes which complete later advance it, and end the wait */
+		const uint32_t progress = pthreadpool_load_acquire_uint32_t(&graph->progress);
+		if (pthreadpool_load_acquire_size_t(&graph->pending_nodes) == 0) {
+			break;
+		}
+
+		bool claimed = false;
+		for (size_t i = first_node; i < nodes_count; i++) {
+			struct pthreadpool_graph_node* node = &graph->nodes[i];
+			if (pthreadpool_load_acquire_size_t(&node->pending_predecessors) != 0) {
+				continue;
+			}
+			const size_t slot = claim_slot(&node->claimed_slots, node->slots_count);
+			if (slot < node->slots_count) {
+				run_graph_node_slot(graph, node, slot);
+				claimed = true;
+				break;
+			}
+			if (i == first_node) {
+				first_node += 1;
 			}
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+		if (!claimed) {
+			/* Threads wait only if other threads process the claimed slots, so the graph has a thread pool */
+			pthreadpool_wait_for_change(get_workers_threadpool(graph->threadpool), &graph->progress, progress, graph->flags);
 		}
-	} else {
-		const size_t tile_range_l = divide_round_up(range_l, tile_l);
-		const size_t tile_range_kl = divide_round_up(range_k, tile_k) * tile_range_l;
-		const size_t tile_range = range_i * range_j * tile_range_kl;
-		const struct pthreadpool_4d_tile_2d_with_uarch_params params = {
-			.default_uarch_index = default_uarch_index,
-			.max_uarch_index = max_uarch_index,
-			.range_k = range_k,
-			.tile_k = tile_k,
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.tile_range_kl = fxdiv_init_size_t(tile_range_kl),
-			.tile_range_l = fxdiv_init_size_t(tile_range_l),
-		};
-		thread_function_t parallelize_4d_tile_2d_with_uarch = &thread_parallelize_4d_tile_2d_with_uarch;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_4d_tile_2d_with_uarch = &pthreadpool_thread_parallelize_4d_tile_2d_with_uarch_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_4d_tile_2d_with_uarch, &params, sizeof(params),
-			task, argument, tile_range, flags);
 	}
 }
 
-void pthreadpool_parallelize_5d(
-	pthreadpool_t threadpool,
-	pthreadpool_task_5d_t task,
-	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m) <= 1) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l++) {
-						for (size_t m = 0; m < range_m; m++) {
-							task(argument, i, j, k, l, m);
-						}
-					}
-				}
+static void thread_run_graph(struct pthreadpool* threadpool, struct thread_info* thread) {
+	/* Threads claim the slots of the graph nodes dynamically, regardless of their thread number */
+	(void) thread;
+
+	struct pthreadpool_graph* graph = (struct pthreadpool_graph*) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	run_graph_nodes(graph);
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
+}
+
+void pthreadpool_run_graph(pthreadpool_graph_t graph) {
+	if (graph->nodes_count == 0) {
+		return;
+	}
+
+	/* Reset the per-run state of the nodes */
+	struct pthreadpool* threadpool = graph->threadpool;
+	for (size_t i = 0; i < graph->nodes_count; i++) {
+		struct pthreadpool_graph_node* node = &graph->nodes[i];
+		const struct pthreadpool_plan* plan = node->plan;
+		/* Use the current thread limit of the plan, which may have changed since the node was added */
+		node->slots_count = 1;
+		if (plan->thread_function != NULL && plan->threads_count.value > 1) {
+			if (node->job == NULL) {
+				node->job = pthreadpool_allocate(threadpool->threads_count.value);
+			}
+			/* Without memory for the job, the node runs on a single thread */
+			if (node->job != NULL) {
+				init_job(
+					node->job, threadpool, plan->threads_count,
+					plan->thread_function, &plan->params, plan->params_size, plan->task, plan->argument,
+					plan->linear_range, plan->ranges, plan->flags);
+				node->slots_count = plan->threads_count.value;
 			}
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
-		}
+		pthreadpool_store_relaxed_size_t(&node->claimed_slots, 0);
+		pthreadpool_store_relaxed_size_t(&node->pending_slots, node->slots_count);
+		pthreadpool_store_relaxed_size_t(&node->pending_predecessors, node->predecessors_count);
+	}
+	pthreadpool_store_relaxed_size_t(&graph->pending_nodes, graph->nodes_count);
+	pthreadpool_store_relaxed_uint32_t(&graph->progress, 0);
+
+	size_t threads_count;
+	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1) {
+		run_graph_nodes(graph);
 	} else {
-		const size_t range_lm = range_l * range_m;
-		const size_t range = range_i * range_j * range_k * range_lm;
-		const struct pthreadpool_5d_params params = {
-			.range_l = range_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.range_lm = fxdiv_init_size_t(range_lm),
-			.range_m = fxdiv_init_size_t(range_m),
-		};
-		thread_function_t parallelize_5d = &thread_parallelize_5d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_5d = &pthreadpool_thread_parallelize_5d_fastpath;
-			}
-		#endif
+		/* All threads process the graph in a single command: successors start without a round trip to the caller */
 		pthreadpool_parallelize(
-			threadpool, parallelize_5d, &params, sizeof(params),
-			task, argument, range, flags);
+			threadpool, &thread_run_graph, NULL, 0,
+			(void*) graph, NULL, threads_count, 0 /* flags */);
 	}
 }
 
-void pthreadpool_parallelize_5d_tile_1d(
-	pthreadpool_t threadpool,
-	pthreadpool_task_5d_tile_1d_t task,
-	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	size_t tile_m,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l++) {
-						for (size_t m = 0; m < range_m; m += tile_m) {
-							task(argument, i, j, k, l, m, min(range_m - m, tile_m));
-						}
-					}
-				}
+void pthreadpool_destroy_graph(pthreadpool_graph_t graph) {
+	if (graph != NULL) {
+		for (size_t i = 0; i < graph->nodes_count; i++) {
+			if (graph->nodes[i].job != NULL) {
+				pthreadpool_deallocate(graph->nodes[i].job);
 			}
+			free(graph->nodes[i].successors);
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
-		}
-	} else {
-		const size_t tile_range_m = divide_round_up(range_m, tile_m);
-		const size_t range_kl = range_k * range_l;
-		const size_t tile_range = range_i * range_j * range_kl * tile_range_m;
-		const struct pthreadpool_5d_tile_1d_params params = {
-			.range_k = range_k,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_kl = fxdiv_init_size_t(range_kl),
-			.range_l = fxdiv_init_size_t(range_l),
-			.tile_range_m = fxdiv_init_size_t(tile_range_m),
-		};
-		thread_function_t parallelize_5d_tile_1d = &thread_parallelize_5d_tile_1d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_5d_tile_1d = &pthreadpool_thread_parallelize_5d_tile_1d_fastpath;
+		free(graph->nodes);
+		free(graph);
+	}
+}
+
+/*
+ * Runs the plans from the current plan of the batch onwards on the calling thread until a plan which the thread pool can
+ * process, and prepares the thread pool for that plan.
+ */
+static void start_batch_plan(struct pthreadpool* threadpool, struct pthreadpool_batch* batch, size_t plan_index) {
+	for (; plan_index < batch->plans_count; plan_index++) {
+		const struct pthreadpool_plan* plan = batch->plans[plan_index];
+		if (plan->thread_function != NULL && plan->threadpool == threadpool) {
+			pthreadpool_store_relaxed_void_p(&threadpool->task, plan->task);
+			pthreadpool_store_relaxed_void_p(&threadpool->argument, plan->argument);
+			pthreadpool_store_relaxed_uint32_t(&threadpool->flags, plan->flags);
+			if (plan->params_size != 0) {
+				memcpy(&threadpool->params, &plan->params, plan->params_size);
 			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_5d_tile_1d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			pthreadpool_partition_range(threadpool, plan->linear_range, plan->ranges, plan->flags);
+			/* Threads beyond the thread limit of the plan wait at the next barrier */
+			for (size_t tid = plan->threads_count.value; tid < threadpool->threads_count.value; tid++) {
+				pthreadpool_store_relaxed_uint32_t(&threadpool->threads[tid].out_of_work, 1);
+			}
+			break;
+		}
+		/* Other threads wait at the barrier while plans which don't use the thread pool run */
+		plan->run_sequentially(plan);
 	}
+	batch->plan_index = plan_index;
 }
 
-void pthreadpool_parallelize_5d_tile_2d(
-	pthreadpool_t threadpool,
-	pthreadpool_task_5d_tile_2d_t task,
-	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	size_t tile_l,
-	size_t tile_m,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k) <= 1 && range_l <= tile_l && range_m <= tile_m)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
+static void thread_run_batch(struct pthreadpool* threadpool, struct thread_info* thread) {
+	struct pthreadpool_batch* batch = (struct pthreadpool_batch*) pthreadpool_load_relaxed_void_p(&threadpool->task);
+
+	if (threadpool->parent != NULL) {
+		/*
+		 * The batch runs as a job because another command occupies the thread pool. Thread slots of a job may run one
+		 * after another on the same thread, so they can't wait for each other at a barrier: run the plans one by one.
+		 */
+		if (thread->thread_number == 0) {
+			for (size_t i = 0; i < batch->plans_count; i++) {
+				pthreadpool_run_plan(batch->plans[i]);
+			}
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l += tile_l) {
-						for (size_t m = 0; m < range_m; m += tile_m) {
-							task(argument, i, j, k, l, m,
-								min(range_l - l, tile_l), min(range_m - m, tile_m));
-						}
-					}
-				}
+		return;
+	}
+
+	const size_t threads_count = threadpool->threads_count.value;
+	size_t generation = 0;
+	for (;;) {
+		/* The last thread to arrive at the barrier starts the next plan, and the other threads spin until it does */
+		if (pthreadpool_decrement_fetch_acquire_release_size_t(&batch->waiting_threads) == 0) {
+			pthreadpool_store_relaxed_size_t(&batch->waiting_threads, threads_count);
+			start_batch_plan(threadpool, batch, generation == 0 ? 0 : batch->plan_index + 1);
+			pthreadpool_store_release_size_t(&batch->barrier_generation, generation + 1);
+		} else {
+			while (pthreadpool_load_acquire_size_t(&batch->barrier_generation) == generation) {
+				pthreadpool_yield();
 			}
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+		generation += 1;
+
+		const size_t plan_index = batch->plan_index;
+		if (plan_index == batch->plans_count) {
+			break;
 		}
-	} else {
-		const size_t tile_range_m = divide_round_up(range_m, tile_m);
-		const size_t tile_range_lm = divide_round_up(range_l, tile_l) * tile_range_m;
-		const size_t tile_range = range_i * range_j * range_k * tile_range_lm;
-		const struct pthreadpool_5d_tile_2d_params params = {
-			.range_l = range_l,
-			.tile_l = tile_l,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.tile_range_lm = fxdiv_init_size_t(tile_range_lm),
-			.tile_range_m = fxdiv_init_size_t(tile_range_m),
-		};
-		thread_function_t parallelize_5d_tile_2d = &thread_parallelize_5d_tile_2d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_5d_tile_2d = &pthreadpool_thread_parallelize_5d_tile_2d_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_5d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
-	}
-}
 
-void pthreadpool_parallelize_6d(
-	pthreadpool_t threadpool,
-	pthreadpool_task_6d_t task,
-	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	size_t range_n,
-	uint32_t flags)
-{
-	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || (range_i | range_j | range_k | range_l | range_m | range_n) <= 1) {
-		/* No thread pool used: execute task sequentially on the calling thread */
+		const struct pthreadpool_plan* plan = batch->plans[plan_index];
 		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+		if (plan->flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l++) {
-						for (size_t m = 0; m < range_m; m++) {
-							for (size_t n = 0; n < range_n; n++) {
-								task(argument, i, j, k, l, m, n);
-							}
-						}
-					}
-				}
-			}
+
+		if (thread->thread_number < plan->threads_count.value) {
+			plan->thread_function(threadpool, thread);
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
+
+		if (plan->flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
-	} else {
-		const size_t range_lmn = range_l * range_m * range_n;
-		const size_t range = range_i * range_j * range_k * range_lmn;
-		const struct pthreadpool_6d_params params = {
-			.range_l = range_l,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.range_lmn = fxdiv_init_size_t(range_lmn),
-			.range_m = fxdiv_init_size_t(range_m),
-			.range_n = fxdiv_init_size_t(range_n),
-		};
-		thread_function_t parallelize_6d = &thread_parallelize_6d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (range < range_threshold) {
-				parallelize_6d = &pthreadpool_thread_parallelize_6d_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_6d, &params, sizeof(params),
-			task, argument, range, flags);
 	}
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
 }
 
-void pthreadpool_parallelize_6d_tile_1d(
-	pthreadpool_t threadpool,
-	pthreadpool_task_6d_tile_1d_t task,
-	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	size_t range_n,
-	size_t tile_n,
-	uint32_t flags)
-{
+void pthreadpool_run_batch(pthreadpool_t threadpool, const pthreadpool_plan_t* plans, size_t plans_count) {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l | range_m) <= 1 && range_n <= tile_n)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
-		struct fpu_state saved_fpu_state = { 0 };
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			saved_fpu_state = get_fpu_state();
-			disable_fpu_denormals();
-		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l++) {
-						for (size_t m = 0; m < range_m; m++) {
-							for (size_t n = 0; n < range_n; n += tile_n) {
-								task(argument, i, j, k, l, m, n, min(range_n - n, tile_n));
-							}
-						}
-					}
-				}
-			}
+	bool sequential = threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1;
+	#if PTHREADPOOL_USE_GCD
+		/* Dispatch may run the threads of a command one after another, so they can't wait for each other at a barrier */
+		sequential = true;
+	#endif
+	if (sequential || is_nested_call(threadpool)) {
+		for (size_t i = 0; i < plans_count; i++) {
+			pthreadpool_run_plan(plans[i]);
 		}
-		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
-			set_fpu_state(saved_fpu_state);
+		return;
+	}
+
+	/*
+	 * All plans run in a single command: between plans, threads synchronize at a barrier instead of returning to the
+	 * caller and waiting for the next command.
+	 */
+	struct pthreadpool_batch batch = {
+		.plans = plans,
+		.plans_count = plans_count,
+	};
+	pthreadpool_store_relaxed_size_t(&batch.waiting_threads, threads_count);
+	pthreadpool_store_relaxed_size_t(&batch.barrier_generation, 0);
+	pthreadpool_parallelize(
+		threadpool, &thread_run_batch, NULL, 0,
+		(void*) &batch, NULL, threads_count, 0 /* flags */);
+}
+
+/* Runs an SPMD function as the only thread of the computation, where pthreadpool_barrier_wait returns immediately */
+static void run_spmd_on_single_thread(pthreadpool_task_spmd_t task, void* argument) {
+	struct pthreadpool* saved_spmd = current_spmd;
+	current_spmd = NULL;
+	task(argument, 0, 1);
+	current_spmd = saved_spmd;
+}
+
+static void thread_run_spmd(struct pthreadpool* threadpool, struct thread_info* thread) {
+	const pthreadpool_task_spmd_t task = (pthreadpool_task_spmd_t) pthreadpool_load_relaxed_void_p(&threadpool->task);
+	void *const argument = pthreadpool_load_relaxed_void_p(&threadpool->argument);
+
+	if (threadpool->parent != NULL) {
+		/* Thread slots of a job may run one after another on the same thread, so they can't wait at a barrier */
+		if (thread->thread_number == 0) {
+			run_spmd_on_single_thread(task, argument);
 		}
-	} else {
-		const size_t tile_range_n = divide_round_up(range_n, tile_n);
-		const size_t tile_range_lmn = range_l * range_m * tile_range_n;
-		const size_t tile_range = range_i * range_j * range_k * tile_range_lmn;
-		const struct pthreadpool_6d_tile_1d_params params = {
-			.range_l = range_l,
-			.range_n = range_n,
-			.tile_n = tile_n,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_k = fxdiv_init_size_t(range_k),
-			.tile_range_lmn = fxdiv_init_size_t(tile_range_lmn),
-			.range_m = fxdiv_init_size_t(range_m),
-			.tile_range_n = fxdiv_init_size_t(tile_range_n),
-		};
-		thread_function_t parallelize_6d_tile_1d = &thread_parallelize_6d_tile_1d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_6d_tile_1d = &pthreadpool_thread_parallelize_6d_tile_1d_fastpath;
-			}
-		#endif
-		pthreadpool_parallelize(
-			threadpool, parallelize_6d_tile_1d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+		return;
 	}
+
+	struct pthreadpool* saved_spmd = current_spmd;
+	current_spmd = threadpool;
+	task(argument, thread->thread_number, threadpool->threads_count.value);
+	current_spmd = saved_spmd;
+
+	/* Make changes by this thread visible to other threads */
+	pthreadpool_fence_release();
 }
 
-void pthreadpool_parallelize_6d_tile_2d(
+void pthreadpool_run_spmd(
 	pthreadpool_t threadpool,
-	pthreadpool_task_6d_tile_2d_t task,
+	pthreadpool_task_spmd_t task,
 	void* argument,
-	size_t range_i,
-	size_t range_j,
-	size_t range_k,
-	size_t range_l,
-	size_t range_m,
-	size_t range_n,
-	size_t tile_m,
-	size_t tile_n,
 	uint32_t flags)
 {
 	size_t threads_count;
-	if (threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1 || ((range_i | range_j | range_k | range_l) <= 1 && range_m <= tile_m && range_n <= tile_n)) {
-		/* No thread pool used: execute task sequentially on the calling thread */
+	bool single_thread = threadpool == NULL || (threads_count = threadpool->threads_count.value) <= 1;
+	#if PTHREADPOOL_USE_GCD
+		/* Dispatch may run the threads of a command one after another, so they can't wait for each other at a barrier */
+		single_thread = true;
+	#endif
+	if (single_thread || is_nested_call(threadpool)) {
 		struct fpu_state saved_fpu_state = { 0 };
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			saved_fpu_state = get_fpu_state();
 			disable_fpu_denormals();
 		}
-		for (size_t i = 0; i < range_i; i++) {
-			for (size_t j = 0; j < range_j; j++) {
-				for (size_t k = 0; k < range_k; k++) {
-					for (size_t l = 0; l < range_l; l++) {
-						for (size_t m = 0; m < range_m; m += tile_m) {
-							for (size_t n = 0; n < range_n; n += tile_n) {
-								task(argument, i, j, k, l, m, n,
-									min(range_m - m, tile_m), min(range_n - n, tile_n));
-							}
-						}
-					}
-				}
-			}
-		}
+		run_spmd_on_single_thread(task, argument);
 		if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 			set_fpu_state(saved_fpu_state);
 		}
 	} else {
-		const size_t range_kl = range_k * range_l;
-		const size_t tile_range_n = divide_round_up(range_n, tile_n);
-		const size_t tile_range_mn = divide_round_up(range_m, tile_m) * tile_range_n;
-		const size_t tile_range = range_i * range_j * range_kl * tile_range_mn;
-		const struct pthreadpool_6d_tile_2d_params params = {
-			.range_k = range_k,
-			.range_m = range_m,
-			.tile_m = tile_m,
-			.range_n = range_n,
-			.tile_n = tile_n,
-			.range_j = fxdiv_init_size_t(range_j),
-			.range_kl = fxdiv_init_size_t(range_kl),
-			.range_l = fxdiv_init_size_t(range_l),
-			.tile_range_mn = fxdiv_init_size_t(tile_range_mn),
-			.tile_range_n = fxdiv_init_size_t(tile_range_n),
-		};
-		thread_function_t parallelize_6d_tile_2d = &thread_parallelize_6d_tile_2d;
-		#if PTHREADPOOL_USE_FASTPATH
-			const size_t range_threshold = -threads_count;
-			if (tile_range < range_threshold) {
-				parallelize_6d_tile_2d = &pthreadpool_thread_parallelize_6d_tile_2d_fastpath;
-			}
-		#endif
 		pthreadpool_parallelize(
-			threadpool, parallelize_6d_tile_2d, &params, sizeof(params),
-			task, argument, tile_range, flags);
+			threadpool, &thread_run_spmd, NULL, 0,
+			(void*) task, argument, threads_count, flags);
+	}
+}
+
+void pthreadpool_barrier_wait(pthreadpool_t threadpool) {
+	if (threadpool == NULL || current_spmd != threadpool) {
+		/* The calling thread is the only thread of the computation */
+		return;
+	}
+
+	/* Sense-reversing barrier: the last thread to arrive resets the count for the next barrier, and flips the sense */
+	const uint32_t sense = pthreadpool_load_relaxed_uint32_t(&threadpool->barrier_sense);
+	const size_t threads_count = threadpool->threads_count.value;
+	if (pthreadpool_decrement_fetch_acquire_release_size_t(&threadpool->barrier_waiting_threads) == 0) {
+		pthreadpool_store_relaxed_size_t(&threadpool->barrier_waiting_threads, threads_count);
+		pthreadpool_release_barrier(threadpool, sense ^ 1);
+	} else {
+		pthreadpool_wait_barrier(threadpool, sense);
 	}
 }
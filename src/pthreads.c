@@ -11,6 +11,7 @@
 
 /* POSIX headers */
 #include <pthread.h>
+#include <time.h>
 #include <unistd.h>
 
 /* Futex-specific headers */
@@ -36,6 +37,13 @@
 	#endif
 #endif
 
+/* Topology detection headers */
+#if defined(__linux__) && !PTHREADPOOL_USE_CPUINFO
+	#include <dirent.h>
+	#include <stdio.h>
+	#include <sys/syscall.h>
+#endif
+
 /* Windows-specific headers */
 #ifdef _WIN32
 	#include <sysinfoapi.h>
@@ -61,6 +69,10 @@
 			return syscall(SYS_futex, address, FUTEX_WAIT | FUTEX_PRIVATE_FLAG, value, NULL);
 		}
 
+		static int futex_wake(pthreadpool_atomic_uint32_t* address, int count) {
+			return syscall(SYS_futex, address, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, count);
+		}
+
 		static int futex_wake_all(pthreadpool_atomic_uint32_t* address) {
 			return syscall(SYS_futex, address, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, INT_MAX);
 		}
@@ -69,6 +81,10 @@
 			return emscripten_futex_wait((volatile void*) address, value, INFINITY);
 		}
 
+		static int futex_wake(pthreadpool_atomic_uint32_t* address, int count) {
+			return emscripten_futex_wake((volatile void*) address, count);
+		}
+
 		static int futex_wake_all(pthreadpool_atomic_uint32_t* address) {
 			return emscripten_futex_wake((volatile void*) address, INT_MAX);
 		}
@@ -107,7 +123,8 @@ static void wait_worker_threads(struct pthreadpool* threadpool) {
 	#endif
 
 	/* Spin-wait */
-	for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
+	const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
 		pthreadpool_yield();
 
 		#if PTHREADPOOL_USE_FUTEX
@@ -137,8 +154,63 @@ static void wait_worker_threads(struct pthreadpool* threadpool) {
 	#endif
 }
 
+/*
+ * Advances the wake-up count of a worker thread, and wakes the thread up if it sleeps. With only_sleeping, leaves an
+ * awake thread alone, and returns whether the thread was asleep. The caller issues a release fence before the call, so
+ * that the thread observes the command or the job it is woken up for once it observes the advanced count.
+ */
+static bool wake_worker_thread(struct thread_info* thread, bool only_sleeping) {
+	uint32_t wake_signal = pthreadpool_load_relaxed_uint32_t(&thread->wake_signal);
+	do {
+		if (only_sleeping && (wake_signal & 1) == 0) {
+			return false;
+		}
+	} while (!pthreadpool_compare_exchange_weak_relaxed_uint32_t(&thread->wake_signal, &wake_signal, (wake_signal | 1) + 1));
+
+	if ((wake_signal & 1) == 0) {
+		return false;
+	}
+	#if PTHREADPOOL_USE_FUTEX
+		futex_wake(&thread->wake_signal, 1);
+	#else
+		pthread_cond_signal(&thread->wake_condvar);
+	#endif
+	return true;
+}
+
+/* Wakes up all worker threads for a new command */
+static void wake_worker_threads(struct pthreadpool* threadpool) {
+	pthreadpool_fence_release();
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 1; tid < threads_count; tid++) {
+		wake_worker_thread(&threadpool->threads[tid], false /* only sleeping */);
+	}
+}
+
+/*
+ * Puts a worker thread to sleep until another thread advances its wake-up count past wake_signal, the value the worker
+ * read before it last looked for a new command and for jobs. Returns immediately if the count already changed.
+ */
+static void sleep_worker_thread(struct pthreadpool* threadpool, struct thread_info* thread, uint32_t wake_signal) {
+	#if PTHREADPOOL_USE_FUTEX
+		(void) threadpool;
+		if (pthreadpool_compare_exchange_weak_relaxed_uint32_t(&thread->wake_signal, &wake_signal, wake_signal | 1)) {
+			futex_wait(&thread->wake_signal, wake_signal | 1);
+		}
+	#else
+		pthread_mutex_lock(&threadpool->command_mutex);
+		if (pthreadpool_compare_exchange_weak_relaxed_uint32_t(&thread->wake_signal, &wake_signal, wake_signal | 1)) {
+			while (pthreadpool_load_relaxed_uint32_t(&thread->wake_signal) == (wake_signal | 1)) {
+				pthread_cond_wait(&thread->wake_condvar, &threadpool->command_mutex);
+			}
+		}
+		pthread_mutex_unlock(&threadpool->command_mutex);
+	#endif
+}
+
 static uint32_t wait_for_new_command(
 	struct pthreadpool* threadpool,
+	struct thread_info* thread,
 	uint32_t last_command,
 	uint32_t last_flags)
 {
@@ -149,34 +221,131 @@ static uint32_t wait_for_new_command(
 
 	if ((last_flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
 		/* Spin-wait loop */
-		for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
+		const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->spin_wait_ns);
+		for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
 			pthreadpool_yield();
 
 			command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
 			if (command != last_command) {
 				return command;
 			}
+
+			/* Meanwhile, help with concurrent jobs of other submitting threads */
+			pthreadpool_help_jobs(threadpool, thread);
 		}
 	}
 
 	/* Spin-wait disabled or timed out, fall back to mutex/futex wait */
-	#if PTHREADPOOL_USE_FUTEX
-		do {
-			futex_wait(&threadpool->command, last_command);
-			command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
-		} while (command == last_command);
-	#else
-		/* Lock the command mutex */
-		pthread_mutex_lock(&threadpool->command_mutex);
-		/* Read the command */
-		while ((command = pthreadpool_load_acquire_uint32_t(&threadpool->command)) == last_command) {
-			/* Wait for new command */
-			pthread_cond_wait(&threadpool->command_condvar, &threadpool->command_mutex);
+	for (;;) {
+		/*
+		 * Read the wake-up count before the command and the jobs: threads which publish a command or a job for this
+		 * thread later advance the count, and then the thread doesn't fall asleep.
+		 */
+		const uint32_t wake_signal = pthreadpool_load_acquire_uint32_t(&thread->wake_signal);
+		command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
+		if (command != last_command) {
+			return command;
 		}
-		/* Read a new command */
-		pthread_mutex_unlock(&threadpool->command_mutex);
+
+		/* Help with the jobs published before the wake-up count was read */
+		while (pthreadpool_help_jobs(threadpool, thread)) {
+			/* Keep helping until no published job has thread slots left */
+		}
+
+		sleep_worker_thread(threadpool, thread, wake_signal);
+	}
+}
+
+#if defined(__linux__) && !PTHREADPOOL_USE_CPUINFO
+	static bool read_sysfs_uint32(const char* path, uint32_t* value) {
+		FILE* file = fopen(path, "r");
+		if (file == NULL) {
+			return false;
+		}
+		unsigned int parsed_value = 0;
+		const bool success = fscanf(file, "%u", &parsed_value) == 1;
+		fclose(file);
+		*value = (uint32_t) parsed_value;
+		return success;
+	}
+
+	static uint32_t linux_get_l3_cache_id(unsigned int cpu) {
+		char path[128];
+		for (unsigned int index = 0; index < 16; index++) {
+			uint32_t level = 0;
+			snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu, index);
+			if (!read_sysfs_uint32(path, &level)) {
+				break;
+			}
+			if (level == 3) {
+				uint32_t id = 0;
+				snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/id", cpu, index);
+				if (read_sysfs_uint32(path, &id)) {
+					return id;
+				}
+				/* Older kernels lack the id attribute: identify the cache by the first processor sharing it */
+				snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", cpu, index);
+				if (read_sysfs_uint32(path, &id)) {
+					return id;
+				}
+				break;
+			}
+		}
+		return 0;
+	}
+
+	static uint32_t linux_get_numa_node(unsigned int cpu) {
+		uint32_t node_id = 0;
+		DIR* directory = opendir("/sys/devices/system/node");
+		if (directory == NULL) {
+			return node_id;
+		}
+		char path[128];
+		for (struct dirent* entry = readdir(directory); entry != NULL; entry = readdir(directory)) {
+			unsigned int node = 0;
+			if (sscanf(entry->d_name, "node%u", &node) != 1) {
+				continue;
+			}
+			snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpu%u", node, cpu);
+			if (access(path, F_OK) == 0) {
+				node_id = (uint32_t) node;
+				break;
+			}
+		}
+		closedir(directory);
+		return node_id;
+	}
+#endif
+
+/*
+ * Records the cache and NUMA domains of the processor the calling thread runs on.
+ * Worker threads are not pinned, so this is a hint which reflects the placement at thread start.
+ */
+static void detect_thread_topology(struct thread_info* thread) {
+	#if PTHREADPOOL_USE_CPUINFO
+		const struct cpuinfo_processor* processor = cpuinfo_get_current_processor();
+		if (processor != NULL) {
+			if (processor->cache.l3 != NULL) {
+				thread->cache_domain = (uint32_t) (processor->cache.l3 - cpuinfo_get_l3_cache(0));
+			} else if (processor->cluster != NULL) {
+				/* Without an L3 cache, cores in a cluster share the last-level cache */
+				thread->cache_domain = (uint32_t) (processor->cluster - cpuinfo_get_cluster(0));
+			}
+			/* cpuinfo does not report NUMA nodes: use the physical package as the closest approximation */
+			if (processor->package != NULL) {
+				thread->numa_domain = (uint32_t) (processor->package - cpuinfo_get_package(0));
+			}
+		}
+	#elif defined(__linux__) && defined(SYS_getcpu)
+		unsigned int cpu = 0;
+		if (syscall(SYS_getcpu, &cpu, NULL, NULL) == 0) {
+			thread->cache_domain = linux_get_l3_cache_id(cpu);
+			thread->numa_domain = linux_get_numa_node(cpu);
+		}
+	#else
+		/* Topology unknown: all threads stay in the same domain */
+		(void) thread;
 	#endif
-	return command;
 }
 
 static void* thread_main(void* arg) {
@@ -186,12 +355,14 @@ static void* thread_main(void* arg) {
 	struct fpu_state saved_fpu_state = { 0 };
 	uint32_t flags = 0;
 
+	detect_thread_topology(thread);
+
 	/* Check in */
 	checkin_worker_thread(threadpool);
 
 	/* Monitor new commands and act accordingly */
 	for (;;) {
-		uint32_t command = wait_for_new_command(threadpool, last_command, flags);
+		uint32_t command = wait_for_new_command(threadpool, thread, last_command, flags);
 		pthreadpool_fence_acquire();
 
 		flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
@@ -207,7 +378,7 @@ static void* thread_main(void* arg) {
 					disable_fpu_denormals();
 				}
 
-				thread_function(threadpool, thread);
+				pthreadpool_run_thread_function(threadpool, thread_function, thread);
 				if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 					set_fpu_state(saved_fpu_state);
 				}
@@ -260,9 +431,13 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		return NULL;
 	}
 	threadpool->threads_count = fxdiv_init_size_t(threads_count);
+	threadpool->urgent_pool = threadpool;
+	pthreadpool_set_spin_policy(threadpool, PTHREADPOOL_SPIN_POLICY_ADAPTIVE, PTHREADPOOL_SPIN_WAIT_MAX_NS);
+	pthreadpool_store_relaxed_size_t(&threadpool->barrier_waiting_threads, threads_count);
 	for (size_t tid = 0; tid < threads_count; tid++) {
 		threadpool->threads[tid].thread_number = tid;
 		threadpool->threads[tid].threadpool = threadpool;
+		threadpool->threads[tid].steal_seed = (uint32_t) (tid + 1) * UINT32_C(0x9E3779B9);
 	}
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
@@ -272,7 +447,10 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 			pthread_mutex_init(&threadpool->completion_mutex, NULL);
 			pthread_cond_init(&threadpool->completion_condvar, NULL);
 			pthread_mutex_init(&threadpool->command_mutex, NULL);
-			pthread_cond_init(&threadpool->command_condvar, NULL);
+			pthread_cond_init(&threadpool->barrier_condvar, NULL);
+			for (size_t tid = 1; tid < threads_count; tid++) {
+				pthread_cond_init(&threadpool->threads[tid].wake_condvar, NULL);
+			}
 		#endif
 
 		#if PTHREADPOOL_USE_FUTEX
@@ -281,6 +459,7 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		pthreadpool_store_relaxed_size_t(&threadpool->active_threads, threads_count - 1 /* caller thread */);
 
 		/* Caller thread serves as worker #0. Thus, we create system threads starting with worker #1. */
+		detect_thread_topology(&threadpool->threads[0]);
 		for (size_t tid = 1; tid < threads_count; tid++) {
 			pthread_create(&threadpool->threads[tid].thread_object, NULL, &thread_main, &threadpool->threads[tid]);
 		}
@@ -291,7 +470,7 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return threadpool;
 }
 
-PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_with_ranges(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
 	const void* params,
@@ -299,6 +478,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	void* task,
 	void* context,
 	size_t linear_range,
+	const struct pthreadpool_range* ranges,
 	uint32_t flags)
 {
 	assert(threadpool != NULL);
@@ -307,7 +487,16 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(linear_range > 1);
 
 	/* Protect the global threadpool structures */
-	pthread_mutex_lock(&threadpool->execution_mutex);
+	if (pthread_mutex_trylock(&threadpool->execution_mutex) != 0) {
+		/* Another thread runs a command on the thread pool: process this one as a concurrent job */
+		pthreadpool_parallelize_concurrently(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, ranges, flags);
+		return;
+	}
+
+	/* Adjust how long the workers spin for the next command to how often commands come */
+	pthreadpool_learn_spin_wait(threadpool);
 
 	#if !PTHREADPOOL_USE_FUTEX
 		/* Lock the command variables to ensure that threads don't start processing before they observe complete command with all arguments */
@@ -320,7 +509,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	pthreadpool_store_relaxed_void_p(&threadpool->argument, context);
 	pthreadpool_store_relaxed_uint32_t(&threadpool->flags, flags);
 
-	/* Locking of completion_mutex not needed: readers are sleeping on command_condvar */
+	/* Locking of completion_mutex not needed: workers are asleep or wait for a new command */
 	const struct fxdiv_divisor_size_t threads_count = threadpool->threads_count;
 	pthreadpool_store_relaxed_size_t(&threadpool->active_threads, threads_count.value - 1 /* caller thread */);
 	#if PTHREADPOOL_USE_FUTEX
@@ -333,19 +522,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_partition_range(threadpool, linear_range, ranges, flags);
 
 	/*
 	 * Update the threadpool command.
@@ -365,15 +542,12 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	 * be waiting in a spin-loop rather than the conditional variable.
 	 */
 	pthreadpool_store_release_uint32_t(&threadpool->command, new_command);
-	#if PTHREADPOOL_USE_FUTEX
-		/* Wake up the threads */
-		futex_wake_all(&threadpool->command);
-	#else
-		/* Unlock the command variables before waking up the threads for better performance */
-		pthread_mutex_unlock(&threadpool->command_mutex);
 
-		/* Wake up the threads */
-		pthread_cond_broadcast(&threadpool->command_condvar);
+	/* Wake up the threads */
+	wake_worker_threads(threadpool);
+	#if !PTHREADPOOL_USE_FUTEX
+		/* Unlock the command variables */
+		pthread_mutex_unlock(&threadpool->command_mutex);
 	#endif
 
 	/* Save and modify FPU denormals control, if needed */
@@ -384,7 +558,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Do computations as worker #0 */
-	thread_function(threadpool, &threadpool->threads[0]);
+	pthreadpool_run_thread_function(threadpool, thread_function, &threadpool->threads[0]);
 
 	/* Restore FPU denormals control, if needed */
 	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -393,6 +567,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 
 	/* Wait until the threads finish computation */
 	wait_worker_threads(threadpool);
+	pthreadpool_complete_spin_wait(threadpool);
 
 	/* Make changes by other threads visible to this thread */
 	pthreadpool_fence_acquire();
@@ -401,6 +576,158 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	pthread_mutex_unlock(&threadpool->execution_mutex);
 }
 
+PTHREADPOOL_INTERNAL uint64_t pthreadpool_get_time_ns(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t) time.tv_sec * UINT64_C(1000000000) + (uint64_t) time.tv_nsec;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wake_helpers(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_job_slot* job_slot,
+	size_t helpers_count)
+{
+	/* Only the threads of a team look at the job slot of the team */
+	const bool team_job = job_slot < threadpool->concurrent_slots ||
+		job_slot >= threadpool->concurrent_slots + PTHREADPOOL_CONCURRENT_JOB_SLOTS;
+
+	/*
+	 * Spinning workers notice the job by themselves, so waking up helpers_count sleeping workers is enough: the other
+	 * workers stay asleep. Workers which find no free thread slot of the job go back to sleep.
+	 */
+	/* Make the published job visible to the workers which observe the advanced wake-up count */
+	pthreadpool_fence_release();
+	#if !PTHREADPOOL_USE_FUTEX
+		pthread_mutex_lock(&threadpool->command_mutex);
+	#endif
+	const size_t threads_count = threadpool->threads_count.value;
+	for (size_t tid = 1; tid < threads_count && helpers_count != 0; tid++) {
+		struct thread_info* thread = &threadpool->threads[tid];
+		if (team_job && pthreadpool_load_relaxed_void_p(&thread->team_job_slot) != (void*) job_slot) {
+			continue;
+		}
+		if (wake_worker_thread(thread, true /* only sleeping */)) {
+			helpers_count -= 1;
+		}
+	}
+	#if !PTHREADPOOL_USE_FUTEX
+		pthread_mutex_unlock(&threadpool->command_mutex);
+	#endif
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wait_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	/* Spin-wait */
+	const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
+		if (pthreadpool_load_acquire_uint32_t(&threadpool->barrier_sense) != sense) {
+			return;
+		}
+		pthreadpool_yield();
+	}
+
+	/* Fall-back to mutex/futex wait */
+	#if PTHREADPOOL_USE_FUTEX
+		while (pthreadpool_load_acquire_uint32_t(&threadpool->barrier_sense) == sense) {
+			futex_wait(&threadpool->barrier_sense, sense);
+		}
+	#else
+		pthread_mutex_lock(&threadpool->command_mutex);
+		while (pthreadpool_load_relaxed_uint32_t(&threadpool->barrier_sense) == sense) {
+			pthread_cond_wait(&threadpool->barrier_condvar, &threadpool->command_mutex);
+		}
+		pthread_mutex_unlock(&threadpool->command_mutex);
+	#endif
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_release_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	#if PTHREADPOOL_USE_FUTEX
+		pthreadpool_store_release_uint32_t(&threadpool->barrier_sense, sense);
+		futex_wake_all(&threadpool->barrier_sense);
+	#else
+		pthread_mutex_lock(&threadpool->command_mutex);
+		pthreadpool_store_release_uint32_t(&threadpool->barrier_sense, sense);
+		pthread_mutex_unlock(&threadpool->command_mutex);
+
+		pthread_cond_broadcast(&threadpool->barrier_condvar);
+	#endif
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wait_for_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address,
+	uint32_t value,
+	uint32_t flags)
+{
+	/* Bit 0 is set while threads sleep waiting for the change, and doesn't count as a change */
+	value |= 1;
+
+	/* Spin-wait */
+	if ((flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
+		const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+		for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
+			if ((pthreadpool_load_acquire_uint32_t(address) | 1) != value) {
+				return;
+			}
+			pthreadpool_yield();
+		}
+	}
+
+	/* Fall-back to mutex/futex wait */
+	#if PTHREADPOOL_USE_FUTEX
+		for (;;) {
+			uint32_t current_value = pthreadpool_load_acquire_uint32_t(address);
+			if ((current_value | 1) != value) {
+				return;
+			}
+			if (pthreadpool_compare_exchange_weak_relaxed_uint32_t(address, &current_value, value)) {
+				futex_wait(address, value);
+			}
+		}
+	#else
+		pthread_mutex_lock(&threadpool->command_mutex);
+		for (;;) {
+			uint32_t current_value = pthreadpool_load_acquire_uint32_t(address);
+			if ((current_value | 1) != value) {
+				break;
+			}
+			if (pthreadpool_compare_exchange_weak_relaxed_uint32_t(address, &current_value, value)) {
+				pthread_cond_wait(&threadpool->barrier_condvar, &threadpool->command_mutex);
+			}
+		}
+		pthread_mutex_unlock(&threadpool->command_mutex);
+	#endif
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_notify_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address)
+{
+	/* Make changes by this thread visible to the threads which observe the advanced counter */
+	pthreadpool_fence_release();
+	uint32_t value = pthreadpool_load_relaxed_uint32_t(address);
+	while (!pthreadpool_compare_exchange_weak_relaxed_uint32_t(address, &value, (value | 1) + 1));
+	if ((value & 1) == 0) {
+		/* No thread sleeps waiting for the change */
+		return;
+	}
+
+	#if PTHREADPOOL_USE_FUTEX
+		(void) threadpool;
+		futex_wake_all(address);
+	#else
+		/* Threads which set bit 0 hold the mutex until they wait on the condition variable */
+		pthread_mutex_lock(&threadpool->command_mutex);
+		pthread_mutex_unlock(&threadpool->command_mutex);
+		pthread_cond_broadcast(&threadpool->barrier_condvar);
+	#endif
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 	if (threadpool != NULL) {
 		const size_t threads_count = threadpool->threads_count.value;
@@ -416,7 +743,7 @@ void pthreadpool_destroy(struct pthreadpool* threadpool) {
 				pthreadpool_store_release_uint32_t(&threadpool->command, threadpool_command_shutdown);
 
 				/* Wake up worker threads */
-				futex_wake_all(&threadpool->command);
+				wake_worker_threads(threadpool);
 			#else
 				/* Lock the command variable to ensure that threads don't shutdown until both command and active_threads are updated */
 				pthread_mutex_lock(&threadpool->command_mutex);
@@ -433,7 +760,7 @@ void pthreadpool_destroy(struct pthreadpool* threadpool) {
 				pthreadpool_store_release_uint32_t(&threadpool->command, threadpool_command_shutdown);
 
 				/* Wake up worker threads */
-				pthread_cond_broadcast(&threadpool->command_condvar);
+				wake_worker_threads(threadpool);
 
 				/* Commit the state changes and let workers start processing */
 				pthread_mutex_unlock(&threadpool->command_mutex);
@@ -450,7 +777,10 @@ void pthreadpool_destroy(struct pthreadpool* threadpool) {
 				pthread_mutex_destroy(&threadpool->completion_mutex);
 				pthread_cond_destroy(&threadpool->completion_condvar);
 				pthread_mutex_destroy(&threadpool->command_mutex);
-				pthread_cond_destroy(&threadpool->command_condvar);
+				pthread_cond_destroy(&threadpool->barrier_condvar);
+				for (size_t tid = 1; tid < threads_count; tid++) {
+					pthread_cond_destroy(&threadpool->threads[tid].wake_condvar);
+				}
 			#endif
 		}
 		#if PTHREADPOOL_USE_CPUINFO
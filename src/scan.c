@@ -0,0 +1,500 @@
+/* Standard C headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Public library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-utils.h"
+
+
+/*
+ * Scans are computed in three passes over blocks of elements:
+ * 1. Reduce every block except the last one to its sum, in parallel.
+ * 2. Compute exclusive prefixes of the block sums, serially on the calling thread.
+ * 3. Scan every block starting from its prefix, in parallel.
+ * The input is read twice and the output is written once.
+ */
+
+/* Blocks below this size in bytes don't amortize the overhead of processing them as separate tiles */
+#define PTHREADPOOL_SCAN_MIN_BLOCK_BYTES 16384
+
+/* Number of blocks per thread, which allows work stealing to balance load between threads */
+#define PTHREADPOOL_SCAN_BLOCKS_PER_THREAD 4
+
+struct scan_context {
+	const void* input;
+	void* output;
+	/* Number of elements in a block */
+	size_t block_size;
+	/* Sums of all blocks except the last one, computed in the first pass */
+	void* block_sums;
+	/* Exclusive prefixes of the blocks, computed in the second pass */
+	void* block_prefixes;
+	bool exclusive;
+	/* Parameters of the generic scan */
+	pthreadpool_combine_t combine;
+	void* combine_context;
+	const void* identity;
+	size_t element_size;
+};
+
+static size_t scan_block_size(pthreadpool_t threadpool, size_t count, size_t element_size) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool);
+	return max(
+		divide_round_up(count, threads_count * PTHREADPOOL_SCAN_BLOCKS_PER_THREAD),
+		divide_round_up(PTHREADPOOL_SCAN_MIN_BLOCK_BYTES, max(element_size, 1)));
+}
+
+static void compute_scan(
+	pthreadpool_t threadpool,
+	pthreadpool_task_1d_tile_1d_t reduce_block,
+	void (*compute_block_prefixes)(const struct scan_context* context, size_t blocks),
+	pthreadpool_task_1d_tile_1d_t scan_block,
+	struct scan_context* context,
+	size_t count,
+	uint32_t flags)
+{
+	size_t blocks = 0;
+	char* buffer = NULL;
+	if (pthreadpool_get_threads_count(threadpool) > 1) {
+		context->block_size = scan_block_size(threadpool, count, context->element_size);
+		blocks = divide_round_up(count, context->block_size);
+		if (blocks > 1) {
+			buffer = malloc(2 * blocks * context->element_size);
+		}
+	}
+
+	if (buffer == NULL) {
+		/* Single thread, single block, or no memory for block sums: scan all elements on the calling thread */
+		pthreadpool_parallelize_1d_tile_1d(NULL, scan_block, context, count, max(count, 1), flags);
+	} else {
+		context->block_sums = buffer;
+		context->block_prefixes = buffer + blocks * context->element_size;
+
+		/* The sum of the last block is not needed for the prefixes */
+		pthreadpool_parallelize_1d_tile_1d(
+			threadpool, reduce_block, context,
+			(blocks - 1) * context->block_size, context->block_size, flags);
+		compute_block_prefixes(context, blocks);
+		pthreadpool_parallelize_1d_tile_1d(
+			threadpool, scan_block, context,
+			count, context->block_size, flags);
+
+		free(buffer);
+	}
+}
+
+static void reduce_block_u32(const struct scan_context* context, size_t start, size_t length) {
+	const uint32_t* input = (const uint32_t*) context->input + start;
+	uint32_t sum = 0;
+	for (size_t i = 0; i < length; i++) {
+		sum += input[i];
+	}
+	((uint32_t*) context->block_sums)[start / context->block_size] = sum;
+}
+
+static void compute_block_prefixes_u32(const struct scan_context* context, size_t blocks) {
+	const uint32_t* block_sums = (const uint32_t*) context->block_sums;
+	uint32_t* block_prefixes = (uint32_t*) context->block_prefixes;
+	uint32_t prefix = 0;
+	for (size_t block = 0; block < blocks; block++) {
+		block_prefixes[block] = prefix;
+		prefix += block_sums[block];
+	}
+}
+
+static void scan_block_u32(const struct scan_context* context, size_t start, size_t length) {
+	const uint32_t* input = (const uint32_t*) context->input + start;
+	uint32_t* output = (uint32_t*) context->output + start;
+	uint32_t sum = start == 0 ? 0 : ((const uint32_t*) context->block_prefixes)[start / context->block_size];
+	if (context->exclusive) {
+		for (size_t i = 0; i < length; i++) {
+			const uint32_t element = input[i];
+			output[i] = sum;
+			sum += element;
+		}
+	} else {
+		for (size_t i = 0; i < length; i++) {
+			sum += input[i];
+			output[i] = sum;
+		}
+	}
+}
+
+static void scan_u32(
+	pthreadpool_t threadpool,
+	const uint32_t* input,
+	uint32_t* output,
+	size_t count,
+	bool exclusive,
+	uint32_t flags)
+{
+	struct scan_context context = {
+		.input = input,
+		.output = output,
+		.exclusive = exclusive,
+		.element_size = sizeof(uint32_t),
+	};
+	compute_scan(threadpool,
+		(pthreadpool_task_1d_tile_1d_t) reduce_block_u32, compute_block_prefixes_u32,
+		(pthreadpool_task_1d_tile_1d_t) scan_block_u32, &context, count, flags);
+}
+
+static void reduce_block_u64(const struct scan_context* context, size_t start, size_t length) {
+	const uint64_t* input = (const uint64_t*) context->input + start;
+	uint64_t sum = 0;
+	for (size_t i = 0; i < length; i++) {
+		sum += input[i];
+	}
+	((uint64_t*) context->block_sums)[start / context->block_size] = sum;
+}
+
+static void compute_block_prefixes_u64(const struct scan_context* context, size_t blocks) {
+	const uint64_t* block_sums = (const uint64_t*) context->block_sums;
+	uint64_t* block_prefixes = (uint64_t*) context->block_prefixes;
+	uint64_t prefix = 0;
+	for (size_t block = 0; block < blocks; block++) {
+		block_prefixes[block] = prefix;
+		prefix += block_sums[block];
+	}
+}
+
+static void scan_block_u64(const struct scan_context* context, size_t start, size_t length) {
+	const uint64_t* input = (const uint64_t*) context->input + start;
+	uint64_t* output = (uint64_t*) context->output + start;
+	uint64_t sum = start == 0 ? 0 : ((const uint64_t*) context->block_prefixes)[start / context->block_size];
+	if (context->exclusive) {
+		for (size_t i = 0; i < length; i++) {
+			const uint64_t element = input[i];
+			output[i] = sum;
+			sum += element;
+		}
+	} else {
+		for (size_t i = 0; i < length; i++) {
+			sum += input[i];
+			output[i] = sum;
+		}
+	}
+}
+
+static void scan_u64(
+	pthreadpool_t threadpool,
+	const uint64_t* input,
+	uint64_t* output,
+	size_t count,
+	bool exclusive,
+	uint32_t flags)
+{
+	struct scan_context context = {
+		.input = input,
+		.output = output,
+		.exclusive = exclusive,
+		.element_size = sizeof(uint64_t),
+	};
+	compute_scan(threadpool,
+		(pthreadpool_task_1d_tile_1d_t) reduce_block_u64, compute_block_prefixes_u64,
+		(pthreadpool_task_1d_tile_1d_t) scan_block_u64, &context, count, flags);
+}
+
+static void reduce_block_f32(const struct scan_context* context, size_t start, size_t length) {
+	const float* input = (const float*) context->input + start;
+	float sum = 0.0f;
+	for (size_t i = 0; i < length; i++) {
+		sum += input[i];
+	}
+	((float*) context->block_sums)[start / context->block_size] = sum;
+}
+
+static void compute_block_prefixes_f32(const struct scan_context* context, size_t blocks) {
+	const float* block_sums = (const float*) context->block_sums;
+	float* block_prefixes = (float*) context->block_prefixes;
+	float prefix = 0.0f;
+	for (size_t block = 0; block < blocks; block++) {
+		block_prefixes[block] = prefix;
+		prefix += block_sums[block];
+	}
+}
+
+static void scan_block_f32(const struct scan_context* context, size_t start, size_t length) {
+	const float* input = (const float*) context->input + start;
+	float* output = (float*) context->output + start;
+	float sum = start == 0 ? 0.0f : ((const float*) context->block_prefixes)[start / context->block_size];
+	if (context->exclusive) {
+		for (size_t i = 0; i < length; i++) {
+			const float element = input[i];
+			output[i] = sum;
+			sum += element;
+		}
+	} else {
+		for (size_t i = 0; i < length; i++) {
+			sum += input[i];
+			output[i] = sum;
+		}
+	}
+}
+
+static void scan_f32(
+	pthreadpool_t threadpool,
+	const float* input,
+	float* output,
+	size_t count,
+	bool exclusive,
+	uint32_t flags)
+{
+	struct scan_context context = {
+		.input = input,
+		.output = output,
+		.exclusive = exclusive,
+		.element_size = sizeof(float),
+	};
+	compute_scan(threadpool,
+		(pthreadpool_task_1d_tile_1d_t) reduce_block_f32, compute_block_prefixes_f32,
+		(pthreadpool_task_1d_tile_1d_t) scan_block_f32, &context, count, flags);
+}
+
+static void reduce_block_f64(const struct scan_context* context, size_t start, size_t length) {
+	const double* input = (const double*) context->input + start;
+	double sum = 0.0;
+	for (size_t i = 0; i < length; i++) {
+		sum += input[i];
+	}
+	((double*) context->block_sums)[start / context->block_size] = sum;
+}
+
+static void compute_block_prefixes_f64(const struct scan_context* context, size_t blocks) {
+	const double* block_sums = (const double*) context->block_sums;
+	double* block_prefixes = (double*) context->block_prefixes;
+	double prefix = 0.0;
+	for (size_t block = 0; block < blocks; block++) {
+		block_prefixes[block] = prefix;
+		prefix += block_sums[block];
+	}
+}
+
+static void scan_block_f64(const struct scan_context* context, size_t start, size_t length) {
+	const double* input = (const double*) context->input + start;
+	double* output = (double*) context->output + start;
+	double sum = start == 0 ? 0.0 : ((const double*) context->block_prefixes)[start / context->block_size];
+	if (context->exclusive) {
+		for (size_t i = 0; i < length; i++) {
+			const double element = input[i];
+			output[i] = sum;
+			sum += element;
+		}
+	} else {
+		for (size_t i = 0; i < length; i++) {
+			sum += input[i];
+			output[i] = sum;
+		}
+	}
+}
+
+static void scan_f64(
+	pthreadpool_t threadpool,
+	const double* input,
+	double* output,
+	size_t count,
+	bool exclusive,
+	uint32_t flags)
+{
+	struct scan_context context = {
+		.input = input,
+		.output = output,
+		.exclusive = exclusive,
+		.element_size = sizeof(double),
+	};
+	compute_scan(threadpool,
+		(pthreadpool_task_1d_tile_1d_t) reduce_block_f64, compute_block_prefixes_f64,
+		(pthreadpool_task_1d_tile_1d_t) scan_block_f64, &context, count, flags);
+}
+
+/*
+ * The generic scan keeps its running value in the output array: every output element is initialized with a copy of the
+ * previous one (or of the block prefix), and then combined with one input element. This needs no temporary storage, but
+ * requires the input and the output not to overlap.
+ */
+
+static void reduce_block_generic(const struct scan_context* context, size_t start, size_t length) {
+	const size_t element_size = context->element_size;
+	const char* input = (const char*) context->input + start * element_size;
+	void* sum = (char*) context->block_sums + (start / context->block_size) * element_size;
+	memcpy(sum, context->identity, element_size);
+	for (size_t i = 0; i < length; i++) {
+		context->combine(context->combine_context, sum, input + i * element_size);
+	}
+}
+
+static void compute_block_prefixes_generic(const struct scan_context* context, size_t blocks) {
+	const size_t element_size = context->element_size;
+	const char* block_sums = (const char*) context->block_sums;
+	char* block_prefixes = (char*) context->block_prefixes;
+	memcpy(block_prefixes, context->identity, element_size);
+	for (size_t block = 1; block < blocks; block++) {
+		memcpy(block_prefixes + block * element_size, block_prefixes + (block - 1) * element_size, element_size);
+		context->combine(context->combine_context, block_prefixes + block * element_size, block_sums + (block - 1) * element_size);
+	}
+}
+
+static void scan_block_generic(const struct scan_context* context, size_t start, size_t length) {
+	if (length == 0) {
+		return;
+	}
+
+	const size_t element_size = context->element_size;
+	const char* input = (const char*) context->input + start * element_size;
+	char* output = (char*) context->output + start * element_size;
+	const void* prefix = start == 0 ?
+		context->identity : (const char*) context->block_prefixes + (start / context->block_size) * element_size;
+	memcpy(output, prefix, element_size);
+	if (context->exclusive) {
+		for (size_t i = 1; i < length; i++) {
+			memcpy(output + i * element_size, output + (i - 1) * element_size, element_size);
+			context->combine(context->combine_context, output + i * element_size, input + (i - 1) * element_size);
+		}
+	} else {
+		context->combine(context->combine_context, output, input);
+		for (size_t i = 1; i < length; i++) {
+			memcpy(output + i * element_size, output + (i - 1) * element_size, element_size);
+			context->combine(context->combine_context, output + i * element_size, input + i * element_size);
+		}
+	}
+}
+
+static void scan_generic(
+	pthreadpool_t threadpool,
+	pthreadpool_combine_t combine,
+	void* combine_context,
+	const void* identity,
+	const void* input,
+	void* output,
+	size_t element_size,
+	size_t count,
+	bool exclusive,
+	uint32_t flags)
+{
+	struct scan_context context = {
+		.input = input,
+		.output = output,
+		.exclusive = exclusive,
+		.combine = combine,
+		.combine_context = combine_context,
+		.identity = identity,
+		.element_size = element_size,
+	};
+	compute_scan(threadpool,
+		(pthreadpool_task_1d_tile_1d_t) reduce_block_generic, compute_block_prefixes_generic,
+		(pthreadpool_task_1d_tile_1d_t) scan_block_generic, &context, count, flags);
+}
+
+void pthreadpool_inclusive_scan(
+	pthreadpool_t threadpool,
+	pthreadpool_combine_t combine,
+	void* context,
+	const void* identity,
+	const void* input,
+	void* output,
+	size_t element_size,
+	size_t count,
+	uint32_t flags)
+{
+	scan_generic(threadpool, combine, context, identity, input, output, element_size, count, false /* exclusive */, flags);
+}
+
+void pthreadpool_exclusive_scan(
+	pthreadpool_t threadpool,
+	pthreadpool_combine_t combine,
+	void* context,
+	const void* identity,
+	const void* input,
+	void* output,
+	size_t element_size,
+	size_t count,
+	uint32_t flags)
+{
+	scan_generic(threadpool, combine, context, identity, input, output, element_size, count, true /* exclusive */, flags);
+}
+
+void pthreadpool_inclusive_scan_u32(
+	pthreadpool_t threadpool,
+	const uint32_t* input,
+	uint32_t* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_u32(threadpool, input, output, count, false /* exclusive */, flags);
+}
+
+void pthreadpool_exclusive_scan_u32(
+	pthreadpool_t threadpool,
+	const uint32_t* input,
+	uint32_t* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_u32(threadpool, input, output, count, true /* exclusive */, flags);
+}
+
+void pthreadpool_inclusive_scan_u64(
+	pthreadpool_t threadpool,
+	const uint64_t* input,
+	uint64_t* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_u64(threadpool, input, output, count, false /* exclusive */, flags);
+}
+
+void pthreadpool_exclusive_scan_u64(
+	pthreadpool_t threadpool,
+	const uint64_t* input,
+	uint64_t* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_u64(threadpool, input, output, count, true /* exclusive */, flags);
+}
+
+void pthreadpool_inclusive_scan_f32(
+	pthreadpool_t threadpool,
+	const float* input,
+	float* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_f32(threadpool, input, output, count, false /* exclusive */, flags);
+}
+
+void pthreadpool_exclusive_scan_f32(
+	pthreadpool_t threadpool,
+	const float* input,
+	float* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_f32(threadpool, input, output, count, true /* exclusive */, flags);
+}
+
+void pthreadpool_inclusive_scan_f64(
+	pthreadpool_t threadpool,
+	const double* input,
+	double* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_f64(threadpool, input, output, count, false /* exclusive */, flags);
+}
+
+void pthreadpool_exclusive_scan_f64(
+	pthreadpool_t threadpool,
+	const double* input,
+	double* output,
+	size_t count,
+	uint32_t flags)
+{
+	scan_f64(threadpool, input, output, count, true /* exclusive */, flags);
+}
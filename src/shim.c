@@ -1,5 +1,7 @@
 /* Standard C headers */
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 
 /* Public library header */
 #include <pthreadpool.h>
@@ -26,6 +28,65 @@ size_t pthreadpool_get_threads_count(struct pthreadpool* threadpool) {
 	return 1;
 }
 
+void pthreadpool_set_topology(
+	struct pthreadpool* threadpool,
+	const uint32_t* cache_domains,
+	const uint32_t* numa_domains)
+{
+}
+
+void pthreadpool_set_thread_weights(
+	struct pthreadpool* threadpool,
+	const uint32_t* weights)
+{
+}
+
+void pthreadpool_get_thread_weights(
+	struct pthreadpool* threadpool,
+	uint32_t* weights)
+{
+	weights[0] = 0;
+}
+
+void pthreadpool_set_spin_policy(
+	struct pthreadpool* threadpool,
+	uint32_t policy,
+	uint64_t max_spin_ns)
+{
+}
+
+uint64_t pthreadpool_get_spin_wait_ns(struct pthreadpool* threadpool) {
+	return 0;
+}
+
+struct pthreadpool* pthreadpool_create_team(
+	struct pthreadpool* threadpool,
+	size_t first_thread,
+	size_t threads_count)
+{
+	if (threadpool != NULL && first_thread == 0 && threads_count == 1) {
+		return (struct pthreadpool*) &static_pthreadpool;
+	}
+
+	return NULL;
+}
+
+bool pthreadpool_set_team_threads(
+	struct pthreadpool* team,
+	size_t first_thread,
+	size_t threads_count)
+{
+	return team != NULL && first_thread == 0 && threads_count == 1;
+}
+
+void pthreadpool_destroy_team(struct pthreadpool* team) {
+}
+
+void pthreadpool_cancel(
+	struct pthreadpool* threadpool)
+{
+}
+
 void pthreadpool_parallelize_1d(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_1d_t task,
@@ -77,6 +138,52 @@ void pthreadpool_parallelize_1d_tile_1d(
 	}
 }
 
+void pthreadpool_parallelize_1d_with_grain(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	size_t grain,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < range; i++) {
+		task(argument, i);
+	}
+}
+
+void pthreadpool_parallelize_1d_reduce(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_reduce_t task,
+	pthreadpool_combine_t combine,
+	void* argument,
+	const void* identity,
+	void* result,
+	size_t value_size,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	memcpy(result, identity, value_size);
+	for (size_t i = 0; i < range; i += tile) {
+		task(argument, result, i, min(range - i, tile));
+	}
+}
+
+size_t pthreadpool_parallelize_1d_find_first(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_predicate_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	for (size_t i = 0; i < range; i++) {
+		if (task(argument, i)) {
+			return i;
+		}
+	}
+	return range;
+}
+
 void pthreadpool_parallelize_2d(
 	struct pthreadpool* threadpool,
 	pthreadpool_task_2d_t task,
@@ -592,5 +699,335 @@ void pthreadpool_parallelize_6d_tile_2d(
 	}
 }
 
+struct pthreadpool_plan {
+	void (*run)(const struct pthreadpool_plan* plan);
+	void* task;
+	void* argument;
+	size_t range[3];
+	size_t tile[2];
+	uint32_t flags;
+};
+
+static struct pthreadpool_plan* create_plan(
+	void (*run)(const struct pthreadpool_plan* plan),
+	void* task,
+	void* argument,
+	size_t range_i, size_t range_j, size_t range_k,
+	size_t tile_0, size_t tile_1,
+	uint32_t flags)
+{
+	struct pthreadpool_plan* plan = malloc(sizeof(struct pthreadpool_plan));
+	if (plan != NULL) {
+		*plan = (struct pthreadpool_plan) {
+			.run = run,
+			.task = task,
+			.argument = argument,
+			.range = { range_i, range_j, range_k },
+			.tile = { tile_0, tile_1 },
+			.flags = flags,
+		};
+	}
+	return plan;
+}
+
+static void run_plan_1d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_1d(NULL,
+		(pthreadpool_task_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_1d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_1d, (void*) task, argument, range, 0, 0, 0, 0, flags);
+}
+
+static void run_plan_1d_tile_1d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_1d_tile_1d(NULL,
+		(pthreadpool_task_1d_tile_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->tile[0], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_1d_tile_1d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_1d_tile_1d, (void*) task, argument, range, 0, 0, tile, 0, flags);
+}
+
+static void run_plan_2d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d(NULL,
+		(pthreadpool_task_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_2d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_2d, (void*) task, argument, range_i, range_j, 0, 0, 0, flags);
+}
+
+static void run_plan_2d_tile_1d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d_tile_1d(NULL,
+		(pthreadpool_task_2d_tile_1d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->tile[0], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_2d_tile_1d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_tile_1d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_2d_tile_1d, (void*) task, argument, range_i, range_j, 0, tile_j, 0, flags);
+}
+
+static void run_plan_2d_tile_2d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_2d_tile_2d(NULL,
+		(pthreadpool_task_2d_tile_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->tile[0], plan->tile[1], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_2d_tile_2d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_2d_tile_2d, (void*) task, argument, range_i, range_j, 0, tile_i, tile_j, flags);
+}
+
+static void run_plan_3d_tile_2d(const struct pthreadpool_plan* plan) {
+	pthreadpool_parallelize_3d_tile_2d(NULL,
+		(pthreadpool_task_3d_tile_2d_t) plan->task, plan->argument,
+		plan->range[0], plan->range[1], plan->range[2], plan->tile[0], plan->tile[1], plan->flags);
+}
+
+struct pthreadpool_plan* pthreadpool_create_plan_3d_tile_2d(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_3d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t range_k,
+	size_t tile_j,
+	size_t tile_k,
+	uint32_t flags)
+{
+	return create_plan(&run_plan_3d_tile_2d, (void*) task, argument, range_i, range_j, range_k, tile_j, tile_k, flags);
+}
+
+void pthreadpool_run_plan(struct pthreadpool_plan* plan) {
+	plan->run(plan);
+}
+
+void pthreadpool_set_plan_max_threads(struct pthreadpool_plan* plan, size_t max_threads) {
+}
+
+void pthreadpool_destroy_plan(struct pthreadpool_plan* plan) {
+	free(plan);
+}
+
+/* Asynchronous computations complete before the pthreadpool_*_async functions return, and share this handle */
+struct pthreadpool_async {
+	char unused;
+};
+
+static struct pthreadpool_async completed_async;
+
+static struct pthreadpool_async* complete_async(pthreadpool_async_callback_t callback, void* callback_context) {
+	if (callback != NULL) {
+		callback(callback_context);
+	}
+	return &completed_async;
+}
+
+struct pthreadpool_async* pthreadpool_run_plan_async(
+	struct pthreadpool_plan* plan,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	plan->run(plan);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_1d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_t task,
+	void* argument,
+	size_t range,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_1d(threadpool, task, argument, range, flags);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_1d_tile_1d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_1d_tile_1d_t task,
+	void* argument,
+	size_t range,
+	size_t tile,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_1d_tile_1d(threadpool, task, argument, range, tile, flags);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_2d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_2d(threadpool, task, argument, range_i, range_j, flags);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_2d_tile_1d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_tile_1d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_2d_tile_1d(threadpool, task, argument, range_i, range_j, tile_j, flags);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_2d_tile_2d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_2d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t tile_i,
+	size_t tile_j,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_2d_tile_2d(threadpool, task, argument, range_i, range_j, tile_i, tile_j, flags);
+	return complete_async(callback, callback_context);
+}
+
+struct pthreadpool_async* pthreadpool_parallelize_3d_tile_2d_async(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_3d_tile_2d_t task,
+	void* argument,
+	size_t range_i,
+	size_t range_j,
+	size_t range_k,
+	size_t tile_j,
+	size_t tile_k,
+	uint32_t flags,
+	pthreadpool_async_callback_t callback,
+	void* callback_context)
+{
+	pthreadpool_parallelize_3d_tile_2d(threadpool, task, argument, range_i, range_j, range_k, tile_j, tile_k, flags);
+	return complete_async(callback, callback_context);
+}
+
+bool pthreadpool_test_async(struct pthreadpool_async* async) {
+	return true;
+}
+
+void pthreadpool_wait_async(struct pthreadpool_async* async) {
+}
+
+void pthreadpool_destroy_async(struct pthreadpool_async* async) {
+}
+
+/* Edges only point to nodes added later, so running the nodes in order satisfies all dependencies */
+struct pthreadpool_graph {
+	struct pthreadpool_plan** plans;
+	size_t plans_count;
+};
+
+struct pthreadpool_graph* pthreadpool_create_graph(struct pthreadpool* threadpool) {
+	struct pthreadpool_graph* graph = malloc(sizeof(struct pthreadpool_graph));
+	if (graph != NULL) {
+		*graph = (struct pthreadpool_graph) { 0 };
+	}
+	return graph;
+}
+
+size_t pthreadpool_add_graph_node(struct pthreadpool_graph* graph, struct pthreadpool_plan* plan) {
+	struct pthreadpool_plan** plans = realloc(graph->plans, (graph->plans_count + 1) * sizeof(struct pthreadpool_plan*));
+	if (plans == NULL) {
+		return SIZE_MAX;
+	}
+	graph->plans = plans;
+	graph->plans[graph->plans_count] = plan;
+	return graph->plans_count++;
+}
+
+bool pthreadpool_add_graph_edge(struct pthreadpool_graph* graph, size_t predecessor, size_t successor) {
+	return predecessor < successor && successor < graph->plans_count;
+}
+
+void pthreadpool_run_graph(struct pthreadpool_graph* graph) {
+	for (size_t i = 0; i < graph->plans_count; i++) {
+		pthreadpool_run_plan(graph->plans[i]);
+	}
+}
+
+void pthreadpool_destroy_graph(struct pthreadpool_graph* graph) {
+	if (graph != NULL) {
+		free(graph->plans);
+		free(graph);
+	}
+}
+
+void pthreadpool_run_batch(struct pthreadpool* threadpool, struct pthreadpool_plan* const* plans, size_t plans_count) {
+	for (size_t i = 0; i < plans_count; i++) {
+		pthreadpool_run_plan(plans[i]);
+	}
+}
+
+void pthreadpool_run_spmd(
+	struct pthreadpool* threadpool,
+	pthreadpool_task_spmd_t task,
+	void* argument,
+	uint32_t flags)
+{
+	task(argument, 0, 1);
+}
+
+void pthreadpool_barrier_wait(struct pthreadpool* threadpool) {
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 }
@@ -0,0 +1,465 @@
+/* Standard C headers */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Public library header */
+#include <pthreadpool.h>
+
+/* Internal library headers */
+#include "threadpool-utils.h"
+
+
+/* Blocks below this number of elements don't amortize the overhead of processing them as separate tiles */
+#define PTHREADPOOL_SORT_MIN_BLOCK_SIZE 4096
+
+/* Number of blocks per thread, which allows work stealing to balance load between threads */
+#define PTHREADPOOL_SORT_BLOCKS_PER_THREAD 4
+
+/* Length of runs sorted with insertion sort before merging */
+#define PTHREADPOOL_SORT_INSERTION_RUN 16
+
+/* Number of bits in a radix sort digit */
+#define PTHREADPOOL_RADIX_BITS 8
+#define PTHREADPOOL_RADIX_BINS (1 << PTHREADPOOL_RADIX_BITS)
+
+static size_t sort_block_size(pthreadpool_t threadpool, size_t count) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool);
+	if (threads_count <= 1) {
+		return max(count, 1);
+	}
+	return max(divide_round_up(count, threads_count * PTHREADPOOL_SORT_BLOCKS_PER_THREAD), PTHREADPOOL_SORT_MIN_BLOCK_SIZE);
+}
+
+struct copy_context {
+	const void* input;
+	void* output;
+	size_t element_size;
+};
+
+static void copy_block(const struct copy_context* context, size_t start, size_t length) {
+	const size_t element_size = context->element_size;
+	memcpy((char*) context->output + start * element_size, (const char*) context->input + start * element_size, length * element_size);
+}
+
+static void parallel_copy(
+	pthreadpool_t threadpool,
+	const void* input,
+	void* output,
+	size_t element_size,
+	size_t count,
+	size_t block_size,
+	uint32_t flags)
+{
+	struct copy_context context = {
+		.input = input,
+		.output = output,
+		.element_size = element_size,
+	};
+	pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) copy_block, &context, count, block_size, flags);
+}
+
+/*
+ * Comparison sort: a stable merge sort. Every block is sorted by one thread (insertion sort of short runs, followed by
+ * bottom-up merges), and then sorted runs are merged pairwise in rounds. Each round is split into equal chunks of the
+ * output, and every chunk locates its inputs in the two runs by a binary search on the merge path, so a round keeps all
+ * threads busy even when only a couple of runs are left.
+ */
+
+struct sort_context {
+	pthreadpool_compare_t compare;
+	void* compare_context;
+	size_t element_size;
+	size_t count;
+	/* Elements to sort, and a temporary buffer of the same size */
+	char* base;
+	char* buffer;
+	/* Sorted runs of run_size elements in input are merged into runs of 2 * run_size elements in output */
+	const char* input;
+	char* output;
+	size_t run_size;
+};
+
+static void insertion_sort(const struct sort_context* context, char* data, size_t count, char* element) {
+	const size_t element_size = context->element_size;
+	for (size_t i = 1; i < count; i++) {
+		memcpy(element, data + i * element_size, element_size);
+		size_t j = i;
+		while (j != 0 && context->compare(context->compare_context, element, data + (j - 1) * element_size) < 0) {
+			j--;
+		}
+		if (j != i) {
+			memmove(data + (j + 1) * element_size, data + j * element_size, (i - j) * element_size);
+			memcpy(data + j * element_size, element, element_size);
+		}
+	}
+}
+
+static void merge(
+	const struct sort_context* context,
+	const char* a, size_t a_count,
+	const char* b, size_t b_count,
+	char* output)
+{
+	const size_t element_size = context->element_size;
+	const char* a_end = a + a_count * element_size;
+	const char* b_end = b + b_count * element_size;
+	while (a != a_end && b != b_end) {
+		/* Take equal elements from the first run to keep the sort stable */
+		if (context->compare(context->compare_context, b, a) < 0) {
+			memcpy(output, b, element_size);
+			b += element_size;
+		} else {
+			memcpy(output, a, element_size);
+			a += element_size;
+		}
+		output += element_size;
+	}
+	memcpy(output, a, (size_t) (a_end - a));
+	memcpy(output + (a_end - a), b, (size_t) (b_end - b));
+}
+
+/* Number of elements from the first run among the first k elements of the stable merge of runs a and b */
+static size_t merge_path(
+	const struct sort_context* context,
+	const char* a, size_t a_count,
+	const char* b, size_t b_count,
+	size_t k)
+{
+	const size_t element_size = context->element_size;
+	size_t low = k > b_count ? k - b_count : 0;
+	size_t high = min(k, a_count);
+	while (low < high) {
+		const size_t i = low + (high - low) / 2;
+		const size_t j = k - i;
+		if (context->compare(context->compare_context, b + (j - 1) * element_size, a + i * element_size) < 0) {
+			high = i;
+		} else {
+			low = i + 1;
+		}
+	}
+	return low;
+}
+
+static void sort_block(const struct sort_context* context, size_t start, size_t length) {
+	const size_t element_size = context->element_size;
+	char* data = context->base + start * element_size;
+	char* scratch = context->buffer + start * element_size;
+
+	for (size_t run_start = 0; run_start < length; run_start += PTHREADPOOL_SORT_INSERTION_RUN) {
+		/* The scratch space of the block serves as temporary storage for one element */
+		insertion_sort(context, data + run_start * element_size, min(length - run_start, PTHREADPOOL_SORT_INSERTION_RUN), scratch);
+	}
+
+	char* input = data;
+	char* output = scratch;
+	for (size_t width = PTHREADPOOL_SORT_INSERTION_RUN; width < length; width *= 2) {
+		for (size_t left = 0; left < length; left += 2 * width) {
+			const size_t middle = min(left + width, length);
+			const size_t right = min(left + 2 * width, length);
+			merge(context,
+				input + left * element_size, middle - left,
+				input + middle * element_size, right - middle,
+				output + left * element_size);
+		}
+		char* temp = input;
+		input = output;
+		output = temp;
+	}
+	if (input != data) {
+		memcpy(data, input, length * element_size);
+	}
+}
+
+static void merge_runs(const struct sort_context* context, size_t start, size_t length) {
+	const size_t element_size = context->element_size;
+	const size_t count = context->count;
+	const size_t run_size = context->run_size;
+
+	/* A chunk of the output can span the boundary between two merged runs */
+	const size_t end = start + length;
+	size_t position = start;
+	while (position != end) {
+		const size_t pair_start = position - position % (2 * run_size);
+		const size_t pair_middle = min(pair_start + run_size, count);
+		const size_t pair_end = min(pair_start + 2 * run_size, count);
+		const size_t chunk_end = min(end, pair_end);
+
+		const char* a = context->input + pair_start * element_size;
+		const char* b = context->input + pair_middle * element_size;
+		const size_t a_count = pair_middle - pair_start;
+		const size_t b_count = pair_end - pair_middle;
+		const size_t k_start = position - pair_start;
+		const size_t k_end = chunk_end - pair_start;
+		const size_t i_start = merge_path(context, a, a_count, b, b_count, k_start);
+		const size_t i_end = merge_path(context, a, a_count, b, b_count, k_end);
+		merge(context,
+			a + i_start * element_size, i_end - i_start,
+			b + (k_start - i_start) * element_size, (k_end - i_end) - (k_start - i_start),
+			context->output + position * element_size);
+
+		position = chunk_end;
+	}
+}
+
+static void swap_elements(char* a, char* b, size_t element_size) {
+	for (size_t i = 0; i < element_size; i++) {
+		const char temp = a[i];
+		a[i] = b[i];
+		b[i] = temp;
+	}
+}
+
+static void sift_down(const struct sort_context* context, char* base, size_t root, size_t count) {
+	const size_t element_size = context->element_size;
+	for (size_t child; (child = 2 * root + 1) < count; root = child) {
+		if (child + 1 < count &&
+			context->compare(context->compare_context, base + child * element_size, base + (child + 1) * element_size) < 0)
+		{
+			child += 1;
+		}
+		if (context->compare(context->compare_context, base + root * element_size, base + child * element_size) >= 0) {
+			return;
+		}
+		swap_elements(base + root * element_size, base + child * element_size, element_size);
+	}
+}
+
+/* In-place fallback if the temporary buffer could not be allocated. Unlike the merge sort, heap sort is not stable. */
+static void heap_sort(const struct sort_context* context, char* base, size_t count) {
+	for (size_t root = count / 2; root != 0; root--) {
+		sift_down(context, base, root - 1, count);
+	}
+	for (size_t end = count; end > 1; end--) {
+		swap_elements(base, base + (end - 1) * context->element_size, context->element_size);
+		sift_down(context, base, 0, end - 1);
+	}
+}
+
+void pthreadpool_sort(
+	pthreadpool_t threadpool,
+	pthreadpool_compare_t compare,
+	void* context,
+	void* base,
+	size_t element_size,
+	size_t count,
+	uint32_t flags)
+{
+	if (count <= 1) {
+		return;
+	}
+
+	struct sort_context sort_context = {
+		.compare = compare,
+		.compare_context = context,
+		.element_size = element_size,
+		.count = count,
+		.base = (char*) base,
+		.buffer = malloc(count * element_size),
+	};
+	if (sort_context.buffer == NULL) {
+		heap_sort(&sort_context, (char*) base, count);
+		return;
+	}
+
+	const size_t block_size = sort_block_size(threadpool, count);
+	pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) sort_block, &sort_context, count, block_size, flags);
+
+	sort_context.input = sort_context.base;
+	sort_context.output = sort_context.buffer;
+	for (size_t run_size = block_size; run_size < count; run_size *= 2) {
+		sort_context.run_size = run_size;
+		pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) merge_runs, &sort_context, count, block_size, flags);
+
+		char* temp = (char*) sort_context.input;
+		sort_context.input = sort_context.output;
+		sort_context.output = temp;
+	}
+	if (sort_context.input != sort_context.base) {
+		parallel_copy(threadpool, sort_context.input, base, element_size, count, block_size, flags);
+	}
+
+	free(sort_context.buffer);
+}
+
+/*
+ * Integer sort: LSD radix sort with 8-bit digits. Every pass builds per-block histograms of the digit in parallel, turns
+ * them into per-block output offsets on the calling thread, and scatters the keys of every block in parallel. Keys of a
+ * block keep their relative order, so every pass is stable. Passes where all keys have the same digit are skipped.
+ */
+
+struct radix_sort_context {
+	const void* input;
+	void* output;
+	size_t block_size;
+	uint32_t shift;
+	/* PTHREADPOOL_RADIX_BINS counters per block: digit counts after the first step, output offsets after the second */
+	size_t* histograms;
+};
+
+/* Converts digit counts into output offsets. Returns false if all keys have the same digit and the pass can be skipped. */
+static bool compute_radix_offsets(size_t* histograms, size_t blocks, size_t count) {
+	size_t offset = 0;
+	for (size_t bin = 0; bin < PTHREADPOOL_RADIX_BINS; bin++) {
+		const size_t bin_start = offset;
+		for (size_t block = 0; block < blocks; block++) {
+			const size_t bin_count = histograms[block * PTHREADPOOL_RADIX_BINS + bin];
+			histograms[block * PTHREADPOOL_RADIX_BINS + bin] = offset;
+			offset += bin_count;
+		}
+		if (offset - bin_start == count) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static void histogram_block_u32(const struct radix_sort_context* context, size_t start, size_t length) {
+	const uint32_t* input = (const uint32_t*) context->input + start;
+	const uint32_t shift = context->shift;
+	size_t* histogram = context->histograms + (start / context->block_size) * PTHREADPOOL_RADIX_BINS;
+	memset(histogram, 0, PTHREADPOOL_RADIX_BINS * sizeof(size_t));
+	for (size_t i = 0; i < length; i++) {
+		histogram[(input[i] >> shift) & (PTHREADPOOL_RADIX_BINS - 1)] += 1;
+	}
+}
+
+static void scatter_block_u32(const struct radix_sort_context* context, size_t start, size_t length) {
+	const uint32_t* input = (const uint32_t*) context->input + start;
+	uint32_t* output = (uint32_t*) context->output;
+	const uint32_t shift = context->shift;
+	size_t offsets[PTHREADPOOL_RADIX_BINS];
+	memcpy(offsets, context->histograms + (start / context->block_size) * PTHREADPOOL_RADIX_BINS, sizeof(offsets));
+	for (size_t i = 0; i < length; i++) {
+		const uint32_t key = input[i];
+		output[offsets[(key >> shift) & (PTHREADPOOL_RADIX_BINS - 1)]++] = key;
+	}
+}
+
+static int compare_u32(const void* a, const void* b) {
+	const uint32_t key_a = *((const uint32_t*) a);
+	const uint32_t key_b = *((const uint32_t*) b);
+	return (key_a > key_b) - (key_a < key_b);
+}
+
+void pthreadpool_sort_u32(
+	pthreadpool_t threadpool,
+	uint32_t* keys,
+	size_t count,
+	uint32_t flags)
+{
+	if (count <= 1) {
+		return;
+	}
+
+	const size_t block_size = sort_block_size(threadpool, count);
+	const size_t blocks = divide_round_up(count, block_size);
+	uint32_t* buffer = malloc(count * sizeof(uint32_t));
+	size_t* histograms = malloc(blocks * PTHREADPOOL_RADIX_BINS * sizeof(size_t));
+	if (buffer == NULL || histograms == NULL) {
+		free(buffer);
+		free(histograms);
+		qsort(keys, count, sizeof(uint32_t), compare_u32);
+		return;
+	}
+
+	struct radix_sort_context context = {
+		.input = keys,
+		.output = buffer,
+		.block_size = block_size,
+		.histograms = histograms,
+	};
+	for (uint32_t shift = 0; shift < 32; shift += PTHREADPOOL_RADIX_BITS) {
+		context.shift = shift;
+		pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) histogram_block_u32, &context, count, block_size, flags);
+		if (compute_radix_offsets(histograms, blocks, count)) {
+			pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) scatter_block_u32, &context, count, block_size, flags);
+
+			const void* temp = context.input;
+			context.input = context.output;
+			context.output = (void*) temp;
+		}
+	}
+	if (context.input != keys) {
+		parallel_copy(threadpool, context.input, keys, sizeof(uint32_t), count, block_size, flags);
+	}
+
+	free(buffer);
+	free(histograms);
+}
+
+static void histogram_block_u64(const struct radix_sort_context* context, size_t start, size_t length) {
+	const uint64_t* input = (const uint64_t*) context->input + start;
+	const uint32_t shift = context->shift;
+	size_t* histogram = context->histograms + (start / context->block_size) * PTHREADPOOL_RADIX_BINS;
+	memset(histogram, 0, PTHREADPOOL_RADIX_BINS * sizeof(size_t));
+	for (size_t i = 0; i < length; i++) {
+		histogram[(size_t) (input[i] >> shift) & (PTHREADPOOL_RADIX_BINS - 1)] += 1;
+	}
+}
+
+static void scatter_block_u64(const struct radix_sort_context* context, size_t start, size_t length) {
+	const uint64_t* input = (const uint64_t*) context->input + start;
+	uint64_t* output = (uint64_t*) context->output;
+	const uint32_t shift = context->shift;
+	size_t offsets[PTHREADPOOL_RADIX_BINS];
+	memcpy(offsets, context->histograms + (start / context->block_size) * PTHREADPOOL_RADIX_BINS, sizeof(offsets));
+	for (size_t i = 0; i < length; i++) {
+		const uint64_t key = input[i];
+		output[offsets[(size_t) (key >> shift) & (PTHREADPOOL_RADIX_BINS - 1)]++] = key;
+	}
+}
+
+static int compare_u64(const void* a, const void* b) {
+	const uint64_t key_a = *((const uint64_t*) a);
+	const uint64_t key_b = *((const uint64_t*) b);
+	return (key_a > key_b) - (key_a < key_b);
+}
+
+void pthreadpool_sort_u64(
+	pthreadpool_t threadpool,
+	uint64_t* keys,
+	size_t count,
+	uint32_t flags)
+{
+	if (count <= 1) {
+		return;
+	}
+
+	const size_t block_size = sort_block_size(threadpool, count);
+	const size_t blocks = divide_round_up(count, block_size);
+	uint64_t* buffer = malloc(count * sizeof(uint64_t));
+	size_t* histograms = malloc(blocks * PTHREADPOOL_RADIX_BINS * sizeof(size_t));
+	if (buffer == NULL || histograms == NULL) {
+		free(buffer);
+		free(histograms);
+		qsort(keys, count, sizeof(uint64_t), compare_u64);
+		return;
+	}
+
+	struct radix_sort_context context = {
+		.input = keys,
+		.output = buffer,
+		.block_size = block_size,
+		.histograms = histograms,
+	};
+	for (uint32_t shift = 0; shift < 64; shift += PTHREADPOOL_RADIX_BITS) {
+		context.shift = shift;
+		pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) histogram_block_u64, &context, count, block_size, flags);
+		if (compute_radix_offsets(histograms, blocks, count)) {
+			pthreadpool_parallelize_1d_tile_1d(threadpool, (pthreadpool_task_1d_tile_1d_t) scatter_block_u64, &context, count, block_size, flags);
+
+			const void* temp = context.input;
+			context.input = context.output;
+			context.output = (void*) temp;
+		}
+	}
+	if (context.input != keys) {
+		parallel_copy(threadpool, context.input, keys, sizeof(uint64_t), count, block_size, flags);
+	}
+
+	free(buffer);
+	free(histograms);
+}
@@ -129,6 +129,37 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return __c11_atomic_fetch_add(address, 1, __ATOMIC_RELAXED) + 1;
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return __c11_atomic_fetch_sub(address, value, __ATOMIC_RELAXED) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		return __c11_atomic_compare_exchange_weak(
+			address, expected_value, new_value, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		return __c11_atomic_compare_exchange_weak(
+			address, expected_value, new_value, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__c11_atomic_thread_fence(__ATOMIC_ACQUIRE);
 	}
@@ -252,6 +283,37 @@
 		#endif
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return atomic_fetch_add_explicit(address, 1, memory_order_relaxed) + 1;
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return atomic_fetch_sub_explicit(address, value, memory_order_relaxed) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		return atomic_compare_exchange_weak_explicit(
+			address, expected_value, new_value, memory_order_relaxed, memory_order_relaxed);
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		return atomic_compare_exchange_weak_explicit(
+			address, expected_value, new_value, memory_order_relaxed, memory_order_relaxed);
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		atomic_thread_fence(memory_order_acquire);
 	}
@@ -362,6 +424,45 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return __sync_add_and_fetch(address, 1);
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return __sync_sub_and_fetch(address, value);
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		const uint32_t actual_value = __sync_val_compare_and_swap(address, *expected_value, new_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = __sync_val_compare_and_swap(address, *expected_value, new_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__sync_synchronize();
 	}
@@ -483,6 +584,47 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return (size_t) _InterlockedIncrement_nf((volatile long*) address);
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd_nf((volatile long*) address, -(long) value) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		const uint32_t actual_value = (uint32_t) _InterlockedCompareExchange_nf(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange_nf(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__dmb(_ARM_BARRIER_ISH);
 		_ReadBarrier();
@@ -598,6 +740,47 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return (size_t) _InterlockedIncrement64_nf((volatile __int64*) address);
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd64_nf((volatile __int64*) address, -(__int64) value) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		const uint32_t actual_value = (uint32_t) _InterlockedCompareExchange_nf(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange64_nf(
+			(volatile __int64*) address, (__int64) new_value, (__int64) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		__dmb(_ARM64_BARRIER_ISHLD);
 		_ReadBarrier();
@@ -721,6 +904,47 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return (size_t) _InterlockedIncrement((volatile long*) address);
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd((volatile long*) address, -(long) value) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		const uint32_t actual_value = (uint32_t) _InterlockedCompareExchange(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		_mm_lfence();
 	}
@@ -842,6 +1066,47 @@
 		return false;
 	}
 
+	static inline size_t pthreadpool_increment_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address)
+	{
+		return (size_t) _InterlockedIncrement64((volatile __int64*) address);
+	}
+
+	static inline size_t pthreadpool_subtract_fetch_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t value)
+	{
+		return (size_t) _InterlockedExchangeAdd64((volatile __int64*) address, -(__int64) value) - value;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_uint32_t(
+		pthreadpool_atomic_uint32_t* address,
+		uint32_t* expected_value,
+		uint32_t new_value)
+	{
+		const uint32_t actual_value = (uint32_t) _InterlockedCompareExchange(
+			(volatile long*) address, (long) new_value, (long) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
+	static inline bool pthreadpool_compare_exchange_weak_relaxed_size_t(
+		pthreadpool_atomic_size_t* address,
+		size_t* expected_value,
+		size_t new_value)
+	{
+		const size_t actual_value = (size_t) _InterlockedCompareExchange64(
+			(volatile __int64*) address, (__int64) new_value, (__int64) *expected_value);
+		if (actual_value == *expected_value) {
+			return true;
+		}
+		*expected_value = actual_value;
+		return false;
+	}
+
 	static inline void pthreadpool_fence_acquire() {
 		_mm_lfence();
 		_ReadBarrier();
@@ -39,8 +39,17 @@
 #endif
 
 
-/* Number of iterations in spin-wait loop before going into futex/condvar wait */
-#define PTHREADPOOL_SPIN_WAIT_ITERATIONS 1000000
+/* Default upper bound on the duration of spin-wait loops before going into futex/condvar wait, in nanoseconds */
+#define PTHREADPOOL_SPIN_WAIT_MAX_NS 5000000
+
+/* Duration of the spin-wait for a new command with the adaptive policy when commands come rarely, in nanoseconds */
+#define PTHREADPOOL_SPIN_WAIT_MIN_NS 20000
+
+/* Number of iterations of spin-wait loops between reads of the clock */
+#define PTHREADPOOL_SPIN_CLOCK_ITERATIONS 64
+
+/* Minimum estimated work, in nanoseconds, for each thread which an adaptive plan runs on */
+#define PTHREADPOOL_ADAPTIVE_THREAD_WORK_NS 10000
 
 #define PTHREADPOOL_CACHELINE_SIZE 64
 #if defined(__GNUC__)
@@ -51,6 +60,14 @@
 	#error "Platform-specific implementation of PTHREADPOOL_CACHELINE_ALIGNED required"
 #endif
 
+#if defined(__GNUC__)
+	#define PTHREADPOOL_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+	#define PTHREADPOOL_THREAD_LOCAL __declspec(thread)
+#else
+	#error "Platform-specific implementation of PTHREADPOOL_THREAD_LOCAL required"
+#endif
+
 #if defined(__clang__)
 	#if __has_extension(c_static_assert) || __has_feature(c_static_assert)
 		#define PTHREADPOOL_STATIC_ASSERT(predicate, message) _Static_assert((predicate), message)
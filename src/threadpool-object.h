@@ -1,6 +1,7 @@
 #pragma once
 
 /* Standard C headers */
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -41,6 +42,36 @@ enum threadpool_command {
 	threadpool_command_shutdown,
 };
 
+/**
+ * Publication point of a job: a computation which a thread processes in a private pool structure, outside of the
+ * commands of the thread pool, and which other threads of the pool can join.
+ */
+struct pthreadpool_job_slot {
+	/**
+	 * The private pool structure of the published job.
+	 * Valid while bit 0 of @a state is set.
+	 */
+	pthreadpool_atomic_void_p job;
+	/**
+	 * 0 if the slot is free. Otherwise, bit 0 is set while @a job accepts helpers, and the other bits count the owning
+	 * thread and the helpers inside the job, in units of 2. The owning thread waits until it is the only one left
+	 * before it frees the slot and releases the job.
+	 */
+	pthreadpool_atomic_size_t state;
+	/**
+	 * Non-zero if the published job has PTHREADPOOL_FLAG_HIGH_PRIORITY. Set before @a state publishes the job.
+	 */
+	pthreadpool_atomic_uint32_t urgent;
+	/**
+	 * Advanced by the last helper to leave a job which stopped accepting helpers. The owning thread waits for its
+	 * change in pthreadpool_wait_for_change.
+	 */
+	pthreadpool_atomic_uint32_t departures;
+};
+
+/* Number of concurrent jobs from different submitting threads which a thread pool can publish at the same time */
+#define PTHREADPOOL_CONCURRENT_JOB_SLOTS 8
+
 struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	/**
 	 * Index of the first element in the work range.
@@ -49,16 +80,21 @@ struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	pthreadpool_atomic_size_t range_start;
 	/**
 	 * Index of the element after the last element of the work range.
-	 * Before processing a new element the stealing worker thread decrements this value.
+	 * Stealing worker threads decrement this value by the number of elements they take from the end of the range.
 	 */
 	pthreadpool_atomic_size_t range_end;
 	/**
 	 * The number of elements in the work range.
 	 * Due to race conditions range_length <= range_end - range_start.
 	 * The owning worker thread must decrement this value before incrementing @a range_start.
-	 * The stealing worker thread must decrement this value before decrementing @a range_end.
+	 * The stealing worker thread must decrement this value before decrementing @a range_end by the same amount.
 	 */
 	pthreadpool_atomic_size_t range_length;
+	/**
+	 * The number of stealing worker threads which may be between decrementing @a range_length and updating @a range_end.
+	 * The owning worker thread must wait until this value drops to zero before it replaces an exhausted work range.
+	 */
+	pthreadpool_atomic_size_t steal_pending;
 	/**
 	 * Thread number in the 0..threads_count-1 range.
 	 */
@@ -67,12 +103,71 @@ struct PTHREADPOOL_CACHELINE_ALIGNED thread_info {
 	 * Thread pool which owns the thread.
 	 */
 	struct pthreadpool* threadpool;
+	/**
+	 * State of the pseudo-random generator for randomized victim selection.
+	 * Only the owning worker thread reads and updates this value, and only after its own work range is exhausted.
+	 */
+	uint32_t steal_seed;
+	/**
+	 * Identifier of the last-level cache shared by the processor where the thread started.
+	 * Threads with the same value are preferred as victims for work stealing.
+	 */
+	uint32_t cache_domain;
+	/**
+	 * Identifier of the NUMA node of the processor where the thread started.
+	 * Threads with the same value are preferred as victims over threads on other NUMA nodes.
+	 */
+	uint32_t numa_domain;
+	/**
+	 * Relative throughput of the thread, used to size its share of the initial work split.
+	 * If all threads in the pool have the same weight, work is split evenly.
+	 */
+	uint32_t weight;
+	/**
+	 * The number of items the thread processed during the last parallelization command.
+	 * Only the owning worker thread updates this value, and the master thread reads it before the next command.
+	 */
+	size_t processed_items;
+	/**
+	 * Non-zero after the thread ran out of work in the current parallelization command.
+	 * Reset when the work ranges of the next command are partitioned.
+	 */
+	pthreadpool_atomic_uint32_t out_of_work;
+	/**
+	 * Publishes the nested job started by a task running on this thread, so that threads out of work can join it.
+	 */
+	struct pthreadpool_job_slot nested_slot;
+	/**
+	 * Publishes the computations of the team whose first thread is this thread, if any.
+	 */
+	struct pthreadpool_job_slot team_slot;
+	/**
+	 * The team slot of the team which this thread belongs to, or NULL. Threads look for jobs to help with there first.
+	 */
+	pthreadpool_atomic_void_p team_job_slot;
+	/**
+	 * The value of @a urgent_epoch of the thread pool when the thread last looked for high-priority jobs.
+	 * Only the thread which processes the work range of this thread reads and updates this value.
+	 */
+	size_t urgent_epoch;
 #if PTHREADPOOL_USE_CONDVAR || PTHREADPOOL_USE_FUTEX
+	/**
+	 * Wake-up word of the worker thread. Bit 0 is set while the thread sleeps until a new command or a job, and the
+	 * other bits count the wake-ups of the thread. Threads which need this thread for a command or a job advance the
+	 * count, which clears bit 0, and wake the thread up only if it was asleep.
+	 */
+	pthreadpool_atomic_uint32_t wake_signal;
 	/**
 	 * The pthread object corresponding to the thread.
 	 */
 	pthread_t thread_object;
 #endif
+#if PTHREADPOOL_USE_CONDVAR
+	/**
+	 * Condition variable to wait for change of the @a wake_signal variable, used with the command mutex of the pool.
+	 */
+	pthread_cond_t wake_condvar;
+#endif
 #if PTHREADPOOL_USE_EVENT
 	/**
 	 * The Windows thread handle corresponding to the thread.
@@ -106,6 +201,59 @@ struct pthreadpool_1d_tile_1d_params {
 	size_t tile;
 };
 
+struct pthreadpool_1d_with_grain_params {
+	/**
+	 * Maximum number of items claimed with a single atomic operation on the range_length of the owning thread.
+	 * Derived from the range and the number of threads if the grain argument to the
+	 * pthreadpool_parallelize_1d_with_grain function was zero.
+	 */
+	size_t grain;
+};
+
+struct pthreadpool_1d_reduce_params {
+	/**
+	 * Copy of the range argument passed to the pthreadpool_parallelize_1d_reduce function.
+	 */
+	size_t range;
+	/**
+	 * Copy of the tile argument passed to the pthreadpool_parallelize_1d_reduce function.
+	 */
+	size_t tile;
+	/**
+	 * Copy of the combine argument passed to the pthreadpool_parallelize_1d_reduce function.
+	 */
+	pthreadpool_combine_t combine;
+	/**
+	 * Copy of the identity argument passed to the pthreadpool_parallelize_1d_reduce function.
+	 */
+	const void* identity;
+	/**
+	 * Copy of the value_size argument passed to the pthreadpool_parallelize_1d_reduce function.
+	 */
+	size_t value_size;
+	/**
+	 * Distance in bytes between partial results of consecutive threads, a multiple of the cache line size.
+	 */
+	size_t partial_stride;
+	/**
+	 * Cache line-aligned array of per-thread partial results, partial_stride bytes per thread.
+	 */
+	char* partials;
+	/**
+	 * Arrival counters of the combining tree. The counter at index n > 0 guards the merge of the partial result of
+	 * thread n into the partial result of thread n - (n & -n), and is initialized to 2 before the computation.
+	 */
+	pthreadpool_atomic_size_t* arrivals;
+};
+
+struct pthreadpool_1d_find_first_params {
+	/**
+	 * Lowest index of an item which satisfies the predicate among the items checked so far, or the range argument
+	 * passed to the pthreadpool_parallelize_1d_find_first function if no such item was found.
+	 */
+	pthreadpool_atomic_size_t* first_index;
+};
+
 struct pthreadpool_2d_params {
 	/**
 	 * FXdiv divisor for the range_j argument passed to the pthreadpool_parallelize_2d function.
@@ -174,6 +322,37 @@ struct pthreadpool_2d_tile_2d_params {
 	struct fxdiv_divisor_size_t tile_range_j;
 };
 
+struct pthreadpool_2d_tile_2d_morton_params {
+	/**
+	 * Copy of the range_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
+	 */
+	size_t range_i;
+	/**
+	 * Copy of the tile_i argument passed to the pthreadpool_parallelize_2d_tile_2d function.
+	 */
+	size_t tile_i;
+	/**
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
+	 */
+	size_t range_j;
+	/**
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_2d_tile_2d function.
+	 */
+	size_t tile_j;
+	/**
+	 * divide_round_up(range_i, tile_i) value.
+	 */
+	size_t tile_range_i;
+	/**
+	 * divide_round_up(range_j, tile_j) value.
+	 */
+	size_t tile_range_j;
+	/**
+	 * Smallest power of 2 not less than tile_range_i and tile_range_j: side of the square Z-order curve.
+	 */
+	size_t morton_size;
+};
+
 struct pthreadpool_2d_tile_2d_with_uarch_params {
 	/**
 	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_2d_tile_2d_with_uarch function.
@@ -289,6 +468,41 @@ struct pthreadpool_3d_tile_2d_params {
 	struct fxdiv_divisor_size_t tile_range_k;
 };
 
+struct pthreadpool_3d_tile_2d_morton_params {
+	/**
+	 * Copy of the range_j argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 */
+	size_t range_j;
+	/**
+	 * Copy of the tile_j argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 */
+	size_t tile_j;
+	/**
+	 * Copy of the range_k argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 */
+	size_t range_k;
+	/**
+	 * Copy of the tile_k argument passed to the pthreadpool_parallelize_3d_tile_2d function.
+	 */
+	size_t tile_k;
+	/**
+	 * divide_round_up(range_j, tile_j) value.
+	 */
+	size_t tile_range_j;
+	/**
+	 * divide_round_up(range_k, tile_k) value.
+	 */
+	size_t tile_range_k;
+	/**
+	 * Smallest power of 2 not less than tile_range_j and tile_range_k: side of the square Z-order curve.
+	 */
+	size_t morton_size;
+	/**
+	 * FXdiv divisor for the divide_round_up(range_j, tile_j) * divide_round_up(range_k, tile_k) value.
+	 */
+	struct fxdiv_divisor_size_t tile_range_jk;
+};
+
 struct pthreadpool_3d_tile_2d_with_uarch_params {
 	/**
 	 * Copy of the default_uarch_index argument passed to the pthreadpool_parallelize_3d_tile_2d_with_uarch function.
@@ -672,18 +886,23 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 * Additional parallelization parameters.
 	 * These parameters are specific for each thread_function.
 	 */
-	union {
+	union pthreadpool_params {
 		struct pthreadpool_1d_with_uarch_params parallelize_1d_with_uarch;
 		struct pthreadpool_1d_tile_1d_params parallelize_1d_tile_1d;
+		struct pthreadpool_1d_with_grain_params parallelize_1d_with_grain;
+		struct pthreadpool_1d_reduce_params parallelize_1d_reduce;
+		struct pthreadpool_1d_find_first_params parallelize_1d_find_first;
 		struct pthreadpool_2d_params parallelize_2d;
 		struct pthreadpool_2d_tile_1d_params parallelize_2d_tile_1d;
 		struct pthreadpool_2d_tile_1d_with_uarch_params parallelize_2d_tile_1d_with_uarch;
 		struct pthreadpool_2d_tile_2d_params parallelize_2d_tile_2d;
+		struct pthreadpool_2d_tile_2d_morton_params parallelize_2d_tile_2d_morton;
 		struct pthreadpool_2d_tile_2d_with_uarch_params parallelize_2d_tile_2d_with_uarch;
 		struct pthreadpool_3d_params parallelize_3d;
 		struct pthreadpool_3d_tile_1d_params parallelize_3d_tile_1d;
 		struct pthreadpool_3d_tile_1d_with_uarch_params parallelize_3d_tile_1d_with_uarch;
 		struct pthreadpool_3d_tile_2d_params parallelize_3d_tile_2d;
+		struct pthreadpool_3d_tile_2d_morton_params parallelize_3d_tile_2d_morton;
 		struct pthreadpool_3d_tile_2d_with_uarch_params parallelize_3d_tile_2d_with_uarch;
 		struct pthreadpool_4d_params parallelize_4d;
 		struct pthreadpool_4d_tile_1d_params parallelize_4d_tile_1d;
@@ -700,6 +919,84 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 * Copy of the flags passed to a parallelization function.
 	 */
 	pthreadpool_atomic_uint32_t flags;
+	/**
+	 * Non-zero if a task cancelled the current computation with pthreadpool_cancel.
+	 * Reset when the work ranges of the next computation are partitioned.
+	 */
+	pthreadpool_atomic_uint32_t cancelled;
+	/**
+	 * Non-zero once a nested or concurrent job ran on the thread pool.
+	 * Threads out of work then look for published jobs to help with.
+	 */
+	pthreadpool_atomic_uint32_t has_jobs;
+	/**
+	 * Publishes jobs submitted while another thread runs a command on the thread pool.
+	 */
+	struct pthreadpool_job_slot concurrent_slots[PTHREADPOOL_CONCURRENT_JOB_SLOTS];
+	/**
+	 * For the private pool structure of a job, the thread pool which runs the job, and NULL otherwise.
+	 */
+	struct pthreadpool* parent;
+	/**
+	 * For the private pool structure of a job, the number of its thread slots taken by the owning thread and helpers.
+	 */
+	pthreadpool_atomic_size_t job_slots;
+	/**
+	 * For the private pool structure of an asynchronous job, the computation which the job processes, and NULL otherwise.
+	 */
+	struct pthreadpool_async* async;
+	/**
+	 * For a team, the thread pool whose threads process the computations of the team, and NULL otherwise.
+	 */
+	struct pthreadpool* team_threadpool;
+	/**
+	 * For a team, the job slot where the computations of the team are published for the threads of the team.
+	 */
+	struct pthreadpool_job_slot* team_slot;
+	/**
+	 * The thread pool whose high-priority jobs preempt the computations of this pool structure between items: the
+	 * thread pool itself, the thread pool of a team, the same pool as the parent of a job, and NULL for high-priority
+	 * jobs, which are never preempted.
+	 */
+	struct pthreadpool* urgent_pool;
+	/**
+	 * Incremented after every high-priority job is published on the thread pool. Threads which observe a change look
+	 * for high-priority jobs in the job slots between items of their current computation.
+	 */
+	pthreadpool_atomic_size_t urgent_epoch;
+	/**
+	 * Spin-wait policy of the thread pool: PTHREADPOOL_SPIN_POLICY_FIXED or PTHREADPOOL_SPIN_POLICY_ADAPTIVE.
+	 */
+	uint32_t spin_policy;
+	/**
+	 * Upper bound on the duration of spin-wait loops, in nanoseconds. Zero disables spinning.
+	 */
+	pthreadpool_atomic_size_t max_spin_ns;
+	/**
+	 * Duration of the spin-wait of worker threads for a new command, in nanoseconds. With the adaptive policy, the
+	 * thread which submits commands updates it from the observed gaps between commands.
+	 */
+	pthreadpool_atomic_size_t spin_wait_ns;
+	/**
+	 * For the adaptive spin-wait policy, the time when the last command completed, or 0 before the first command.
+	 * Only the thread which holds the thread pool for a command reads and updates it.
+	 */
+	uint64_t last_command_end_ns;
+	/**
+	 * For the adaptive spin-wait policy, the moving average of the gaps between commands which a spinning worker would
+	 * have covered, in nanoseconds, and the moving average of the fraction of such gaps.
+	 */
+	double short_gap_ns;
+	double short_gap_rate;
+	/**
+	 * The number of threads of the running SPMD computation which did not arrive yet at the barrier in
+	 * pthreadpool_barrier_wait. The last thread to arrive resets it to the number of threads in the thread pool.
+	 */
+	pthreadpool_atomic_size_t barrier_waiting_threads;
+	/**
+	 * Sense of the barrier, flipped by the last thread to arrive. Threads which sleep at the barrier wait for its change.
+	 */
+	pthreadpool_atomic_uint32_t barrier_sense;
 #if PTHREADPOOL_USE_CONDVAR || PTHREADPOOL_USE_FUTEX
 	/**
 	 * Serializes concurrent calls to @a pthreadpool_parallelize_* from different threads.
@@ -728,13 +1025,14 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 */
 	pthread_cond_t completion_condvar;
 	/**
-	 * Guards access to the @a command variable.
+	 * Guards access to the @a command and @a barrier_sense variables, and to the @a wake_signal variables of the threads.
 	 */
 	pthread_mutex_t command_mutex;
 	/**
-	 * Condition variable to wait for change of the @a command variable.
+	 * Condition variable to wait for change of the @a barrier_sense variable, and of the counters which threads wait
+	 * for in pthreadpool_wait_for_change.
 	 */
-	pthread_cond_t command_condvar;
+	pthread_cond_t barrier_condvar;
 #endif
 #if PTHREADPOOL_USE_EVENT
 	/**
@@ -749,10 +1047,24 @@ struct PTHREADPOOL_CACHELINE_ALIGNED pthreadpool {
 	 * submitted command according to the high bit of the command word.
 	 */
 	HANDLE command_event[2];
+	/**
+	 * Manual-reset event to wake up the workers waiting for a command when a thread publishes an asynchronous job.
+	 */
+	HANDLE jobs_event;
+	/**
+	 * Events to wait on for change of the @a barrier_sense variable, indexed by its new value.
+	 */
+	HANDLE barrier_event[2];
+#endif
+#if PTHREADPOOL_USE_GCD
+	/**
+	 * Tracks the blocks dispatched to help with asynchronous jobs, which pthreadpool_destroy waits for.
+	 */
+	dispatch_group_t helpers_group;
 #endif
 	/**
 	 * FXdiv divisor for the number of threads in the thread pool.
-	 * This struct never change after pthreadpool_create.
+	 * This struct never change after pthreadpool_create, except in teams repartitioned with pthreadpool_set_team_threads.
 	 */
 	struct fxdiv_divisor_size_t threads_count;
 	/**
@@ -772,6 +1084,190 @@ PTHREADPOOL_INTERNAL void pthreadpool_deallocate(
 
 typedef void (*thread_function_t)(struct pthreadpool* threadpool, struct thread_info* thread);
 
+/**
+ * Initial work range of one thread: items [start, end).
+ */
+struct pthreadpool_range {
+	size_t start;
+	size_t end;
+};
+
+struct pthreadpool_plan {
+	/**
+	 * Copy of the threadpool argument passed to the pthreadpool_create_plan_* function.
+	 */
+	struct pthreadpool* threadpool;
+	/**
+	 * Runs the plan on the calling thread through the corresponding pthreadpool_parallelize_* function.
+	 * Used when @a thread_function is NULL.
+	 */
+	void (*run_sequentially)(const struct pthreadpool_plan* plan);
+	/**
+	 * Copy of the task argument passed to the pthreadpool_create_plan_* function.
+	 */
+	void* task;
+	/**
+	 * Copy of the argument passed to the pthreadpool_create_plan_* function.
+	 */
+	void* argument;
+	/**
+	 * Copies of the range_* arguments passed to the pthreadpool_create_plan_* function.
+	 */
+	size_t range[3];
+	/**
+	 * Copies of the tile_* arguments passed to the pthreadpool_create_plan_* function.
+	 */
+	size_t tile[2];
+	/**
+	 * Copy of the flags passed to the pthreadpool_create_plan_* function.
+	 */
+	uint32_t flags;
+	/**
+	 * Thread function which processes the plan in the thread pool, or NULL if the plan runs on the calling thread.
+	 */
+	thread_function_t thread_function;
+	/**
+	 * Number of items which the thread function processes.
+	 */
+	size_t linear_range;
+	/**
+	 * Size of the meaningful part of @a params, in bytes.
+	 */
+	size_t params_size;
+	/**
+	 * Parallelization parameters for the thread function, copied into the thread pool on every run.
+	 */
+	union pthreadpool_params params;
+	/**
+	 * The number of threads which process the plan, if @a thread_function is not NULL: all threads of the thread pool
+	 * unless pthreadpool_set_plan_max_threads limited it.
+	 */
+	struct fxdiv_divisor_size_t threads_count;
+	/**
+	 * Estimated processing time of one item of the linear range in picoseconds, or 0 before the first run.
+	 * Learned from previous runs if @a flags include PTHREADPOOL_FLAG_ADAPTIVE_THREADS.
+	 */
+	pthreadpool_atomic_size_t item_cost;
+	/**
+	 * Initial work ranges of the threads in the thread pool, if @a thread_function is not NULL.
+	 * The ranges of threads beyond @a threads_count are empty.
+	 */
+	struct pthreadpool_range ranges[];
+};
+
+struct pthreadpool_async {
+	/**
+	 * Private pool structure of the job which processes the computation, or NULL if the computation completed on the
+	 * thread which started it.
+	 */
+	struct pthreadpool* job;
+	/**
+	 * The concurrent job slot which publishes @a job, or NULL once pthreadpool_wait_async freed it.
+	 */
+	struct pthreadpool_job_slot* job_slot;
+	/**
+	 * The number of thread slots of @a job which are not processed yet.
+	 */
+	pthreadpool_atomic_size_t pending_slots;
+	/**
+	 * Non-zero once all thread slots of @a job are processed and the completion callback returned.
+	 */
+	pthreadpool_atomic_uint32_t completed;
+	/**
+	 * Copy of the callback argument passed to the pthreadpool_*_async function.
+	 */
+	pthreadpool_async_callback_t callback;
+	/**
+	 * Copy of the callback_context argument passed to the pthreadpool_*_async function.
+	 */
+	void* callback_context;
+};
+
+struct pthreadpool_graph_node {
+	/**
+	 * Copy of the plan argument passed to pthreadpool_add_graph_node.
+	 */
+	struct pthreadpool_plan* plan;
+	/**
+	 * Private pool structure with thread slots for all threads of the graph's thread pool, which processes the node.
+	 * NULL until the plan needs more than one thread.
+	 */
+	struct pthreadpool* job;
+	/**
+	 * The number of slots which the threads processing the graph claim during the current run: the thread limit of
+	 * the plan, or a single slot for plans which run on one thread.
+	 */
+	size_t slots_count;
+	/**
+	 * The number of slots claimed during the current run of the graph.
+	 */
+	pthreadpool_atomic_size_t claimed_slots;
+	/**
+	 * The number of claimed slots which are not processed yet, plus the unclaimed slots.
+	 */
+	pthreadpool_atomic_size_t pending_slots;
+	/**
+	 * The number of nodes which must complete before this node starts.
+	 */
+	size_t predecessors_count;
+	/**
+	 * The number of predecessors which did not complete yet during the current run of the graph.
+	 */
+	pthreadpool_atomic_size_t pending_predecessors;
+	/**
+	 * Indices of the nodes which depend on this node. Always greater than the index of this node.
+	 */
+	size_t* successors;
+	size_t successors_count;
+	size_t successors_capacity;
+};
+
+struct pthreadpool_graph {
+	/**
+	 * Copy of the threadpool argument passed to pthreadpool_create_graph.
+	 */
+	struct pthreadpool* threadpool;
+	/**
+	 * Nodes of the graph in the order of pthreadpool_add_graph_node calls, which is also a topological order.
+	 */
+	struct pthreadpool_graph_node* nodes;
+	size_t nodes_count;
+	size_t nodes_capacity;
+	/**
+	 * The number of nodes which did not complete yet during the current run of the graph.
+	 */
+	pthreadpool_atomic_size_t pending_nodes;
+	/**
+	 * Advanced every time a node completes. Threads which find every slot of the ready nodes claimed wait for its
+	 * change in pthreadpool_wait_for_change.
+	 */
+	pthreadpool_atomic_uint32_t progress;
+	/**
+	 * PTHREADPOOL_FLAG_YIELD_WORKERS if any node of the graph uses it: then waiting threads sleep without spinning.
+	 */
+	uint32_t flags;
+};
+
+struct pthreadpool_batch {
+	/**
+	 * Copies of the plans and plans_count arguments passed to pthreadpool_run_batch.
+	 */
+	struct pthreadpool_plan* const* plans;
+	size_t plans_count;
+	/**
+	 * Index of the plan which the threads process. Written only by the last thread to arrive at the barrier.
+	 */
+	size_t plan_index;
+	/**
+	 * The number of threads which did not arrive at the barrier yet.
+	 */
+	pthreadpool_atomic_size_t waiting_threads;
+	/**
+	 * The number of times threads passed the barrier.
+	 */
+	pthreadpool_atomic_size_t barrier_generation;
+};
+
 PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
@@ -782,6 +1278,217 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	size_t linear_range,
 	uint32_t flags);
 
+/**
+ * Same as pthreadpool_parallelize, but uses precomputed initial work ranges of threads if @a ranges is not NULL.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_with_ranges(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags);
+
+/**
+ * Runs the thread function of the current command as @a thread, on the calling system thread.
+ *
+ * Backends must call thread functions through this function: it records the thread in thread-local storage, so that
+ * parallelization functions called by tasks of the command recognize nested calls, and process them without waiting
+ * for the thread pool to finish the command.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_run_thread_function(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	struct thread_info* thread);
+
+/**
+ * Processes a parallelization command as a concurrent job, while another thread runs a command on the thread pool.
+ *
+ * The calling thread processes the job in a private pool structure, and publishes it in one of the concurrent job
+ * slots of the thread pool, so that threads out of work and waiting workers can join it. Backends call this function
+ * instead of waiting for the thread pool. Computations of a team always run this way, published in the job slot of the
+ * team. Takes the same arguments as pthreadpool_parallelize_with_ranges.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_concurrently(
+	struct pthreadpool* threadpool,
+	thread_function_t thread_function,
+	const void* params,
+	size_t params_size,
+	void* task,
+	void* context,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags);
+
+/**
+ * Joins one of the jobs published on the thread pool, if any, and processes one of its thread slots.
+ *
+ * Worker threads call this function while they wait for a new command.
+ *
+ * @returns  true if the calling thread processed a thread slot of a job.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_help_jobs(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread);
+
+/**
+ * Joins the job published in the job slot, if any, and processes one of its thread slots.
+ *
+ * @returns  true if the calling thread processed a thread slot of the job.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_help_job(
+	struct pthreadpool_job_slot* job_slot);
+
+/**
+ * Wakes up to @a helpers_count threads of the thread pool after the calling thread published a job in the job slot,
+ * so that they help with the job even while no command runs on the thread pool. Threads which don't look at the job
+ * slot, such as the threads outside of a team for the job slot of the team, need not wake up. Implemented by each
+ * backend.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_wake_helpers(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_job_slot* job_slot,
+	size_t helpers_count);
+
+/**
+ * Returns the value of a monotonic clock in nanoseconds. Implemented by each backend.
+ */
+PTHREADPOOL_INTERNAL uint64_t pthreadpool_get_time_ns(void);
+
+/**
+ * Updates the spin-wait duration of worker threads from the gap since the last command completed, if the thread pool
+ * uses the adaptive spin-wait policy. The thread which submits a command calls it after it takes the thread pool.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_learn_spin_wait(
+	struct pthreadpool* threadpool);
+
+/**
+ * Records the completion of a command for the adaptive spin-wait policy. The thread which submitted the command calls
+ * it after the worker threads finished, before it releases the thread pool.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_complete_spin_wait(
+	struct pthreadpool* threadpool);
+
+/**
+ * Returns true while a spin-wait loop may continue after the given number of iterations. Reads the clock only every
+ * PTHREADPOOL_SPIN_CLOCK_ITERATIONS iterations, including the first one, so a zero duration disables spinning.
+ */
+static inline bool pthreadpool_keep_spinning(uint32_t iteration, uint64_t deadline_ns) {
+	return iteration % PTHREADPOOL_SPIN_CLOCK_ITERATIONS != 0 || pthreadpool_get_time_ns() < deadline_ns;
+}
+
+/**
+ * Waits until the last thread to arrive at the barrier of an SPMD computation flips @a barrier_sense from @a sense.
+ * Spins first, then sleeps in a backend-specific way.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_wait_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense);
+
+/**
+ * Flips @a barrier_sense to @a sense, and wakes up the threads which sleep at the barrier of an SPMD computation.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_release_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense);
+
+/**
+ * Waits until another thread advances the counter at @a address with pthreadpool_notify_change, after the calling
+ * thread read @a value from it. Spins for the maximum spin-wait duration of the thread pool first, unless @a flags
+ * include PTHREADPOOL_FLAG_YIELD_WORKERS, then sleeps in a backend-specific way. Bit 0 of the counter is reserved for
+ * the backend.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_wait_for_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address,
+	uint32_t value,
+	uint32_t flags);
+
+/**
+ * Advances the counter at @a address, and wakes up the threads which sleep in pthreadpool_wait_for_change for it.
+ * Changes made by the calling thread before the call are visible to the woken threads.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_notify_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address);
+
+/**
+ * Splits the linear range of a parallelization command between threads in the pool.
+ *
+ * Initializes @a range_start, @a range_end, and @a range_length of every thread. Threads get contiguous subranges
+ * proportional to their weights, or equal subranges if all weights are the same. If @a flags include
+ * PTHREADPOOL_FLAG_LEARN_WEIGHTS, the weights are first updated from the items each thread processed during the
+ * previous command.
+ *
+ * @param threadpool    the thread pool which is about to process the command.
+ * @param linear_range  the number of items in the command.
+ * @param ranges        the initial work ranges precomputed by a plan, or NULL to split the range.
+ * @param flags         the flags passed to the parallelization function.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_partition_range(
+	struct pthreadpool* threadpool,
+	size_t linear_range,
+	const struct pthreadpool_range* ranges,
+	uint32_t flags);
+
+/**
+ * Selects the next thread to steal work from.
+ *
+ * @param threadpool   the thread pool which processes the current command.
+ * @param thread       the thread which looks for work to steal.
+ * @param last_victim  the thread returned by the previous call, or @a thread on the first call.
+ *
+ * @returns  a thread other than @a thread which had unprocessed items in its work range when inspected,
+ *    or NULL if no such thread was found.
+ */
+PTHREADPOOL_INTERNAL struct thread_info* pthreadpool_find_victim(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread,
+	struct thread_info* last_victim);
+
+/**
+ * Steals half of the remaining work range of another thread and makes it the work range of the calling thread.
+ *
+ * The calling thread must have exhausted its own work range. On success the stolen items are published in
+ * @a thread->range_start, @a thread->range_end, and @a thread->range_length, so other threads can steal from them.
+ *
+ * @param threadpool  the thread pool which processes the current command.
+ * @param thread      the thread which looks for work to steal.
+ *
+ * Before it returns false in a thread pool which ran jobs, the calling thread helps with nested and concurrent jobs
+ * until all threads are out of work.
+ *
+ * @returns  true if a non-empty range was stolen, and false if no other thread had unprocessed items.
+ */
+PTHREADPOOL_INTERNAL bool pthreadpool_steal_range(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread);
+
+/**
+ * Suspends the computation of the calling thread to help with the high-priority jobs published on the thread pool,
+ * until none of them accepts more helpers.
+ *
+ * @param threadpool  the pool structure of the computation which the calling thread suspends.
+ * @param thread      the thread whose work range the calling thread processes.
+ */
+PTHREADPOOL_INTERNAL void pthreadpool_run_urgent_jobs(
+	struct pthreadpool* threadpool,
+	struct thread_info* thread);
+
+/**
+ * Checks whether a high-priority job was published since the thread last looked, and helps with it first.
+ * Thread functions call it before each item or tile, so high-priority jobs preempt computations at item granularity.
+ */
+static inline void pthreadpool_check_urgent_jobs(struct pthreadpool* threadpool, struct thread_info* thread) {
+	struct pthreadpool* urgent_pool = threadpool->urgent_pool;
+	if (urgent_pool != NULL && pthreadpool_load_relaxed_size_t(&urgent_pool->urgent_epoch) != thread->urgent_epoch) {
+		pthreadpool_run_urgent_jobs(threadpool, thread);
+	}
+}
+
 PTHREADPOOL_INTERNAL void pthreadpool_thread_parallelize_1d_fastpath(
 	struct pthreadpool* threadpool,
 	struct thread_info* thread);
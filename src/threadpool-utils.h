@@ -112,7 +112,7 @@ static inline size_t divide_round_up(size_t dividend, size_t divisor) {
 	}
 }
 
-/* Windows headers define min and max macros; undefine it here */
+/* Windows headers define min and max macros; undefine them here */
 #ifdef min
 	#undef min
 #endif
@@ -120,3 +120,11 @@ static inline size_t divide_round_up(size_t dividend, size_t divisor) {
 static inline size_t min(size_t a, size_t b) {
 	return a < b ? a : b;
 }
+
+#ifdef max
+	#undef max
+#endif
+
+static inline size_t max(size_t a, size_t b) {
+	return a > b ? a : b;
+}
@@ -37,7 +37,8 @@ static void wait_worker_threads(struct pthreadpool* threadpool, uint32_t event_i
 	}
 
 	/* Spin-wait */
-	for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
+	const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
 		pthreadpool_yield();
 
 		active_threads = pthreadpool_load_acquire_size_t(&threadpool->active_threads);
@@ -54,6 +55,7 @@ static void wait_worker_threads(struct pthreadpool* threadpool, uint32_t event_i
 
 static uint32_t wait_for_new_command(
 	struct pthreadpool* threadpool,
+	struct thread_info* thread,
 	uint32_t last_command,
 	uint32_t last_flags)
 {
@@ -64,19 +66,36 @@ static uint32_t wait_for_new_command(
 
 	if ((last_flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
 		/* Spin-wait loop */
-		for (uint32_t i = PTHREADPOOL_SPIN_WAIT_ITERATIONS; i != 0; i--) {
+		const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->spin_wait_ns);
+		for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
 			pthreadpool_yield();
 
 			command = pthreadpool_load_acquire_uint32_t(&threadpool->command);
 			if (command != last_command) {
 				return command;
 			}
+
+			/* Meanwhile, help with concurrent jobs of other submitting threads */
+			pthreadpool_help_jobs(threadpool, thread);
 		}
 	}
 
 	/* Spin-wait disabled or timed out, fall back to event wait */
 	const uint32_t event_index = (last_command >> 31);
-	const DWORD wait_status = WaitForSingleObject(threadpool->command_event[event_index], INFINITE);
+	const HANDLE events[2] = { threadpool->command_event[event_index], threadpool->jobs_event };
+	DWORD wait_status;
+	while ((wait_status = WaitForMultipleObjects(2, events, FALSE /* wait all */, INFINITE)) == WAIT_OBJECT_0 + 1) {
+		/*
+		 * Woken up to help with an asynchronous job.
+		 * Reset the event before looking for jobs: threads which publish jobs later set it again.
+		 */
+		const BOOL reset_event_status = ResetEvent(threadpool->jobs_event);
+		assert(reset_event_status != FALSE);
+
+		while (pthreadpool_help_jobs(threadpool, thread)) {
+			/* Keep helping until no published job has thread slots left */
+		}
+	}
 	assert(wait_status == WAIT_OBJECT_0);
 
 	command = pthreadpool_load_relaxed_uint32_t(&threadpool->command);
@@ -96,7 +115,7 @@ static DWORD WINAPI thread_main(LPVOID arg) {
 
 	/* Monitor new commands and act accordingly */
 	for (;;) {
-		uint32_t command = wait_for_new_command(threadpool, last_command, flags);
+		uint32_t command = wait_for_new_command(threadpool, thread, last_command, flags);
 		pthreadpool_fence_acquire();
 
 		flags = pthreadpool_load_relaxed_uint32_t(&threadpool->flags);
@@ -112,7 +131,7 @@ static DWORD WINAPI thread_main(LPVOID arg) {
 					disable_fpu_denormals();
 				}
 
-				thread_function(threadpool, thread);
+				pthreadpool_run_thread_function(threadpool, thread_function, thread);
 				if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
 					set_fpu_state(saved_fpu_state);
 				}
@@ -147,9 +166,13 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 		return NULL;
 	}
 	threadpool->threads_count = fxdiv_init_size_t(threads_count);
+	threadpool->urgent_pool = threadpool;
+	pthreadpool_set_spin_policy(threadpool, PTHREADPOOL_SPIN_POLICY_ADAPTIVE, PTHREADPOOL_SPIN_WAIT_MAX_NS);
+	pthreadpool_store_relaxed_size_t(&threadpool->barrier_waiting_threads, threads_count);
 	for (size_t tid = 0; tid < threads_count; tid++) {
 		threadpool->threads[tid].thread_number = tid;
 		threadpool->threads[tid].threadpool = threadpool;
+		threadpool->threads[tid].steal_seed = (uint32_t) (tid + 1) * UINT32_C(0x9E3779B9);
 	}
 
 	/* Thread pool with a single thread computes everything on the caller thread. */
@@ -170,6 +193,18 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 				FALSE /* initial state: nonsignaled */,
 				NULL /* name */);
 		}
+		threadpool->jobs_event = CreateEventW(
+			NULL /* event attributes */,
+			TRUE /* manual-reset event: yes */,
+			FALSE /* initial state: nonsignaled */,
+			NULL /* name */);
+		for (size_t i = 0; i < 2; i++) {
+			threadpool->barrier_event[i] = CreateEventW(
+				NULL /* event attributes */,
+				TRUE /* manual-reset event: yes */,
+				FALSE /* initial state: nonsignaled */,
+				NULL /* name */);
+		}
 
 		pthreadpool_store_relaxed_size_t(&threadpool->active_threads, threads_count - 1 /* caller thread */);
 
@@ -190,7 +225,7 @@ struct pthreadpool* pthreadpool_create(size_t threads_count) {
 	return threadpool;
 }
 
-PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
+PTHREADPOOL_INTERNAL void pthreadpool_parallelize_with_ranges(
 	struct pthreadpool* threadpool,
 	thread_function_t thread_function,
 	const void* params,
@@ -198,6 +233,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	void* task,
 	void* context,
 	size_t linear_range,
+	const struct pthreadpool_range* ranges,
 	uint32_t flags)
 {
 	assert(threadpool != NULL);
@@ -206,8 +242,16 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(linear_range > 1);
 
 	/* Protect the global threadpool structures */
-	const DWORD wait_status = WaitForSingleObject(threadpool->execution_mutex, INFINITE);
-	assert(wait_status == WAIT_OBJECT_0);
+	if (WaitForSingleObject(threadpool->execution_mutex, 0) != WAIT_OBJECT_0) {
+		/* Another thread runs a command on the thread pool: process this one as a concurrent job */
+		pthreadpool_parallelize_concurrently(
+			threadpool, thread_function, params, params_size,
+			task, context, linear_range, ranges, flags);
+		return;
+	}
+
+	/* Adjust how long the workers spin for the next command to how often commands come */
+	pthreadpool_learn_spin_wait(threadpool);
 
 	/* Setup global arguments */
 	pthreadpool_store_relaxed_void_p(&threadpool->thread_function, (void*) thread_function);
@@ -224,19 +268,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Spread the work between threads */
-	const struct fxdiv_result_size_t range_params = fxdiv_divide_size_t(linear_range, threads_count);
-	size_t range_start = 0;
-	for (size_t tid = 0; tid < threads_count.value; tid++) {
-		struct thread_info* thread = &threadpool->threads[tid];
-		const size_t range_length = range_params.quotient + (size_t) (tid < range_params.remainder);
-		const size_t range_end = range_start + range_length;
-		pthreadpool_store_relaxed_size_t(&thread->range_start, range_start);
-		pthreadpool_store_relaxed_size_t(&thread->range_end, range_end);
-		pthreadpool_store_relaxed_size_t(&thread->range_length, range_length);
-
-		/* The next subrange starts where the previous ended */
-		range_start = range_end;
-	}
+	pthreadpool_partition_range(threadpool, linear_range, ranges, flags);
 
 	/*
 	 * Update the threadpool command.
@@ -284,7 +316,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	}
 
 	/* Do computations as worker #0 */
-	thread_function(threadpool, &threadpool->threads[0]);
+	pthreadpool_run_thread_function(threadpool, thread_function, &threadpool->threads[0]);
 
 	/* Restore FPU denormals control, if needed */
 	if (flags & PTHREADPOOL_FLAG_DISABLE_DENORMALS) {
@@ -296,6 +328,7 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	 * Use the complementary event because it corresponds to the new command.
 	 */
 	wait_worker_threads(threadpool, event_index ^ 1);
+	pthreadpool_complete_spin_wait(threadpool);
 
 	/*
 	 * Reset the completion event for the next command.
@@ -312,6 +345,102 @@ PTHREADPOOL_INTERNAL void pthreadpool_parallelize(
 	assert(release_mutex_status != FALSE);
 }
 
+PTHREADPOOL_INTERNAL uint64_t pthreadpool_get_time_ns(void) {
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	const uint64_t ticks = (uint64_t) counter.QuadPart;
+	const uint64_t ticks_per_second = (uint64_t) frequency.QuadPart;
+	return ticks / ticks_per_second * UINT64_C(1000000000) +
+		ticks % ticks_per_second * UINT64_C(1000000000) / ticks_per_second;
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wake_helpers(
+	struct pthreadpool* threadpool,
+	struct pthreadpool_job_slot* job_slot,
+	size_t helpers_count)
+{
+	/*
+	 * Sleeping workers scan all job slots once awake. The manual-reset event wakes up all of them: those which find no
+	 * free thread slot of the job go back to sleep.
+	 */
+	(void) job_slot;
+	(void) helpers_count;
+
+	const BOOL set_event_status = SetEvent(threadpool->jobs_event);
+	assert(set_event_status != FALSE);
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wait_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	/* Spin-wait */
+	const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+	for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
+		if (pthreadpool_load_acquire_uint32_t(&threadpool->barrier_sense) != sense) {
+			return;
+		}
+		pthreadpool_yield();
+	}
+
+	/* Fall-back to event wait */
+	const DWORD wait_status = WaitForSingleObject(threadpool->barrier_event[sense ^ 1], INFINITE);
+	assert(wait_status == WAIT_OBJECT_0);
+	pthreadpool_fence_acquire();
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_release_barrier(
+	struct pthreadpool* threadpool,
+	uint32_t sense)
+{
+	/*
+	 * Every thread waits at this barrier, so none waits on the event of the next flip: reset it before any thread can
+	 * arrive at the next barrier.
+	 */
+	const BOOL reset_event_status = ResetEvent(threadpool->barrier_event[sense ^ 1]);
+	assert(reset_event_status != FALSE);
+
+	pthreadpool_store_release_uint32_t(&threadpool->barrier_sense, sense);
+
+	const BOOL set_event_status = SetEvent(threadpool->barrier_event[sense]);
+	assert(set_event_status != FALSE);
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_wait_for_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address,
+	uint32_t value,
+	uint32_t flags)
+{
+	/* Spin-wait */
+	if ((flags & PTHREADPOOL_FLAG_YIELD_WORKERS) == 0) {
+		const uint64_t spin_deadline = pthreadpool_get_time_ns() + pthreadpool_load_relaxed_size_t(&threadpool->max_spin_ns);
+		for (uint32_t i = 0; pthreadpool_keep_spinning(i, spin_deadline); i++) {
+			if (pthreadpool_load_acquire_uint32_t(address) != value) {
+				return;
+			}
+			pthreadpool_yield();
+		}
+	}
+
+	/* Fall-back to sleeping between checks: the counter has no event to wait on */
+	while (pthreadpool_load_acquire_uint32_t(address) == value) {
+		Sleep(1);
+	}
+}
+
+PTHREADPOOL_INTERNAL void pthreadpool_notify_change(
+	struct pthreadpool* threadpool,
+	pthreadpool_atomic_uint32_t* address)
+{
+	/* Waiting threads poll the counter, so only the thread which completes a change advances it: no wake-up needed */
+	(void) threadpool;
+	pthreadpool_fence_release();
+	uint32_t value = pthreadpool_load_relaxed_uint32_t(address);
+	while (!pthreadpool_compare_exchange_weak_relaxed_uint32_t(address, &value, value + 2));
+}
+
 void pthreadpool_destroy(struct pthreadpool* threadpool) {
 	if (threadpool != NULL) {
 		const size_t threads_count = threadpool->threads_count.value;
@@ -361,6 +490,16 @@ void pthreadpool_destroy(struct pthreadpool* threadpool) {
 					assert(close_status != FALSE);
 				}
 			}
+			if (threadpool->jobs_event != NULL) {
+				const BOOL close_status = CloseHandle(threadpool->jobs_event);
+				assert(close_status != FALSE);
+			}
+			for (size_t i = 0; i < 2; i++) {
+				if (threadpool->barrier_event[i] != NULL) {
+					const BOOL close_status = CloseHandle(threadpool->barrier_event[i]);
+					assert(close_status != FALSE);
+				}
+			}
 		}
 		pthreadpool_deallocate(threadpool);
 	}
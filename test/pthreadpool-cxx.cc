@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 
@@ -14,6 +15,10 @@ typedef std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_pthrea
 const size_t kParallelize1DRange = 1223;
 const size_t kParallelize1DTile1DRange = 1303;
 const size_t kParallelize1DTile1DTile = 11;
+const size_t kParallelize1DWithGrainRange = 1279;
+const size_t kParallelize1DWithGrainGrain = 7;
+const size_t kParallelize1DReduceRange = 1297;
+const size_t kParallelize1DReduceTile = 13;
 const size_t kParallelize2DRangeI = 41;
 const size_t kParallelize2DRangeJ = 43;
 const size_t kParallelize2DTile1DRangeI = 43;
@@ -232,6 +237,74 @@ TEST(Parallelize1DTile1D, EachItemProcessedOnce) {
 	}
 }
 
+TEST(Parallelize1DWithGrain, EachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DWithGrainRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_1d_with_grain(
+		threadpool.get(),
+		[&counters](size_t i) {
+			counters[i].fetch_add(1, std::memory_order_relaxed);
+		},
+		kParallelize1DWithGrainRange, kParallelize1DWithGrainGrain);
+
+	for (size_t i = 0; i < kParallelize1DWithGrainRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Parallelize1DReduce, ComputesSum) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const uint64_t sum = pthreadpool_parallelize_1d_reduce(
+		threadpool.get(),
+		uint64_t(0),
+		[](uint64_t& accumulator, size_t start, size_t tile) {
+			for (size_t i = start; i < start + tile; i++) {
+				accumulator += i;
+			}
+		},
+		[](uint64_t& accumulator, const uint64_t& partial) {
+			accumulator += partial;
+		},
+		kParallelize1DReduceRange, kParallelize1DReduceTile);
+	EXPECT_EQ(sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
+}
+
+TEST(Parallelize1DReduce, ComputesMaximumPerItem) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t maximum = pthreadpool_parallelize_1d_reduce(
+		threadpool.get(),
+		size_t(0),
+		[](size_t& accumulator, size_t i, size_t) {
+			accumulator = std::max(accumulator, (i * 7) % kParallelize1DReduceRange);
+		},
+		[](size_t& accumulator, const size_t& partial) {
+			accumulator = std::max(accumulator, partial);
+		},
+		kParallelize1DReduceRange);
+	EXPECT_EQ(maximum, kParallelize1DReduceRange - 1);
+}
+
+TEST(Parallelize1DFindFirst, FindsFirstMatch) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t index = pthreadpool_parallelize_1d_find_first(
+		threadpool.get(),
+		[](size_t i) {
+			return i * i >= kParallelize1DReduceRange;
+		},
+		kParallelize1DReduceRange);
+	EXPECT_EQ(index, 37);
+}
+
 TEST(Parallelize2D, ThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4,16 +4,41 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <random>
+#include <thread>
+#include <vector>
 
 
 typedef std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_pthreadpool_t;
+typedef std::unique_ptr<pthreadpool_plan, decltype(&pthreadpool_destroy_plan)> auto_pthreadpool_plan_t;
+typedef std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy_team)> auto_pthreadpool_team_t;
 
 
 const size_t kParallelize1DRange = 1223;
 const size_t kParallelize1DTile1DRange = 1303;
 const size_t kParallelize1DTile1DTile = 11;
+const size_t kParallelize1DWithGrainRange = 1279;
+const size_t kParallelize1DWithGrainGrain = 7;
+const size_t kParallelize1DReduceRange = 1297;
+const size_t kParallelize1DReduceTile = 13;
+const size_t kParallelize1DFindFirstRange = 1321;
+const size_t kCancelRange = 1000003;
+const size_t kCancelAfterItems = 100;
+const size_t kNestedOuterRange = 3;
+const size_t kNestedInnerRange = 1031;
+const size_t kConcurrentSubmitters = 4;
+const size_t kGraphRows = 13;
+const size_t kGraphColumns = 97;
+const size_t kGraphChainLength = 4;
+const size_t kSpmdPhases = 7;
+const size_t kTeamsCount = 2;
+const size_t kScanCount = 100003;
+const size_t kSortCount = 100003;
 const size_t kParallelize2DRangeI = 41;
 const size_t kParallelize2DRangeJ = 43;
 const size_t kParallelize2DTile1DRangeI = 43;
@@ -369,6 +394,175 @@ TEST(Parallelize1D, MultiThreadPoolWorkStealing) {
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
 }
 
+TEST(Parallelize1D, MultiThreadPoolEachItemProcessedOnceRandomVictim) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STEAL_RANDOM);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Parallelize1D, MultiThreadPoolWorkStealingRandomVictim) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STEAL_RANDOM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+}
+
+TEST(Parallelize1D, MultiThreadPoolEachItemProcessedOnceTwoChoicesVictim) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STEAL_TWO_CHOICES);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Parallelize1D, MultiThreadPoolWorkStealingTwoChoicesVictim) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STEAL_TWO_CHOICES);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+}
+
+TEST(Parallelize1D, MultiThreadPoolEachItemProcessedOnceWeighted) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
+		GTEST_SKIP();
+	}
+
+	/* Skewed weights, including threads which get no items initially */
+	std::vector<uint32_t> weights(num_threads);
+	for (size_t i = 0; i < num_threads; i++) {
+		weights[i] = static_cast<uint32_t>(i % 3 * 5);
+	}
+	pthreadpool_set_thread_weights(threadpool.get(), weights.data());
+
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Parallelize1D, MultiThreadPoolEachItemProcessedOnceLearnedWeights) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	static const size_t kIterations = 8;
+	for (size_t iteration = 0; iteration < kIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_LEARN_WEIGHTS);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIterations << ")";
+	}
+}
+
+TEST(ThreadWeights, SetAndGet) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	std::vector<uint32_t> weights(num_threads);
+	pthreadpool_get_thread_weights(threadpool.get(), weights.data());
+	for (size_t i = 0; i < num_threads; i++) {
+		EXPECT_EQ(weights[i], 0) << "Thread " << i << " has non-default weight " << weights[i];
+	}
+
+	for (size_t i = 0; i < num_threads; i++) {
+		weights[i] = static_cast<uint32_t>(i + 1);
+	}
+	pthreadpool_set_thread_weights(threadpool.get(), weights.data());
+
+	std::vector<uint32_t> new_weights(num_threads);
+	pthreadpool_get_thread_weights(threadpool.get(), new_weights.data());
+	EXPECT_EQ(new_weights, weights);
+
+	pthreadpool_set_thread_weights(threadpool.get(), nullptr);
+	pthreadpool_get_thread_weights(threadpool.get(), new_weights.data());
+	for (size_t i = 0; i < num_threads; i++) {
+		EXPECT_EQ(new_weights[i], 0) << "Thread " << i << " has non-default weight " << new_weights[i];
+	}
+}
+
 static void ComputeNothing1DWithThread(void*, size_t, size_t) {
 }
 
@@ -644,6 +838,167 @@ TEST(Parallelize1DWithThread, MultiThreadPoolThreadIndexValid) {
 		0 /* flags */);
 }
 
+static void RecordThread1DWithThread(std::atomic_size_t* item_threads, size_t thread_index, size_t i) {
+	item_threads[i].store(thread_index, std::memory_order_relaxed);
+}
+
+TEST(Parallelize1DWithThread, MultiThreadPoolStaticScheduleSameThreadAcrossCalls) {
+	std::vector<std::atomic_size_t> first_item_threads(kParallelize1DRange);
+	std::vector<std::atomic_size_t> item_threads(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(RecordThread1DWithThread),
+		static_cast<void*>(first_item_threads.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+	/* Items are assigned to threads in contiguous ascending ranges */
+	for (size_t i = 1; i < kParallelize1DRange; i++) {
+		EXPECT_LE(first_item_threads[i - 1].load(std::memory_order_relaxed), first_item_threads[i].load(std::memory_order_relaxed))
+			<< "Element " << i - 1 << " was processed by thread " << first_item_threads[i - 1].load(std::memory_order_relaxed)
+			<< ", but element " << i << " was processed by thread " << first_item_threads[i].load(std::memory_order_relaxed);
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d_with_thread(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_with_thread_t>(RecordThread1DWithThread),
+			static_cast<void*>(item_threads.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+		for (size_t i = 0; i < kParallelize1DRange; i++) {
+			EXPECT_EQ(item_threads[i].load(std::memory_order_relaxed), first_item_threads[i].load(std::memory_order_relaxed))
+				<< "Element " << i << " was processed by thread " << item_threads[i].load(std::memory_order_relaxed)
+				<< " (expected: " << first_item_threads[i].load(std::memory_order_relaxed) << ")";
+		}
+	}
+}
+
+static void SlowThread1Item1DWithThread(void*, size_t thread_index, size_t) {
+	/* Sleep in all threads, so that every thread gets to process items even on oversubscribed systems */
+	std::this_thread::sleep_for(std::chrono::microseconds(thread_index == 1 ? 200 : 10));
+}
+
+TEST(Parallelize1DWithThread, MultiThreadPoolLearnsWeights) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < 8; iteration++) {
+		pthreadpool_parallelize_1d_with_thread(
+			threadpool.get(),
+			SlowThread1Item1DWithThread,
+			nullptr,
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_LEARN_WEIGHTS);
+	}
+
+	std::vector<uint32_t> weights(num_threads);
+	pthreadpool_get_thread_weights(threadpool.get(), weights.data());
+	for (size_t i = 0; i < num_threads; i++) {
+		if (i != 1) {
+			EXPECT_LT(weights[1], weights[i])
+				<< "Slow thread 1 has weight " << weights[1] << ", thread " << i << " has weight " << weights[i];
+		}
+	}
+}
+
+const size_t kTopologyItemsPerThread = 8;
+
+struct TopologyStealingContext {
+	std::atomic_size_t first_stolen_item;
+	std::atomic_bool stolen;
+};
+
+static void RecordFirstSteal1DWithThread(TopologyStealingContext* context, size_t thread_index, size_t i) {
+	const size_t owner_index = i / kTopologyItemsPerThread;
+	if (thread_index == 1 && owner_index != 1) {
+		size_t no_item = SIZE_MAX;
+		context->first_stolen_item.compare_exchange_strong(no_item, i, std::memory_order_relaxed);
+		context->stolen.store(true, std::memory_order_release);
+	}
+	if (owner_index != 1 && i % kTopologyItemsPerThread == 0) {
+		/* Hold other threads on their first item, so thread 1 is the first thread to steal */
+		while (!context->stolen.load(std::memory_order_acquire)) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+static size_t FirstItemStolenByThread1(pthreadpool_t threadpool) {
+	TopologyStealingContext context;
+	context.first_stolen_item.store(SIZE_MAX, std::memory_order_relaxed);
+	context.stolen.store(false, std::memory_order_relaxed);
+
+	pthreadpool_parallelize_1d_with_thread(
+		threadpool,
+		reinterpret_cast<pthreadpool_task_1d_with_thread_t>(RecordFirstSteal1DWithThread),
+		static_cast<void*>(&context),
+		pthreadpool_get_threads_count(threadpool) * kTopologyItemsPerThread,
+		0 /* flags */);
+	return context.first_stolen_item.load(std::memory_order_relaxed);
+}
+
+TEST(Parallelize1DWithThread, MultiThreadPoolStealsWithinCacheFirst) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 2) {
+		GTEST_SKIP();
+	}
+
+	/* Thread 2 shares the last-level cache with thread 1, all other threads are in separate caches */
+	std::vector<uint32_t> cache_domains(num_threads);
+	std::vector<uint32_t> numa_domains(num_threads, 0);
+	for (size_t i = 0; i < num_threads; i++) {
+		cache_domains[i] = static_cast<uint32_t>(i);
+	}
+	cache_domains[2] = 1;
+	pthreadpool_set_topology(threadpool.get(), cache_domains.data(), numa_domains.data());
+
+	const size_t stolen_item = FirstItemStolenByThread1(threadpool.get());
+	EXPECT_EQ(stolen_item / kTopologyItemsPerThread, 2)
+		<< "Thread 1 first stole item " << stolen_item << " (expected an item of thread 2)";
+}
+
+TEST(Parallelize1DWithThread, MultiThreadPoolStealsWithinNumaNodeFirst) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 2) {
+		GTEST_SKIP();
+	}
+
+	/* Each thread has its own cache, but threads 1 and 2 are on the same NUMA node */
+	std::vector<uint32_t> cache_domains(num_threads);
+	std::vector<uint32_t> numa_domains(num_threads);
+	for (size_t i = 0; i < num_threads; i++) {
+		cache_domains[i] = static_cast<uint32_t>(i);
+		numa_domains[i] = static_cast<uint32_t>(i);
+	}
+	numa_domains[2] = 1;
+	pthreadpool_set_topology(threadpool.get(), cache_domains.data(), numa_domains.data());
+
+	const size_t stolen_item = FirstItemStolenByThread1(threadpool.get());
+	EXPECT_EQ(stolen_item / kTopologyItemsPerThread, 2)
+		<< "Thread 1 first stole item " << stolen_item << " (expected an item of thread 2)";
+}
+
 static void ComputeNothing1DWithUArch(void*, uint32_t, size_t) {
 }
 
@@ -1255,21 +1610,23 @@ TEST(Parallelize1DTile1D, MultiThreadPoolWorkStealing) {
 	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DTile1DRange);
 }
 
-static void ComputeNothing2D(void*, size_t, size_t) {
+static void ComputeNothing1DWithGrain(void*, size_t) {
 }
 
-TEST(Parallelize2D, SingleThreadPoolCompletes) {
+TEST(Parallelize1DWithGrain, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d(threadpool.get(),
-		ComputeNothing2D,
+	pthreadpool_parallelize_1d_with_grain(
+		threadpool.get(),
+		ComputeNothing1DWithGrain,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
 }
 
-TEST(Parallelize2D, MultiThreadPoolCompletes) {
+TEST(Parallelize1DWithGrain, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1277,32 +1634,20 @@ TEST(Parallelize2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		ComputeNothing2D,
+		ComputeNothing1DWithGrain,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
 }
 
-static void CheckBounds2D(void*, size_t i, size_t j) {
-	EXPECT_LT(i, kParallelize2DRangeI);
-	EXPECT_LT(j, kParallelize2DRangeJ);
-}
-
-TEST(Parallelize2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d(
-		threadpool.get(),
-		CheckBounds2D,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
+static void CheckBounds1DWithGrain(void*, size_t i) {
+	EXPECT_LT(i, kParallelize1DWithGrainRange);
 }
 
-TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DWithGrain, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1310,43 +1655,41 @@ TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		CheckBounds2D,
+		CheckBounds1DWithGrain,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
 }
 
-static void SetTrue2D(std::atomic_bool* processed_indicators, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void Increment1DWithGrain(std::atomic_int* processed_counters, size_t i) {
+	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithGrain, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DWithGrainRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1DWithGrain),
+		static_cast<void*>(counters.data()),
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DWithGrainRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithGrain, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DWithGrainRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1355,52 +1698,46 @@ TEST(Parallelize2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1DWithGrain),
+		static_cast<void*>(counters.data()),
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	for (size_t i = 0; i < kParallelize1DWithGrainRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-static void Increment2D(std::atomic_int* processed_counters, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-}
-
-TEST(Parallelize2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithGrain, MultiThreadPoolEachItemProcessedOnceDerivedGrain) {
+	std::vector<std::atomic_int> counters(kParallelize1DWithGrainRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1DWithGrain),
 		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DWithGrainRange,
+		0 /* grain */,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DWithGrainRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithGrain, MultiThreadPoolEachItemProcessedOnceLargeGrain) {
+	std::vector<std::atomic_int> counters(kParallelize1DWithGrainRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1409,51 +1746,33 @@ TEST(Parallelize2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1DWithGrain),
 		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainRange / 2,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DWithGrainRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
+static void WorkImbalance1DWithGrain(std::atomic_int* num_processed_items, size_t i) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	/* Items claimed together with the spinning item are processed by the same thread, so spin on the last one */
+	if (i == kParallelize1DWithGrainGrain - 1) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize1DWithGrainRange) {
+			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DWithGrain, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1462,33 +1781,47 @@ TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
-			0 /* flags */);
-	}
+	pthreadpool_parallelize_1d_with_grain(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1DWithGrain),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DWithGrainRange,
+		kParallelize1DWithGrainGrain,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DWithGrainRange);
+}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+static void Sum1DReduce(void*, uint64_t* accumulator, size_t start, size_t tile) {
+	for (size_t i = start; i < start + tile; i++) {
+		*accumulator += i;
 	}
 }
 
-static void IncrementSame2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void Combine1DReduce(void*, uint64_t* accumulator, const uint64_t* partial) {
+	*accumulator += *partial;
 }
 
-TEST(Parallelize2D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize1DReduce, SingleThreadPoolComputesSum) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const uint64_t identity = 0;
+	uint64_t sum = 1;
+	pthreadpool_parallelize_1d_reduce(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_reduce_t>(Sum1DReduce),
+		reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+		nullptr,
+		&identity,
+		&sum,
+		sizeof(sum),
+		kParallelize1DReduceRange,
+		1 /* tile */,
+		0 /* flags */);
+	EXPECT_EQ(sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
+}
 
+TEST(Parallelize1DReduce, MultiThreadPoolComputesSum) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1496,28 +1829,23 @@ TEST(Parallelize2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	const uint64_t identity = 0;
+	uint64_t sum = 1;
+	pthreadpool_parallelize_1d_reduce(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(IncrementSame2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_reduce_t>(Sum1DReduce),
+		reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+		nullptr,
+		&identity,
+		&sum,
+		sizeof(sum),
+		kParallelize1DReduceRange,
+		1 /* tile */,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
-
-static void WorkImbalance2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
+	EXPECT_EQ(sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
 }
 
-TEST(Parallelize2D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
+TEST(Parallelize1DReduce, MultiThreadPoolComputesTiledSum) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1525,30 +1853,83 @@ TEST(Parallelize2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d(
+	const uint64_t identity = 0;
+	uint64_t sum = 1;
+	pthreadpool_parallelize_1d_reduce(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_t>(WorkImbalance2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_reduce_t>(Sum1DReduce),
+		reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+		nullptr,
+		&identity,
+		&sum,
+		sizeof(sum),
+		kParallelize1DReduceRange,
+		kParallelize1DReduceTile,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
+	EXPECT_EQ(sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
 }
 
-static void ComputeNothing2DWithThread(void*, size_t, size_t, size_t) {
+struct reduce_statistics {
+	size_t count;
+	size_t min;
+	size_t max;
+	uint64_t sum;
+};
+
+static void Statistics1DReduce(std::atomic_int* processed_counters, reduce_statistics* accumulator, size_t start, size_t tile) {
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(accumulator) % 64, 0)
+		<< "Partial result at " << accumulator << " is not aligned to a cache line";
+	for (size_t i = start; i < start + tile; i++) {
+		processed_counters[i].fetch_add(1, std::memory_order_relaxed);
+		accumulator->count += 1;
+		accumulator->min = std::min(accumulator->min, i);
+		accumulator->max = std::max(accumulator->max, i);
+		accumulator->sum += i;
+	}
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+static void CombineStatistics1DReduce(std::atomic_int*, reduce_statistics* accumulator, const reduce_statistics* partial) {
+	accumulator->count += partial->count;
+	accumulator->min = std::min(accumulator->min, partial->min);
+	accumulator->max = std::max(accumulator->max, partial->max);
+	accumulator->sum += partial->sum;
+}
+
+TEST(Parallelize1DReduce, MultiThreadPoolEachItemReducedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DReduceRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(threadpool.get(),
-		ComputeNothing2DWithThread,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	const reduce_statistics identity = { 0, SIZE_MAX, 0, 0 };
+	reduce_statistics statistics = { };
+	pthreadpool_parallelize_1d_reduce(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_reduce_t>(Statistics1DReduce),
+		reinterpret_cast<pthreadpool_combine_t>(CombineStatistics1DReduce),
+		static_cast<void*>(counters.data()),
+		&identity,
+		&statistics,
+		sizeof(statistics),
+		kParallelize1DReduceRange,
+		kParallelize1DReduceTile,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize1DReduceRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+	EXPECT_EQ(statistics.count, kParallelize1DReduceRange);
+	EXPECT_EQ(statistics.min, 0);
+	EXPECT_EQ(statistics.max, kParallelize1DReduceRange - 1);
+	EXPECT_EQ(statistics.sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize1DReduce, MultiThreadPoolComputesSumRepeatedly) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1556,32 +1937,46 @@ TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
-		threadpool.get(),
-		ComputeNothing2DWithThread,
-		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
+	const uint64_t identity = 0;
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		uint64_t sum = 1;
+		pthreadpool_parallelize_1d_reduce(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_reduce_t>(Sum1DReduce),
+			reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+			nullptr,
+			&identity,
+			&sum,
+			sizeof(sum),
+			kParallelize1DReduceRange,
+			1 /* tile */,
+			0 /* flags */);
+		EXPECT_EQ(sum, uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2);
+	}
 }
 
-static void CheckBounds2DWithThread(void*, size_t, size_t i, size_t j) {
-	EXPECT_LT(i, kParallelize2DRangeI);
-	EXPECT_LT(j, kParallelize2DRangeJ);
+static bool IsMultipleOf97FindFirst(void*, size_t i) {
+	return i != 0 && i % 97 == 0;
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsInBounds) {
+static bool IsNeverTrueFindFirst(void*, size_t) {
+	return false;
+}
+
+TEST(Parallelize1DFindFirst, SingleThreadPoolFindsFirstMatch) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
+	const size_t index = pthreadpool_parallelize_1d_find_first(
 		threadpool.get(),
-		CheckBounds2DWithThread,
+		IsMultipleOf97FindFirst,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DFindFirstRange,
 		0 /* flags */);
+	EXPECT_EQ(index, 97);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize1DFindFirst, MultiThreadPoolFindsFirstMatch) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1589,43 +1984,69 @@ TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		const size_t index = pthreadpool_parallelize_1d_find_first(
+			threadpool.get(),
+			IsMultipleOf97FindFirst,
+			nullptr,
+			kParallelize1DFindFirstRange,
+			0 /* flags */);
+		EXPECT_EQ(index, 97);
+	}
+}
+
+TEST(Parallelize1DFindFirst, MultiThreadPoolReturnsRangeWithoutMatch) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	const size_t index = pthreadpool_parallelize_1d_find_first(
 		threadpool.get(),
-		CheckBounds2DWithThread,
+		IsNeverTrueFindFirst,
 		nullptr,
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		kParallelize1DFindFirstRange,
 		0 /* flags */);
+	EXPECT_EQ(index, kParallelize1DFindFirstRange);
 }
 
-static void SetTrue2DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static bool IsLastItemFindFirst(std::atomic_int* processed_counters, size_t i) {
+	processed_counters[i].fetch_add(1, std::memory_order_relaxed);
+	return i == kParallelize1DFindFirstRange - 1;
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+TEST(Parallelize1DFindFirst, MultiThreadPoolEachItemBeforeMatchProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DFindFirstRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	const size_t index = pthreadpool_parallelize_1d_find_first(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_predicate_t>(IsLastItemFindFirst),
+		static_cast<void*>(counters.data()),
+		kParallelize1DFindFirstRange,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	EXPECT_EQ(index, kParallelize1DFindFirstRange - 1);
+	for (size_t i = 0; i < kParallelize1DFindFirstRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+static bool IsFirstItemFindFirst(std::atomic_size_t* num_processed_items, size_t i) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	return i == 0;
+}
+
+TEST(Parallelize1DFindFirst, MultiThreadPoolStopsAfterMatch) {
+	std::atomic_size_t num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -1634,53 +2055,51 @@ TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	const size_t index = pthreadpool_parallelize_1d_find_first(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_predicate_t>(IsFirstItemFindFirst),
+		static_cast<void*>(&num_processed_items),
+		kCancelRange,
 		0 /* flags */);
+	EXPECT_EQ(index, 0);
+	EXPECT_LT(num_processed_items.load(std::memory_order_relaxed), kCancelRange);
+}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+struct cancel_context {
+	pthreadpool_t threadpool;
+	std::atomic_size_t num_processed_items;
+};
+
+static void CancelAfterItems(cancel_context* context, size_t) {
+	if (context->num_processed_items.fetch_add(1, std::memory_order_relaxed) + 1 == kCancelAfterItems) {
+		pthreadpool_cancel(context->threadpool);
 	}
 }
 
-static void Increment2DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j) {
-	const size_t linear_idx = i * kParallelize2DRangeJ + j;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+TEST(Cancel, NullThreadPool) {
+	pthreadpool_cancel(nullptr);
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Cancel, MultiThreadPoolStopsProcessing) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
-		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
-}
 
-TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+	cancel_context context = { threadpool.get(), ATOMIC_VAR_INIT(0) };
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(CancelAfterItems),
+		static_cast<void*>(&context),
+		kCancelRange,
+		0 /* flags */);
+	EXPECT_GE(context.num_processed_items.load(std::memory_order_relaxed), kCancelAfterItems);
+	EXPECT_LT(context.num_processed_items.load(std::memory_order_relaxed), kCancelRange);
+}
 
+TEST(Cancel, MultiThreadPoolNextComputationCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1688,52 +2107,49 @@ TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	cancel_context context = { threadpool.get(), ATOMIC_VAR_INIT(0) };
+	pthreadpool_parallelize_1d_with_grain(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
-		static_cast<void*>(counters.data()),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(CancelAfterItems),
+		static_cast<void*>(&context),
+		kCancelRange,
+		kParallelize1DWithGrainGrain,
 		0 /* flags */);
+	EXPECT_LT(context.num_processed_items.load(std::memory_order_relaxed), kCancelRange);
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	pthreadpool_parallelize_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
 	}
 }
 
-TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_with_thread(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
-			0 /* flags */);
-	}
+struct nested_context {
+	pthreadpool_t threadpool;
+	std::vector<std::atomic_int> counters;
+	size_t outer_index;
+};
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
-	}
+static void IncrementNestedInner(nested_context* context, size_t i) {
+	context->counters[context->outer_index * kNestedInnerRange + i].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+static void ParallelizeNestedInner(nested_context* contexts, size_t i) {
+	pthreadpool_parallelize_1d(
+		contexts[i].threadpool,
+		reinterpret_cast<pthreadpool_task_1d_t>(IncrementNestedInner),
+		static_cast<void*>(&contexts[i]),
+		kNestedInnerRange,
+		0 /* flags */);
+}
 
+TEST(Nested, MultiThreadPoolEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1741,33 +2157,56 @@ TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
+	std::vector<nested_context> contexts(kNestedOuterRange);
+	for (size_t i = 0; i < kNestedOuterRange; i++) {
+		contexts[i].threadpool = threadpool.get();
+		contexts[i].counters = std::vector<std::atomic_int>(kNestedInnerRange);
+		contexts[i].outer_index = 0;
+	}
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_with_thread(
+		pthreadpool_parallelize_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
-			static_cast<void*>(counters.data()),
-			kParallelize2DRangeI, kParallelize2DRangeJ,
+			reinterpret_cast<pthreadpool_task_1d_t>(ParallelizeNestedInner),
+			static_cast<void*>(contexts.data()),
+			kNestedOuterRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+	for (size_t i = 0; i < kNestedOuterRange; i++) {
+		for (size_t j = 0; j < kNestedInnerRange; j++) {
+			EXPECT_EQ(contexts[i].counters[j].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< contexts[i].counters[j].load(std::memory_order_relaxed) << " times "
 				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-static void IncrementSame2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-}
+static void ParallelizeNestedMiddle(nested_context* context, size_t i) {
+	std::vector<nested_context> inner_contexts(kNestedOuterRange);
+	for (size_t j = 0; j < kNestedOuterRange; j++) {
+		inner_contexts[j].threadpool = context->threadpool;
+		inner_contexts[j].counters = std::vector<std::atomic_int>(kNestedInnerRange);
+		inner_contexts[j].outer_index = 0;
+	}
+	pthreadpool_parallelize_1d(
+		context->threadpool,
+		reinterpret_cast<pthreadpool_task_1d_t>(ParallelizeNestedInner),
+		static_cast<void*>(inner_contexts.data()),
+		kNestedOuterRange,
+		0 /* flags */);
 
-TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+	for (size_t j = 0; j < kNestedOuterRange; j++) {
+		for (size_t k = 0; k < kNestedInnerRange; k++) {
+			if (inner_contexts[j].counters[k].load(std::memory_order_relaxed) != 1) {
+				return;
+			}
+		}
+	}
+	context->counters[i].fetch_add(1, std::memory_order_relaxed);
+}
 
+TEST(Nested, MultiThreadPoolThreeLevels) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1775,28 +2214,43 @@ TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	nested_context context;
+	context.threadpool = threadpool.get();
+	context.counters = std::vector<std::atomic_int>(kParallelize1DRange);
+	context.outer_index = 0;
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(IncrementSame2DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(ParallelizeNestedMiddle),
+		static_cast<void*>(&context),
+		kParallelize1DRange,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
 
-static void WorkImbalance2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(context.counters[i].load(std::memory_order_relaxed), 1)
+			<< "Nested computations of element " << i << " did not process every item exactly once";
+	}
+}
+
+static void ReduceNested(pthreadpool_t threadpool, uint64_t* accumulator, size_t start, size_t tile) {
+	for (size_t i = start; i < start + tile; i++) {
+		const uint64_t identity = 0;
+		uint64_t sum = 0;
+		pthreadpool_parallelize_1d_reduce(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_reduce_t>(Sum1DReduce),
+			reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+			nullptr,
+			&identity,
+			&sum,
+			sizeof(sum),
+			kParallelize1DReduceRange,
+			kParallelize1DReduceTile,
+			0 /* flags */);
+		*accumulator += sum;
 	}
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
+TEST(Nested, MultiThreadPoolComputesNestedSums) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1804,51 +2258,67 @@ TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
+	const uint64_t identity = 0;
+	uint64_t sum = 0;
+	pthreadpool_parallelize_1d_reduce(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(WorkImbalance2DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
+		reinterpret_cast<pthreadpool_task_1d_reduce_t>(ReduceNested),
+		reinterpret_cast<pthreadpool_combine_t>(Combine1DReduce),
+		static_cast<void*>(threadpool.get()),
+		&identity,
+		&sum,
+		sizeof(sum),
+		kNestedOuterRange,
+		1 /* tile */,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
-}
-
-static void CheckThreadIndexValid2DWithThread(const size_t* num_threads, size_t thread_index, size_t, size_t) {
-	EXPECT_LE(thread_index, *num_threads);
+	EXPECT_EQ(sum, kNestedOuterRange * (uint64_t(kParallelize1DReduceRange) * (kParallelize1DReduceRange - 1) / 2));
 }
 
-TEST(Parallelize2DWithThread, MultiThreadPoolThreadIndexValid) {
+TEST(ConcurrentJobs, MultiThreadPoolEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-	if (num_threads <= 1) {
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(CheckThreadIndexValid2DWithThread),
-		static_cast<void*>(&num_threads),
-		kParallelize2DRangeI, kParallelize2DRangeJ,
-		0 /* flags */);
-}
+	std::vector<std::vector<std::atomic_int>> counters(kConcurrentSubmitters);
+	std::vector<std::thread> submitters;
+	for (size_t submitter = 0; submitter < kConcurrentSubmitters; submitter++) {
+		counters[submitter] = std::vector<std::atomic_int>(kParallelize1DRange);
+		submitters.emplace_back([&threadpool, &counters, submitter]() {
+			for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+				pthreadpool_parallelize_1d(
+					threadpool.get(),
+					reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+					static_cast<void*>(counters[submitter].data()),
+					kParallelize1DRange,
+					0 /* flags */);
+			}
+		});
+	}
+	for (std::thread& submitter : submitters) {
+		submitter.join();
+	}
 
-static void ComputeNothing2DTile1D(void*, size_t, size_t, size_t) {
+	for (size_t submitter = 0; submitter < kConcurrentSubmitters; submitter++) {
+		for (size_t i = 0; i < kParallelize1DRange; i++) {
+			EXPECT_EQ(counters[submitter][i].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element " << i << " of submitter " << submitter << " was processed "
+				<< counters[submitter][i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d(threadpool.get(),
-		ComputeNothing2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+static void WaitForConcurrentJob(std::atomic_bool* concurrent_job_done, size_t) {
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (!concurrent_job_done->load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::yield();
+	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
+TEST(ConcurrentJobs, MultiThreadPoolJobDoesNotWaitForRunningCommand) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1856,33 +2326,82 @@ TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	std::atomic_bool concurrent_job_done = ATOMIC_VAR_INIT(false);
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+	std::thread submitter([&]() {
+		/* Submit while the command below waits for this job */
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(IncrementSame1D),
+			static_cast<void*>(&num_processed_items),
+			kParallelize1DRange,
+			0 /* flags */);
+		concurrent_job_done.store(true, std::memory_order_release);
+	});
+
+	const auto start = std::chrono::steady_clock::now();
+	pthreadpool_parallelize_1d(
 		threadpool.get(),
-		ComputeNothing2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(WaitForConcurrentJob),
+		static_cast<void*>(&concurrent_job_done),
+		pthreadpool_get_threads_count(threadpool.get()),
 		0 /* flags */);
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	submitter.join();
+
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+	EXPECT_LT(elapsed, std::chrono::seconds(5));
 }
 
-static void CheckBounds2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
+static void IncrementCallback(std::atomic_int* num_callbacks) {
+	num_callbacks->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Async, NullThreadPool) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	std::atomic_int num_callbacks = ATOMIC_VAR_INIT(0);
+	pthreadpool_async_t async = pthreadpool_parallelize_1d_async(
+		nullptr,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */,
+		reinterpret_cast<pthreadpool_async_callback_t>(IncrementCallback),
+		static_cast<void*>(&num_callbacks));
+	ASSERT_TRUE(async);
+
+	EXPECT_TRUE(pthreadpool_test_async(async));
+	EXPECT_EQ(num_callbacks.load(std::memory_order_relaxed), 1);
+	pthreadpool_destroy_async(async);
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(Async, SingleThreadPoolCompletesBeforeReturn) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+	pthreadpool_async_t async = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		CheckBounds2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_1d_t>(IncrementSame1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		0 /* flags */,
+		nullptr /* callback */,
+		nullptr /* callback context */);
+	ASSERT_TRUE(async);
+
+	EXPECT_TRUE(pthreadpool_test_async(async));
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+	pthreadpool_destroy_async(async);
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Async, MultiThreadPoolEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1890,34 +2409,28 @@ TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
-		threadpool.get(),
-		CheckBounds2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
-
-static void CheckTiling2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
-}
-
-TEST(Parallelize2DTile1D, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_async_t async = pthreadpool_parallelize_1d_async(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */,
+			nullptr /* callback */,
+			nullptr /* callback context */);
+		ASSERT_TRUE(async);
+		pthreadpool_destroy_async(async);
+	}
 
-	pthreadpool_parallelize_2d_tile_1d(
-		threadpool.get(),
-		CheckTiling2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Async, MultiThreadPoolCompletesWithoutWait) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1925,46 +2438,75 @@ TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	/* Let the workers fall asleep, so that only the asynchronous job can wake them up */
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+	std::atomic_int num_callbacks = ATOMIC_VAR_INIT(0);
+	pthreadpool_async_t async = pthreadpool_parallelize_1d_async(
 		threadpool.get(),
-		CheckTiling2DTile1D,
-		nullptr,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_1d_t>(IncrementSame1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		0 /* flags */,
+		reinterpret_cast<pthreadpool_async_callback_t>(IncrementCallback),
+		static_cast<void*>(&num_callbacks));
+	ASSERT_TRUE(async);
 
-static void SetTrue2DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while (!pthreadpool_test_async(async) && std::chrono::steady_clock::now() < deadline) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
 	}
-}
+	EXPECT_TRUE(pthreadpool_test_async(async));
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+	EXPECT_EQ(num_callbacks.load(std::memory_order_relaxed), 1);
 
-TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	pthreadpool_destroy_async(async);
+	EXPECT_EQ(num_callbacks.load(std::memory_order_relaxed), 1);
+}
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Async, MultiThreadPoolOverlapsWithParallelize) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	std::vector<std::atomic_int> async_counters(kParallelize1DRange);
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_async_t async = pthreadpool_parallelize_1d_async(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(async_counters.data()),
+			kParallelize1DRange,
+			0 /* flags */,
+			nullptr /* callback */,
+			nullptr /* callback context */);
+		ASSERT_TRUE(async);
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+		pthreadpool_wait_async(async);
+		EXPECT_TRUE(pthreadpool_test_async(async));
+		pthreadpool_destroy_async(async);
 	}
-}
 
-TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(async_counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << async_counters[i].load(std::memory_order_relaxed) << " times "
+			<< "by asynchronous computations (expected: " << kIncrementIterations << ")";
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
 
+TEST(Async, MultiThreadPoolRunPlan) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -1972,55 +2514,141 @@ TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
 		0 /* flags */);
+	ASSERT_TRUE(plan);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+	/* More outstanding computations than concurrent job slots */
+	std::vector<pthreadpool_async_t> asyncs;
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		asyncs.push_back(pthreadpool_run_plan_async(plan, nullptr /* callback */, nullptr /* callback context */));
+		ASSERT_TRUE(asyncs.back());
+	}
+	pthreadpool_destroy_plan(plan);
+	for (pthreadpool_async_t async : asyncs) {
+		pthreadpool_destroy_async(async);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-static void Increment2DTile1D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+struct diamond_graph_context {
+	std::vector<size_t> source;
+	std::vector<size_t> left;
+	std::vector<size_t> right;
+	std::vector<size_t> sink;
+};
+
+static void FillSource1D(diamond_graph_context* context, size_t i) {
+	context->source[i] = i;
+}
+
+static void DoubleSource2D(diamond_graph_context* context, size_t i, size_t j) {
+	const size_t index = i * kGraphColumns + j;
+	context->left[index] = context->source[index] * 2;
+}
+
+static void IncrementSource1DTile1D(diamond_graph_context* context, size_t start_i, size_t tile_i) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		context->right[i] = context->source[i] + 1;
+	}
+}
+
+static void SumLeftRight1D(diamond_graph_context* context, size_t i) {
+	context->sink[i] = context->left[i] + context->right[i];
+}
+
+/*
+ * Runs a diamond-shaped graph: a source node, two nodes which depend on it, and a sink node which depends on both.
+ * Every node reads the outputs of its predecessors, so it fails unless the graph respects the dependencies.
+ */
+static void RunDiamondGraph(pthreadpool_t threadpool) {
+	const size_t range = kGraphRows * kGraphColumns;
+	diamond_graph_context context;
+	context.source.resize(range);
+	context.left.resize(range);
+	context.right.resize(range);
+	context.sink.resize(range);
+
+	pthreadpool_plan_t source = pthreadpool_create_plan_1d(
+		threadpool, reinterpret_cast<pthreadpool_task_1d_t>(FillSource1D), static_cast<void*>(&context),
+		range, 0 /* flags */);
+	pthreadpool_plan_t left = pthreadpool_create_plan_2d(
+		threadpool, reinterpret_cast<pthreadpool_task_2d_t>(DoubleSource2D), static_cast<void*>(&context),
+		kGraphRows, kGraphColumns, 0 /* flags */);
+	pthreadpool_plan_t right = pthreadpool_create_plan_1d_tile_1d(
+		threadpool, reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(IncrementSource1DTile1D), static_cast<void*>(&context),
+		range, kGraphColumns, 0 /* flags */);
+	pthreadpool_plan_t sink = pthreadpool_create_plan_1d(
+		threadpool, reinterpret_cast<pthreadpool_task_1d_t>(SumLeftRight1D), static_cast<void*>(&context),
+		range, 0 /* flags */);
+	ASSERT_TRUE(source && left && right && sink);
+
+	pthreadpool_graph_t graph = pthreadpool_create_graph(threadpool);
+	ASSERT_TRUE(graph);
+	const size_t source_node = pthreadpool_add_graph_node(graph, source);
+	const size_t left_node = pthreadpool_add_graph_node(graph, left);
+	const size_t right_node = pthreadpool_add_graph_node(graph, right);
+	const size_t sink_node = pthreadpool_add_graph_node(graph, sink);
+	ASSERT_NE(sink_node, SIZE_MAX);
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, source_node, left_node));
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, source_node, right_node));
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, left_node, sink_node));
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, right_node, sink_node));
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		std::fill(context.source.begin(), context.source.end(), 0);
+		std::fill(context.left.begin(), context.left.end(), 0);
+		std::fill(context.right.begin(), context.right.end(), 0);
+		std::fill(context.sink.begin(), context.sink.end(), 0);
+
+		pthreadpool_run_graph(graph);
+
+		for (size_t i = 0; i < range; i++) {
+			ASSERT_EQ(context.sink[i], 3 * i + 1)
+				<< "Element " << i << " of the sink node is wrong in iteration " << iteration;
+		}
 	}
+
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(source);
+	pthreadpool_destroy_plan(left);
+	pthreadpool_destroy_plan(right);
+	pthreadpool_destroy_plan(sink);
 }
 
-TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Graph, NullThreadPool) {
+	RunDiamondGraph(nullptr);
+}
 
+TEST(Graph, SingleThreadPool) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	RunDiamondGraph(threadpool.get());
+}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+TEST(Graph, MultiThreadPoolDiamond) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
-}
 
-TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	RunDiamondGraph(threadpool.get());
+}
 
+TEST(Graph, MultiThreadPoolChainEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2028,52 +2656,44 @@ TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DRange,
 		0 /* flags */);
+	ASSERT_TRUE(plan);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	pthreadpool_graph_t graph = pthreadpool_create_graph(threadpool.get());
+	ASSERT_TRUE(graph);
+	for (size_t node = 0; node < kGraphChainLength; node++) {
+		ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), node);
+		if (node != 0) {
+			ASSERT_TRUE(pthreadpool_add_graph_edge(graph, node - 1, node));
 		}
 	}
-}
-
-TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-			0 /* flags */);
+		pthreadpool_run_graph(graph);
 	}
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(plan);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations * kGraphChainLength)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations * kGraphChainLength << ")";
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+static const size_t kGraphSlowNodeIterations = 5;
+
+static void SleepOneMillisecond1D(void*, size_t) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
 
+TEST(Graph, MultiThreadPoolSleepsDuringSequentialNode) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2081,34 +2701,49 @@ TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-			0 /* flags */);
+	/* Without spinning, threads which find no ready slot go to sleep until the sequential node completes */
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	pthreadpool_plan_t slow = pthreadpool_create_plan_1d(
+		threadpool.get(), SleepOneMillisecond1D, nullptr, 20, 0 /* flags */);
+	ASSERT_TRUE(slow);
+	pthreadpool_set_plan_max_threads(slow, 1);
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */);
+	ASSERT_TRUE(plan);
+
+	pthreadpool_graph_t graph = pthreadpool_create_graph(threadpool.get());
+	ASSERT_TRUE(graph);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, slow), 0);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), 1);
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, 0, 1));
+
+	for (size_t iteration = 0; iteration < kGraphSlowNodeIterations; iteration++) {
+		pthreadpool_run_graph(graph);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	/* Runs use the current contents of the plans, also after the plans change between runs */
+	pthreadpool_set_plan_max_threads(plan, 2);
+	for (size_t iteration = 0; iteration < kGraphSlowNodeIterations; iteration++) {
+		pthreadpool_run_graph(graph);
 	}
-}
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(slow);
+	pthreadpool_destroy_plan(plan);
 
-static void IncrementSame2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 2 * kGraphSlowNodeIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << 2 * kGraphSlowNodeIterations << ")";
 	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Graph, MultiThreadPoolUsesCurrentPlanThreadLimit) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2117,28 +2752,115 @@ TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(IncrementSame2DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
+	ASSERT_TRUE(plan);
+
+	/* The first node is added with a lower thread limit than the second one */
+	pthreadpool_graph_t graph = pthreadpool_create_graph(threadpool.get());
+	ASSERT_TRUE(graph);
+	pthreadpool_set_plan_max_threads(plan, 2);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), 0);
+	pthreadpool_set_plan_max_threads(plan, 0);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), 1);
+	ASSERT_TRUE(pthreadpool_add_graph_edge(graph, 0, 1));
+
+	/* Every run uses the thread limit which the plan has at the time of the run */
+	const size_t max_threads[] = { 0, 2, 1, 0 };
+	int expected = 0;
+	for (size_t limit : max_threads) {
+		pthreadpool_set_plan_max_threads(plan, limit);
+		pthreadpool_run_graph(graph);
+		expected += 2;
+
+		for (size_t i = 0; i < kParallelize1DRange; i++) {
+			ASSERT_EQ(counters[i].load(std::memory_order_relaxed), expected)
+				<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << expected << ") with thread limit " << limit;
+		}
+	}
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(plan);
+}
+
+TEST(Graph, RejectsEdgesToEarlierNodes) {
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
+		nullptr, reinterpret_cast<pthreadpool_task_1d_t>(ComputeNothing1D), nullptr, kParallelize1DRange, 0 /* flags */);
+	ASSERT_TRUE(plan);
+	pthreadpool_graph_t graph = pthreadpool_create_graph(nullptr);
+	ASSERT_TRUE(graph);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), 0);
+	ASSERT_EQ(pthreadpool_add_graph_node(graph, plan), 1);
+
+	EXPECT_FALSE(pthreadpool_add_graph_edge(graph, 1, 0));
+	EXPECT_FALSE(pthreadpool_add_graph_edge(graph, 1, 1));
+	EXPECT_FALSE(pthreadpool_add_graph_edge(graph, 0, 2));
+	EXPECT_TRUE(pthreadpool_add_graph_edge(graph, 0, 1));
+
+	pthreadpool_destroy_graph(graph);
+	pthreadpool_destroy_plan(plan);
+}
+
+static void RunDiamondBatch(pthreadpool_t threadpool) {
+	const size_t range = kGraphRows * kGraphColumns;
+	diamond_graph_context context;
+	context.source.resize(range);
+	context.left.resize(range);
+	context.right.resize(range);
+	context.sink.resize(range);
+
+	/* The right plan runs on a single thread between plans processed by the thread pool */
+	pthreadpool_plan_t plans[] = {
+		pthreadpool_create_plan_1d(
+			threadpool, reinterpret_cast<pthreadpool_task_1d_t>(FillSource1D), static_cast<void*>(&context),
+			range, 0 /* flags */),
+		pthreadpool_create_plan_2d(
+			threadpool, reinterpret_cast<pthreadpool_task_2d_t>(DoubleSource2D), static_cast<void*>(&context),
+			kGraphRows, kGraphColumns, 0 /* flags */),
+		pthreadpool_create_plan_1d_tile_1d(
+			nullptr, reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(IncrementSource1DTile1D), static_cast<void*>(&context),
+			range, kGraphColumns, 0 /* flags */),
+		pthreadpool_create_plan_1d(
+			threadpool, reinterpret_cast<pthreadpool_task_1d_t>(SumLeftRight1D), static_cast<void*>(&context),
+			range, 0 /* flags */),
+	};
+	ASSERT_TRUE(plans[0] && plans[1] && plans[2] && plans[3]);
 
-static void WorkImbalance2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		std::fill(context.source.begin(), context.source.end(), 0);
+		std::fill(context.left.begin(), context.left.end(), 0);
+		std::fill(context.right.begin(), context.right.end(), 0);
+		std::fill(context.sink.begin(), context.sink.end(), 0);
+
+		pthreadpool_run_batch(threadpool, plans, 4);
+
+		for (size_t i = 0; i < range; i++) {
+			ASSERT_EQ(context.sink[i], 3 * i + 1)
+				<< "Element " << i << " of the last plan is wrong in iteration " << iteration;
 		}
 	}
+
+	for (pthreadpool_plan_t plan : plans) {
+		pthreadpool_destroy_plan(plan);
+	}
 }
 
-TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Batch, NullThreadPool) {
+	RunDiamondBatch(nullptr);
+}
+
+TEST(Batch, SingleThreadPool) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	RunDiamondBatch(threadpool.get());
+}
 
+TEST(Batch, MultiThreadPoolDependentPlans) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2146,31 +2868,10 @@ TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(WorkImbalance2DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
-
-static void ComputeNothing2DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t) {
-}
-
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(threadpool.get(),
-		ComputeNothing2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	RunDiamondBatch(threadpool.get());
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
+TEST(Batch, MultiThreadPoolConcurrentSubmittersEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2178,370 +2879,434 @@ TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	pthreadpool_plan_t plan = pthreadpool_create_plan_1d(
 		threadpool.get(),
-		ComputeNothing2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
 		0 /* flags */);
+	ASSERT_TRUE(plan);
+	const std::vector<pthreadpool_plan_t> plans(kGraphChainLength, plan);
+
+	/* Batches which find the thread pool busy run their plans one by one */
+	std::vector<std::thread> submitters;
+	for (size_t submitter = 0; submitter < kConcurrentSubmitters; submitter++) {
+		submitters.emplace_back([&]() {
+			for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+				pthreadpool_run_batch(threadpool.get(), plans.data(), plans.size());
+			}
+		});
+	}
+	for (std::thread& submitter : submitters) {
+		submitter.join();
+	}
+	pthreadpool_destroy_plan(plan);
+
+	const size_t expected = kConcurrentSubmitters * kIncrementIterations * kGraphChainLength;
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), expected)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << expected << ")";
+	}
 }
 
-static void CheckUArch2DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
+struct spmd_context {
+	pthreadpool_t threadpool;
+	std::vector<std::atomic_int> calls;
+	std::vector<size_t> values;
+	std::atomic_bool wrong_threads_count;
+	std::atomic_bool wrong_neighbour_value;
+
+	spmd_context(pthreadpool_t threadpool, size_t threads_count) :
+		threadpool(threadpool), calls(threads_count), values(threads_count), wrong_threads_count(false), wrong_neighbour_value(false)
+	{
 	}
+};
+
+static void CountSpmdCalls(spmd_context* context, size_t thread_index, size_t threads_count) {
+	if (threads_count != context->calls.size()) {
+		context->wrong_threads_count.store(true, std::memory_order_relaxed);
+		return;
+	}
+	context->calls[thread_index].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
+static void ExchangeValuesAcrossBarriers(spmd_context* context, size_t thread_index, size_t threads_count) {
+	if (threads_count != context->values.size()) {
+		context->wrong_threads_count.store(true, std::memory_order_relaxed);
+		return;
+	}
+
+	/* The private value survives barriers, and each phase reads the value which the neighbour wrote before the barrier */
+	size_t value = thread_index;
+	for (size_t phase = 0; phase < kSpmdPhases; phase++) {
+		context->values[thread_index] = value;
+		pthreadpool_barrier_wait(context->threadpool);
+
+		const size_t neighbour = (thread_index + 1) % threads_count;
+		if (context->values[neighbour] != neighbour + phase * threads_count) {
+			context->wrong_neighbour_value.store(true, std::memory_order_relaxed);
+		}
+		value += threads_count;
+		pthreadpool_barrier_wait(context->threadpool);
+	}
+}
+
+TEST(Spmd, NullThreadPool) {
+	spmd_context context(nullptr, 1);
+	pthreadpool_run_spmd(nullptr, reinterpret_cast<pthreadpool_task_spmd_t>(ExchangeValuesAcrossBarriers), &context, 0 /* flags */);
+	EXPECT_FALSE(context.wrong_threads_count.load());
+	EXPECT_FALSE(context.wrong_neighbour_value.load());
+}
+
+TEST(Spmd, SingleThreadPool) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckUArch2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	spmd_context context(threadpool.get(), 1);
+	pthreadpool_run_spmd(threadpool.get(), reinterpret_cast<pthreadpool_task_spmd_t>(ExchangeValuesAcrossBarriers), &context, 0 /* flags */);
+	EXPECT_FALSE(context.wrong_threads_count.load());
+	EXPECT_FALSE(context.wrong_neighbour_value.load());
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Spmd, MultiThreadPoolEachThreadCalledOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckUArch2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
-
-static void CheckBounds2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
-}
-
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckBounds2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	spmd_context context(threadpool.get(), threads_count);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_spmd(threadpool.get(), reinterpret_cast<pthreadpool_task_spmd_t>(CountSpmdCalls), &context, 0 /* flags */);
+	}
+	EXPECT_FALSE(context.wrong_threads_count.load());
+	for (size_t i = 0; i < threads_count; i++) {
+		EXPECT_EQ(context.calls[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Thread " << i << " was called " << context.calls[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Spmd, MultiThreadPoolBarrierSeparatesPhases) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckBounds2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
-
-static void CheckTiling2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+	spmd_context context(threadpool.get(), threads_count);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_spmd(threadpool.get(), reinterpret_cast<pthreadpool_task_spmd_t>(ExchangeValuesAcrossBarriers), &context, 0 /* flags */);
+	}
+	EXPECT_FALSE(context.wrong_threads_count.load());
+	EXPECT_FALSE(context.wrong_neighbour_value.load());
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+static void RunNestedSpmd(std::unique_ptr<spmd_context>* contexts, size_t i) {
+	pthreadpool_run_spmd(
+		contexts[i]->threadpool, reinterpret_cast<pthreadpool_task_spmd_t>(ExchangeValuesAcrossBarriers), contexts[i].get(),
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Spmd, MultiThreadPoolNestedCallRunsOnSingleThread) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+	/* Nested SPMD computations run concurrently on different threads, so each gets its own context */
+	std::vector<std::unique_ptr<spmd_context>> contexts(threads_count);
+	for (std::unique_ptr<spmd_context>& context : contexts) {
+		context.reset(new spmd_context(threadpool.get(), 1));
+	}
+	pthreadpool_parallelize_1d(
+		threadpool.get(), reinterpret_cast<pthreadpool_task_1d_t>(RunNestedSpmd), contexts.data(), threads_count,
 		0 /* flags */);
-}
-
-static void SetTrue2DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	for (const std::unique_ptr<spmd_context>& context : contexts) {
+		EXPECT_FALSE(context->wrong_threads_count.load());
+		EXPECT_FALSE(context->wrong_neighbour_value.load());
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+static void RecordThread1D(std::thread::id* threads, size_t i) {
+	threads[i] = std::this_thread::get_id();
+}
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+static size_t CountDistinctThreads(std::vector<std::thread::id> threads) {
+	std::sort(threads.begin(), threads.end());
+	return std::unique(threads.begin(), threads.end()) - threads.begin();
+}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+static void RecordSpmdThread(std::thread::id* threads, size_t thread_index, size_t) {
+	threads[thread_index] = std::this_thread::get_id();
+}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
+/* Returns the system threads which process the threads of the pool, or an empty vector if they are unknown */
+static std::vector<std::thread::id> GetPoolThreads(pthreadpool_t threadpool) {
+	std::vector<std::thread::id> threads(pthreadpool_get_threads_count(threadpool));
+	pthreadpool_run_spmd(threadpool, reinterpret_cast<pthreadpool_task_spmd_t>(RecordSpmdThread), threads.data(), 0 /* flags */);
+	if (CountDistinctThreads(threads) != threads.size()) {
+		threads.clear();
 	}
+	return threads;
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Team, NullThreadPool) {
+	EXPECT_EQ(pthreadpool_create_team(nullptr, 0, 1), nullptr);
+	pthreadpool_destroy_team(nullptr);
+}
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+TEST(Team, InvalidThreads) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
-	}
-}
+	EXPECT_EQ(pthreadpool_create_team(threadpool.get(), 0, 0), nullptr);
+	EXPECT_EQ(pthreadpool_create_team(threadpool.get(), 1, 1), nullptr);
+	EXPECT_EQ(pthreadpool_create_team(threadpool.get(), 0, 2), nullptr);
 
-static void Increment2DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
+	auto_pthreadpool_team_t team(pthreadpool_create_team(threadpool.get(), 0, 1), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+	EXPECT_FALSE(pthreadpool_set_team_threads(team.get(), 0, 2));
+	EXPECT_FALSE(pthreadpool_set_team_threads(threadpool.get(), 0, 1));
+	EXPECT_EQ(pthreadpool_create_team(team.get(), 0, 1), nullptr);
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Team, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+	auto_pthreadpool_team_t team(pthreadpool_create_team(threadpool.get(), 0, 1), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+	EXPECT_EQ(pthreadpool_get_threads_count(team.get()), 1);
+
+	pthreadpool_parallelize_1d(
+		team.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize1DRange,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: 1)";
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
+TEST(Team, MultiThreadPoolThreadsCount) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 2) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	/* Thread 0 of the thread pool is the calling thread, which every other team gets as an extra thread */
+	auto_pthreadpool_team_t team(pthreadpool_create_team(threadpool.get(), 0, 2), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+	EXPECT_EQ(pthreadpool_get_threads_count(team.get()), 2);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-		}
-	}
+	ASSERT_TRUE(pthreadpool_set_team_threads(team.get(), 1, threads_count - 1));
+	EXPECT_EQ(pthreadpool_get_threads_count(team.get()), threads_count);
 }
 
-TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Team, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 2) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_team_t team(pthreadpool_create_team(threadpool.get(), 1, threads_count / 2), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+		pthreadpool_parallelize_1d(
+			team.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize1DRange,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
-		}
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-
+TEST(Team, MultiThreadPoolRunsOnTeamThreads) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count < 4) {
 		GTEST_SKIP();
 	}
+	const std::vector<std::thread::id> pool_threads = GetPoolThreads(threadpool.get());
+	ASSERT_EQ(pool_threads.size(), threads_count);
+
+	const size_t first_thread = threads_count / 2;
+	auto_pthreadpool_team_t team(
+		pthreadpool_create_team(threadpool.get(), first_thread, threads_count - first_thread), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
 
+	std::vector<std::thread::id> allowed_threads(pool_threads.begin() + first_thread, pool_threads.end());
+	allowed_threads.push_back(std::this_thread::get_id());
+	std::vector<std::thread::id> threads(kParallelize1DRange);
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		pthreadpool_parallelize_1d(
+			team.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(RecordThread1D),
+			static_cast<void*>(threads.data()),
+			kParallelize1DRange,
 			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-				<< "Element (" << i << ", " << j << ") was processed "
-				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-				<< "(expected: " << kIncrementIterations << ")";
+		for (const std::thread::id& thread : threads) {
+			EXPECT_NE(std::find(allowed_threads.begin(), allowed_threads.end(), thread), allowed_threads.end());
 		}
 	}
-}
 
-static void IncrementSame2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	/* After repartitioning, the team runs on the other threads */
+	ASSERT_TRUE(pthreadpool_set_team_threads(team.get(), 1, first_thread - 1));
+	allowed_threads.assign(pool_threads.begin() + 1, pool_threads.begin() + first_thread);
+	allowed_threads.push_back(std::this_thread::get_id());
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			team.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(RecordThread1D),
+			static_cast<void*>(threads.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+		for (const std::thread::id& thread : threads) {
+			EXPECT_NE(std::find(allowed_threads.begin(), allowed_threads.end(), thread), allowed_threads.end());
+		}
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
+TEST(Team, MultiThreadPoolConcurrentTeamsEachItemProcessedOnce) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count < 2 * kTeamsCount) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(IncrementSame2DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
+	const size_t team_threads_count = threads_count / kTeamsCount;
+	std::vector<auto_pthreadpool_team_t> teams;
+	for (size_t t = 0; t < kTeamsCount; t++) {
+		teams.emplace_back(
+			pthreadpool_create_team(threadpool.get(), t * team_threads_count, team_threads_count), pthreadpool_destroy_team);
+		ASSERT_TRUE(teams.back().get());
+	}
 
-static void WorkImbalance2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	std::vector<std::vector<std::atomic_int>> counters(kTeamsCount);
+	std::vector<std::thread> submitters;
+	for (size_t t = 0; t < kTeamsCount; t++) {
+		counters[t] = std::vector<std::atomic_int>(kParallelize1DRange);
+		submitters.emplace_back([&teams, &counters, t]() {
+			for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+				pthreadpool_parallelize_1d(
+					teams[t].get(),
+					reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+					static_cast<void*>(counters[t].data()),
+					kParallelize1DRange,
+					0 /* flags */);
+			}
+		});
+	}
+	for (std::thread& submitter : submitters) {
+		submitter.join();
+	}
+
+	for (size_t t = 0; t < kTeamsCount; t++) {
+		for (size_t i = 0; i < kParallelize1DRange; i++) {
+			EXPECT_EQ(counters[t][i].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element " << i << " of team " << t << " was processed "
+				<< counters[t][i].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Team, MultiThreadPoolPlanEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 2) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(WorkImbalance2DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
+	auto_pthreadpool_team_t team(pthreadpool_create_team(threadpool.get(), 1, threads_count / 2), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		team.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void ComputeNothing2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t) {
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(HighPriority, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(threadpool.get(),
-		ComputeNothing2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			PTHREADPOOL_FLAG_HIGH_PRIORITY);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
+TEST(HighPriority, MultiThreadPoolPlanEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2549,35 +3314,125 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
 		threadpool.get(),
-		ComputeNothing2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_HIGH_PRIORITY), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-static void CheckUArch2DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
+static const size_t kBackgroundRange = 65536;
+
+struct BackgroundContext {
+	std::vector<std::atomic_int> counters;
+	std::atomic_bool started;
+	std::atomic_bool stop;
+};
+
+/* Processes an item of the background computation slowly until the test asks it to stop */
+static void ProcessBackground1D(BackgroundContext* context, size_t i) {
+	context->counters[i].fetch_add(1, std::memory_order_relaxed);
+	context->started.store(true, std::memory_order_release);
+	if (!context->stop.load(std::memory_order_acquire)) {
+		std::this_thread::sleep_for(std::chrono::microseconds(100));
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+struct UrgentContext {
+	std::vector<std::atomic_int> counters;
+	std::vector<std::thread::id> threads;
+};
+
+static void ProcessUrgent1D(UrgentContext* context, size_t i) {
+	context->counters[i].fetch_add(1, std::memory_order_relaxed);
+	context->threads[i] = std::this_thread::get_id();
+	std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+/*
+ * Starts a background computation with run_background on another thread, and checks that a high-priority computation
+ * submitted meanwhile preempts it.
+ */
+static void CheckPreemptsBackground(
+	pthreadpool_t threadpool,
+	const std::function<void(pthreadpool_t, BackgroundContext*)>& run_background)
+{
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool);
+
+	BackgroundContext background;
+	background.counters = std::vector<std::atomic_int>(kBackgroundRange);
+	background.started.store(false, std::memory_order_relaxed);
+	background.stop.store(false, std::memory_order_relaxed);
+	std::atomic_bool background_done = ATOMIC_VAR_INIT(false);
+	std::thread background_submitter([&]() {
+		run_background(threadpool, &background);
+		background_done.store(true, std::memory_order_release);
+	});
+	while (!background.started.load(std::memory_order_acquire)) {
+		std::this_thread::yield();
+	}
+
+	/* Every worker is busy with the background computation: only preempting workers help the calling thread */
+	const size_t urgent_range = threads_count * 8;
+	UrgentContext urgent;
+	urgent.counters = std::vector<std::atomic_int>(urgent_range);
+	urgent.threads = std::vector<std::thread::id>(urgent_range);
+	pthreadpool_parallelize_1d(
+		threadpool,
+		reinterpret_cast<pthreadpool_task_1d_t>(ProcessUrgent1D),
+		static_cast<void*>(&urgent),
+		urgent_range,
+		PTHREADPOOL_FLAG_HIGH_PRIORITY);
+	const bool background_done_before_urgent = background_done.load(std::memory_order_acquire);
+
+	background.stop.store(true, std::memory_order_release);
+	background_submitter.join();
+
+	EXPECT_FALSE(background_done_before_urgent);
+	EXPECT_GT(CountDistinctThreads(urgent.threads), 1);
+	for (size_t i = 0; i < urgent_range; i++) {
+		EXPECT_EQ(urgent.counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " of the high-priority computation was processed "
+			<< urgent.counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+	for (size_t i = 0; i < kBackgroundRange; i++) {
+		EXPECT_EQ(background.counters[i].load(std::memory_order_relaxed), 1)
+			<< "Element " << i << " of the background computation was processed "
+			<< background.counters[i].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+}
+
+TEST(HighPriority, MultiThreadPoolPreemptsRunningCommand) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckUArch2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	CheckPreemptsBackground(threadpool.get(), [](pthreadpool_t threadpool, BackgroundContext* background) {
+		pthreadpool_parallelize_1d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_t>(ProcessBackground1D),
+			static_cast<void*>(background),
+			kBackgroundRange,
+			0 /* flags */);
+	});
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
+TEST(HighPriority, MultiThreadPoolPreemptsRunningCommandWithGrain) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2585,35 +3440,34 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckUArch2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	/* Workers look for high-priority jobs once per claim of grain items */
+	CheckPreemptsBackground(threadpool.get(), [](pthreadpool_t threadpool, BackgroundContext* background) {
+		pthreadpool_parallelize_1d_with_grain(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_t>(ProcessBackground1D),
+			static_cast<void*>(background),
+			kBackgroundRange,
+			16 /* grain */,
+			0 /* flags */);
+	});
 }
 
-static void CheckBounds2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LT(i, kParallelize2DTile1DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
+TEST(SpinPolicy, NullThreadPool) {
+	pthreadpool_set_spin_policy(nullptr, PTHREADPOOL_SPIN_POLICY_FIXED, 1000);
+	EXPECT_EQ(pthreadpool_get_spin_wait_ns(nullptr), 0);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(SpinPolicy, FixedPolicySpinsForMaximum) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckBounds2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 123456);
+	EXPECT_EQ(pthreadpool_get_spin_wait_ns(threadpool.get()), 123456);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(SpinPolicy, MultiThreadPoolNoSpinEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2621,36 +3475,42 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckBounds2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-}
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
 
-static void CheckTiling2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+static const uint64_t kMaxSpinNs = 20000000;
+static const size_t kSpinLearningCommands = 16;
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+/* Submits commands with the given pause between them, and returns the learned spin-wait duration */
+static uint64_t LearnSpinWait(pthreadpool_t threadpool, std::chrono::microseconds gap) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+	for (size_t command = 0; command < kSpinLearningCommands; command++) {
+		std::this_thread::sleep_for(gap);
+		pthreadpool_parallelize_1d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			kParallelize1DRange,
+			0 /* flags */);
+	}
+	return pthreadpool_get_spin_wait_ns(threadpool);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
+TEST(SpinPolicy, MultiThreadPoolAdaptiveSpinsLessForRareCommands) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2658,96 +3518,253 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckTiling2DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_ADAPTIVE, kMaxSpinNs);
+	const uint64_t frequent_spin_ns = LearnSpinWait(threadpool.get(), std::chrono::microseconds(1000));
+	const uint64_t rare_spin_ns = LearnSpinWait(threadpool.get(), std::chrono::microseconds(2 * kMaxSpinNs / 1000));
+	EXPECT_LE(frequent_spin_ns, kMaxSpinNs);
+	EXPECT_LT(rare_spin_ns, frequent_spin_ns);
 }
 
-static void SetTrue2DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+TEST(TargetedWakeup, MultiThreadPoolFewItemsEachItemProcessedMultipleTimes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 2) {
+		GTEST_SKIP();
 	}
-}
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	/* Without spinning, workers fall asleep between computations, and only the needed workers wake up */
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	const size_t range = threads_count - 1;
+	std::vector<std::atomic_int> counters(range);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+			static_cast<void*>(counters.data()),
+			range,
+			0 /* flags */);
+	}
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+	for (size_t i = 0; i < range; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
+static const size_t kRendezvousIterations = 10;
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
+struct RendezvousContext {
+	size_t items;
+	std::atomic_size_t arrived;
+	std::atomic_bool timed_out;
+};
+
+/* Waits until the threads processing all items of the computation arrive, or gives up after a timeout */
+static void Rendezvous1D(RendezvousContext* context, size_t) {
+	context->arrived.fetch_add(1, std::memory_order_acq_rel);
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (context->arrived.load(std::memory_order_acquire) < context->items) {
+		if (std::chrono::steady_clock::now() > deadline) {
+			context->timed_out.store(true, std::memory_order_relaxed);
+			return;
 		}
+		std::this_thread::yield();
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+/* Runs computations whose items can only complete if sleeping workers wake up to process them at the same time */
+static void RunRendezvous(pthreadpool_t threadpool, size_t items) {
+	RendezvousContext context;
+	context.items = items;
+	context.timed_out.store(false, std::memory_order_relaxed);
+	for (size_t iteration = 0; iteration < kRendezvousIterations; iteration++) {
+		context.arrived.store(0, std::memory_order_relaxed);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		pthreadpool_parallelize_1d(
+			threadpool,
+			reinterpret_cast<pthreadpool_task_1d_t>(Rendezvous1D),
+			static_cast<void*>(&context),
+			items,
+			0 /* flags */);
+		EXPECT_FALSE(context.timed_out.load(std::memory_order_relaxed))
+			<< "Only " << context.arrived.load(std::memory_order_relaxed) << " of " << items << " items were "
+			<< "processed at the same time in iteration " << iteration;
+	}
+}
 
+TEST(TargetedWakeup, MultiThreadPoolFewItemsWakeHelpers) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count <= 2) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-				<< "Element (" << i << ", " << j << ") not processed";
-		}
-	}
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	RunRendezvous(threadpool.get(), threads_count - 1);
+	RunRendezvous(threadpool.get(), 2);
 }
 
-static void Increment2DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+TEST(TargetedWakeup, MultiThreadPoolTeamWakesTeamThreads) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	const size_t threads_count = pthreadpool_get_threads_count(threadpool.get());
+	if (threads_count < 4) {
+		GTEST_SKIP();
 	}
+
+	pthreadpool_set_spin_policy(threadpool.get(), PTHREADPOOL_SPIN_POLICY_FIXED, 0);
+	const size_t first_thread = threads_count / 2;
+	auto_pthreadpool_team_t team(
+		pthreadpool_create_team(threadpool.get(), first_thread, threads_count - first_thread), pthreadpool_destroy_team);
+	ASSERT_TRUE(team.get());
+
+	/* The calling thread takes the place of thread 0 in the team */
+	RunRendezvous(team.get(), pthreadpool_get_threads_count(team.get()));
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+static void ComputeNothing2D(void*, size_t, size_t) {
+}
 
+TEST(Parallelize2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(threadpool.get(),
+		ComputeNothing2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+		ComputeNothing2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+}
+
+static void CheckBounds2D(void*, size_t i, size_t j) {
+	EXPECT_LT(i, kParallelize2DRangeI);
+	EXPECT_LT(j, kParallelize2DRangeJ);
+}
+
+TEST(Parallelize2D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		CheckBounds2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		CheckBounds2D,
+		nullptr,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+}
+
+static void SetTrue2D(std::atomic_bool* processed_indicators, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
+
+TEST(Parallelize2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+TEST(Parallelize2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(SetTrue2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+static void Increment2D(std::atomic_int* processed_counters, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -2755,8 +3772,8 @@ TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOn
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2765,17 +3782,16 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnc
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -2783,25 +3799,24 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnc
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -2810,8 +3825,8 @@ TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMu
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+TEST(Parallelize2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -2821,18 +3836,17 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -2841,13 +3855,11 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMul
 	}
 }
 
-static void IncrementSame2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void IncrementSame2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2857,27 +3869,26 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(IncrementSame2DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_t>(IncrementSame2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void WorkImbalance2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
-	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0) {
+static void WorkImbalance2D(std::atomic_int* num_processed_items, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -2887,51 +3898,30 @@ TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(WorkImbalance2DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_t>(WorkImbalance2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
-}
-
-static void SetThreadTrue2DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t start_j, size_t tile_j) {
-	EXPECT_LE(thread_index, *num_threads);
-}
-
-TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetThreadTrue2DTile1DWithUArchWithThread),
-		static_cast<void*>(&num_threads),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void ComputeNothing2DTile2D(void*, size_t, size_t, size_t, size_t) {
+static void ComputeNothing2DWithThread(void*, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize2DWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(threadpool.get(),
-		ComputeNothing2DTile2D,
+	pthreadpool_parallelize_2d_with_thread(threadpool.get(),
+		ComputeNothing2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -2939,78 +3929,32 @@ TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		ComputeNothing2DTile2D,
+		ComputeNothing2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
-}
-
-static void CheckBounds2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
-	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
-}
-
-TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_2d(
-		threadpool.get(),
-		CheckBounds2DTile2D,
-		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
-}
-
-TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_2d_tile_2d(
-		threadpool.get(),
-		CheckBounds2DTile2D,
-		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void CheckTiling2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_GT(tile_i, 0);
-	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
-	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
-	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
-
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+static void CheckBounds2DWithThread(void*, size_t, size_t i, size_t j) {
+	EXPECT_LT(i, kParallelize2DRangeI);
+	EXPECT_LT(j, kParallelize2DRangeJ);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		CheckTiling2DTile2D,
+		CheckBounds2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3018,49 +3962,43 @@ TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		CheckTiling2DTile2D,
+		CheckBounds2DWithThread,
 		nullptr,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void SetTrue2DTile2D(std::atomic_bool* processed_indicators, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
-	}
+static void SetTrue2DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3069,49 +4007,43 @@ TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(SetTrue2DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void Increment2DTile2D(std::atomic_int* processed_counters, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void Increment2DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j) {
+	const size_t linear_idx = i * kParallelize2DRangeJ + j;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3119,8 +4051,8 @@ TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3129,17 +4061,16 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3147,25 +4078,24 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d(
+		pthreadpool_parallelize_2d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3174,8 +4104,8 @@ TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3185,18 +4115,17 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d(
+		pthreadpool_parallelize_2d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			reinterpret_cast<pthreadpool_task_2d_with_thread_t>(Increment2DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DRangeI, kParallelize2DRangeJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3205,15 +4134,11 @@ TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void IncrementSame2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize2DWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3223,27 +4148,26 @@ TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(IncrementSame2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(IncrementSame2DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-static void WorkImbalance2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
-	if (start_i == 0 && start_j == 0) {
+static void WorkImbalance2DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DRangeI * kParallelize2DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3253,71 +4177,51 @@ TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(WorkImbalance2DTile2D),
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(WorkImbalance2DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
-}
-
-static void ComputeNothing2DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DRangeI * kParallelize2DRangeJ);
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing2DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
-		0 /* flags */);
+static void CheckThreadIndexValid2DWithThread(const size_t* num_threads, size_t thread_index, size_t, size_t) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolCompletes) {
+TEST(Parallelize2DWithThread, MultiThreadPoolThreadIndexValid) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+	if (num_threads <= 1) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_with_thread(
 		threadpool.get(),
-		ComputeNothing2DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		reinterpret_cast<pthreadpool_task_2d_with_thread_t>(CheckThreadIndexValid2DWithThread),
+		static_cast<void*>(&num_threads),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
 		0 /* flags */);
 }
 
-static void CheckUArch2DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing2DTile1D(void*, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize2DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckUArch2DTile2DWithUArch,
+	pthreadpool_parallelize_2d_tile_1d(threadpool.get(),
+		ComputeNothing2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize2DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3325,38 +4229,33 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckUArch2DTile2DWithUArch,
+		ComputeNothing2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void CheckBounds2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
-	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
-	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
+static void CheckBounds2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile2DWithUArch,
+		CheckBounds2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3364,43 +4263,34 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds2DTile2DWithUArch,
+		CheckBounds2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void CheckTiling2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	EXPECT_GT(tile_i, 0);
-	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
-	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
-	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
-
+static void CheckTiling2DTile1D(void*, size_t i, size_t start_j, size_t tile_j) {
 	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile2DWithUArch,
+		CheckTiling2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3408,51 +4298,45 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		CheckTiling2DTile2DWithUArch,
+		CheckTiling2DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue2DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue2DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3461,51 +4345,45 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(SetTrue2DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void Increment2DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment2DTile1D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3513,8 +4391,8 @@ TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3523,18 +4401,16 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -3542,26 +4418,24 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		pthreadpool_parallelize_2d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3570,8 +4444,8 @@ TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTime
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+TEST(Parallelize2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3581,19 +4455,17 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		pthreadpool_parallelize_2d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
-			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
 			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 				<< "Element (" << i << ", " << j << ") was processed "
 				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -3602,15 +4474,13 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 }
 
-static void IncrementSame2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	for (size_t i = start_i; i < start_i + tile_i; i++) {
-		for (size_t j = start_j; j < start_j + tile_j; j++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize2DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3620,28 +4490,26 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(IncrementSame2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(IncrementSame2DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void WorkImbalance2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
-	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
-	if (start_i == 0 && start_j == 0) {
+static void WorkImbalance2DTile1D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -3651,32 +4519,31 @@ TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+	pthreadpool_parallelize_2d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(WorkImbalance2DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(WorkImbalance2DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
-		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void ComputeNothing3D(void*, size_t, size_t, size_t) {
+static void ComputeNothing2DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3D, SingleThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(threadpool.get(),
-		ComputeNothing3D,
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(threadpool.get(),
+		ComputeNothing2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3684,33 +4551,35 @@ TEST(Parallelize3D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		ComputeNothing3D,
+		ComputeNothing2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void CheckBounds3D(void*, size_t i, size_t j, size_t k) {
-	EXPECT_LT(i, kParallelize3DRangeI);
-	EXPECT_LT(j, kParallelize3DRangeJ);
-	EXPECT_LT(k, kParallelize3DRangeK);
+static void CheckUArch2DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3D,
+		CheckUArch2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3718,46 +4587,35 @@ TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3D,
+		CheckUArch2DTile1DWithUArch,
 		nullptr,
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue3D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k) {
-	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckBounds2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckBounds2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3765,57 +4623,36 @@ TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckBounds2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-static void Increment3D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k) {
-	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void CheckTiling2DTile1DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
 }
 
-TEST(Parallelize3D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckTiling2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3823,55 +4660,47 @@ TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		CheckTiling2DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
+static void SetTrue2DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
-				0 /* flags */);
-	}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3880,63 +4709,56 @@ TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
-			static_cast<void*>(counters.data()),
-			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
-				0 /* flags */);
-	}
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(SetTrue2DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void IncrementSame3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void Increment2DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(IncrementSame3D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-}
 
-static void WorkImbalance3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -3945,31 +4767,54 @@ TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_t>(WorkImbalance3D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
-}
 
-static void ComputeNothing3DTile1D(void*, size_t, size_t, size_t, size_t) {
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(threadpool.get(),
-		ComputeNothing3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -3977,36 +4822,66 @@ TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
-		threadpool.get(),
-		ComputeNothing3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_1d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(Increment2DTile1DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-static void CheckBounds3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+static void IncrementSame2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(IncrementSame2DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
+static void WorkImbalance2DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4014,36 +4889,32 @@ TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1D,
-		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_t>(WorkImbalance2DTile1DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void CheckTiling3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+static void ComputeNothing2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
-		threadpool.get(),
-		CheckTiling3DTile1D,
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(threadpool.get(),
+		ComputeNothing2DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4051,50 +4922,35 @@ TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling3DTile1D,
+		ComputeNothing2DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckUArch2DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
 	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckUArch2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4102,60 +4958,120 @@ TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckUArch2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
 }
 
-static void Increment3DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
+static void CheckBounds2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LT(i, kParallelize2DTile1DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile1DRangeJ);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile1DRangeJ);
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		CheckBounds2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckBounds2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+static void CheckTiling2DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile1DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile1DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile1DTileJ, kParallelize2DTile1DRangeJ - start_j));
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckTiling2DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+static void SetTrue2DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4164,57 +5080,111 @@ TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
+}
+
+static void Increment2DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
+}
+
+TEST(Parallelize2DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d(
+		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4224,35 +5194,33 @@ TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d(
+		pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
+			reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(Increment2DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile1DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile1DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-static void IncrementSame3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
+static void IncrementSame2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
 		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4262,27 +5230,27 @@ TEST(Parallelize3DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(IncrementSame3DTile1D),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(IncrementSame2DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void WorkImbalance3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
+static void WorkImbalance2DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t start_j, size_t tile_j) {
+	num_processed_items->fetch_add(tile_j, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -4292,32 +5260,51 @@ TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d(
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(WorkImbalance3DTile1D),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(WorkImbalance2DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
 }
 
-static void ComputeNothing3DTile1DWithThread(void*, size_t, size_t, size_t, size_t, size_t) {
+static void SetThreadTrue2DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t start_j, size_t tile_j) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolCompletes) {
+TEST(Parallelize2DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_with_id_with_thread_t>(SetThreadTrue2DTile1DWithUArchWithThread),
+		static_cast<void*>(&num_threads),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */);
+}
+
+static void ComputeNothing2DTile2D(void*, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize2DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(threadpool.get(),
-		ComputeNothing3DTile1DWithThread,
+	pthreadpool_parallelize_2d_tile_2d(threadpool.get(),
+		ComputeNothing2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize2DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4325,36 +5312,36 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		ComputeNothing3DTile1DWithThread,
+		ComputeNothing2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+static void CheckBounds2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
+	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckBounds3DTile1DWithThread,
+		CheckBounds2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4362,36 +5349,41 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckBounds3DTile1DWithThread,
+		CheckBounds2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+static void CheckTiling2DTile2D(void*, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_GT(tile_i, 0);
+	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
+	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
+	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
+
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckTiling3DTile1DWithThread,
+		CheckTiling2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4399,49 +5391,49 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckTiling3DTile1DWithThread,
+		CheckTiling2DTile2D,
 		nullptr,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void SetTrue2DTile2D(std::atomic_bool* processed_indicators, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4450,60 +5442,58 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(SetTrue2DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
 		}
 	}
 }
 
-static void Increment3DTile1DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment2DTile2D(std::atomic_int* processed_counters, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4512,57 +5502,54 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnceMortonOrder) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_thread(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
-			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnceMortonOrderSingleTileColumn) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4571,37 +5558,26 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTime
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_thread(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
-			static_cast<void*>(counters.data()),
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
+	pthreadpool_parallelize_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		1, kParallelize2DTile2DRangeJ,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON);
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-static void IncrementSame3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnceMortonOrderSingleTileRow) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4610,82 +5586,96 @@ TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(IncrementSame3DTile1DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DRangeI, 1,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON);
 
-static void WorkImbalance3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+/* Records which thread processed each 1x1 tile and in which order */
+struct TileOrderLog {
+	TileOrderLog(size_t range_i, size_t range_j, size_t range_k) :
+		range_j(range_j), range_k(range_k), counters(range_i * range_j * range_k),
+		stamps(counters.size()), threads(counters.size()) {}
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
+	const size_t range_j;
+	const size_t range_k;
+	std::atomic_size_t next_stamp{0};
+	std::vector<std::atomic_int> counters;
+	std::vector<size_t> stamps;
+	std::vector<std::thread::id> threads;
+};
 
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(WorkImbalance3DTile1DWithThread),
-		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+static void RecordTile(TileOrderLog* log, size_t linear_idx) {
+	log->counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	log->stamps[linear_idx] = log->next_stamp.fetch_add(1, std::memory_order_relaxed);
+	log->threads[linear_idx] = std::this_thread::get_id();
 }
 
-static void CheckThreadIndexValid3DTile1DWithThread(const size_t* num_threads, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LE(thread_index, *num_threads);
+static void RecordTile2DTile2D(TileOrderLog* log, size_t start_i, size_t start_j, size_t, size_t) {
+	RecordTile(log, start_i * log->range_j + start_j);
 }
 
-TEST(Parallelize3DTile1DWithThread, MultiThreadPoolThreadIndexValid) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(CheckThreadIndexValid3DTile1DWithThread),
-		static_cast<void*>(&num_threads),
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+/* Returns the tiles processed by the thread, in the order it processed them */
+static std::vector<size_t> ThreadTileSequence(const TileOrderLog& log, std::thread::id thread) {
+	std::vector<size_t> sequence;
+	for (size_t idx = 0; idx < log.threads.size(); idx++) {
+		if (log.threads[idx] == thread) {
+			sequence.push_back(idx);
+		}
+	}
+	std::sort(sequence.begin(), sequence.end(),
+		[&log](size_t a, size_t b) { return log.stamps[a] < log.stamps[b]; });
+	return sequence;
 }
 
-static void ComputeNothing3DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+/* With the static schedule every thread must walk a contiguous run of the expected order */
+static void ExpectTileRunsInOrder(const TileOrderLog& log, const std::vector<size_t>& expected_order) {
+	for (size_t idx = 0; idx < log.counters.size(); idx++) {
+		EXPECT_EQ(log.counters[idx].load(std::memory_order_relaxed), 1)
+			<< "Tile " << idx << " was processed "
+			<< log.counters[idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+	}
+
+	std::vector<std::thread::id> threads(log.threads);
+	std::sort(threads.begin(), threads.end());
+	threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+	for (std::thread::id thread : threads) {
+		const std::vector<size_t> sequence = ThreadTileSequence(log, thread);
+		const auto run_start = std::find(expected_order.begin(), expected_order.end(), sequence.front());
+		ASSERT_NE(run_start, expected_order.end());
+		const size_t offset = run_start - expected_order.begin();
+		ASSERT_LE(offset + sequence.size(), expected_order.size());
+		for (size_t n = 0; n < sequence.size(); n++) {
+			EXPECT_EQ(sequence[n], expected_order[offset + n])
+				<< "Tile #" << n << " of a thread's run is out of Z-order";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+/* Z-order of a 3x5 tile grid: the 4x4 top-left quadrant loses its last row, the top-right quadrant keeps one column */
+static const size_t kMortonOrder3x5[15] = {
+	0 * 5 + 0, 0 * 5 + 1, 1 * 5 + 0, 1 * 5 + 1, 0 * 5 + 2, 0 * 5 + 3, 1 * 5 + 2, 1 * 5 + 3,
+	2 * 5 + 0, 2 * 5 + 1, 2 * 5 + 2, 2 * 5 + 3,
+	0 * 5 + 4, 1 * 5 + 4, 2 * 5 + 4,
+};
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(threadpool.get(),
-		ComputeNothing3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+TEST(Parallelize2DTile2D, MultiThreadPoolMortonOrderStartsWithZ) {
+	const size_t kRange = 16;
+	TileOrderLog log(kRange, kRange, 1);
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4693,37 +5683,26 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		ComputeNothing3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(RecordTile2DTile2D),
+		static_cast<void*>(&log),
+		kRange, kRange,
+		1, 1,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON | PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-static void CheckUArch3DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+	/* The calling thread owns the range which starts at linear tile 0 */
+	const std::vector<size_t> sequence = ThreadTileSequence(log, std::this_thread::get_id());
+	ASSERT_GE(sequence.size(), 4);
+	EXPECT_EQ(sequence[0], 0 * kRange + 0);
+	EXPECT_EQ(sequence[1], 0 * kRange + 1);
+	EXPECT_EQ(sequence[2], 1 * kRange + 0);
+	EXPECT_EQ(sequence[3], 1 * kRange + 1);
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckUArch3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+TEST(Parallelize2DTile2D, MultiThreadPoolMortonOrderSkipsOutOfRangeQuadrants) {
+	TileOrderLog log(3, 5, 1);
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4731,38 +5710,20 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckUArch3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(RecordTile2DTile2D),
+		static_cast<void*>(&log),
+		3, 5,
+		1, 1,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON | PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-static void CheckBounds3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+	ExpectTileRunsInOrder(log, std::vector<size_t>(kMortonOrder3x5, kMortonOrder3x5 + 15));
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckBounds3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedOnceStaticSchedule) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4770,38 +5731,54 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_STATIC_SCHEDULE);
 
-static void CheckTiling3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckTiling3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4809,51 +5786,67 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		CheckTiling3DTile1DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
+		}
+	}
 }
 
-static void SetTrue3DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void IncrementSame2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(IncrementSame2DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
+static void WorkImbalance2DTile2D(std::atomic_int* num_processed_items, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
+	if (start_i == 0 && start_j == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
+			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -4862,63 +5855,33 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(WorkImbalance2DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 }
 
-static void Increment3DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
+static void ComputeNothing2DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
-		static_cast<void*>(counters.data()),
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing2DTile2DWithUArch,
+		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4926,60 +5889,37 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
-		static_cast<void*>(counters.data()),
+		ComputeNothing2DTile2DWithUArch,
+		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
+static void CheckUArch2DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -4987,39 +5927,38 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
-		}
-	}
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
 }
 
-static void IncrementSame3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void CheckBounds2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_LT(start_i, kParallelize2DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize2DTile2DRangeJ);
+	EXPECT_LE(start_i + tile_i, kParallelize2DTile2DRangeI);
+	EXPECT_LE(start_j + tile_j, kParallelize2DTile2DRangeJ);
 }
 
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds2DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */);
+}
 
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5027,65 +5966,43 @@ TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(IncrementSame3DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
+		CheckBounds2DTile2DWithUArch,
+		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
-}
-
-TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(WorkImbalance3DTile1DWithUArch),
-		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
+static void CheckTiling2DTile2DWithUArch(void*, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	EXPECT_GT(tile_i, 0);
+	EXPECT_LE(tile_i, kParallelize2DTile2DTileI);
+	EXPECT_EQ(start_i % kParallelize2DTile2DTileI, 0);
+	EXPECT_EQ(tile_i, std::min<size_t>(kParallelize2DTile2DTileI, kParallelize2DTile2DRangeI - start_i));
 
-static void ComputeNothing3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize2DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize2DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize2DTile2DTileJ, kParallelize2DTile2DRangeJ - start_j));
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(threadpool.get(),
-		ComputeNothing3DTile1DWithUArchWithThread,
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckTiling2DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5093,76 +6010,52 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		ComputeNothing3DTile1DWithUArchWithThread,
+		CheckTiling2DTile2DWithUArch,
 		nullptr,
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
 }
 
-static void CheckUArch3DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
+static void SetTrue2DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckUArch3DTile1DWithUArchWithThread,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
 	}
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckUArch3DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
-
-static void CheckBounds3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile1DRangeI);
-	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		CheckBounds3DTile1DWithUArchWithThread,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-}
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5170,38 +6063,61 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds3DTile1DWithUArchWithThread,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(SetTrue2DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+				<< "Element (" << i << ", " << j << ") not processed";
+		}
+	}
 }
 
-static void CheckTiling3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+static void Increment2DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArchWithThread,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
+	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5209,51 +6125,55 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckTiling3DTile1DWithUArchWithThread,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-}
 
-static void SetTrue3DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_2d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+			0 /* flags */);
+	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5262,162 +6182,37 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
-		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
-			}
-		}
-	}
-}
-
-static void Increment3DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
-		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-			}
-		}
-	}
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		pthreadpool_parallelize_2d_tile_2d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
+			reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(Increment2DTile2DWithUArch),
 			static_cast<void*>(counters.data()),
 			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
+			kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+			kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize2DTile2DRangeJ; j++) {
+			const size_t linear_idx = i * kParallelize2DTile2DRangeJ + j;
+			EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+				<< "Element (" << i << ", " << j << ") was processed "
+				<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+				<< "(expected: " << kIncrementIterations << ")";
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
-			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-			kParallelize3DTile1DTileK,
-			0 /* flags */);
-	}
-
-	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
-				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
-					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-					<< "(expected: " << kIncrementIterations << ")";
-			}
+static void IncrementSame2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	for (size_t i = start_i; i < start_i + tile_i; i++) {
+		for (size_t j = start_j; j < start_j + tile_j; j++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
 		}
 	}
 }
 
-static void IncrementSame3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5427,28 +6222,28 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(IncrementSame3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(IncrementSame2DTile2DWithUArch),
 		static_cast<void*>(&num_processed_items),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 }
 
-static void WorkImbalance3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0) {
+static void WorkImbalance2DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t start_i, size_t start_j, size_t tile_i, size_t tile_j) {
+	num_processed_items->fetch_add(tile_i * tile_j, std::memory_order_relaxed);
+	if (start_i == 0 && start_j == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
+TEST(Parallelize2DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5458,53 +6253,32 @@ TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+	pthreadpool_parallelize_2d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(WorkImbalance3DTile1DWithUArchWithThread),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_with_id_t>(WorkImbalance2DTile2DWithUArch),
 		static_cast<void*>(&num_processed_items),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
-}
-
-static void SetThreadTrue3DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
-	EXPECT_LE(thread_index, *num_threads);
-}
-
-TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetThreadTrue3DTile1DWithUArchWithThread),
-		static_cast<void*>(&num_threads),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
-		kParallelize3DTile1DTileK,
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 }
 
-static void ComputeNothing3DTile2D(void*, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing3D(void*, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize3D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(threadpool.get(),
-		ComputeNothing3DTile2D,
+	pthreadpool_parallelize_3d(threadpool.get(),
+		ComputeNothing3D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize3D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5512,37 +6286,33 @@ TEST(Parallelize3DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		ComputeNothing3DTile2D,
+		ComputeNothing3D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 }
 
-static void CheckBounds3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
-	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
+static void CheckBounds3D(void*, size_t i, size_t j, size_t k) {
+	EXPECT_LT(i, kParallelize3DRangeI);
+	EXPECT_LT(j, kParallelize3DRangeJ);
+	EXPECT_LT(k, kParallelize3DRangeK);
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		CheckBounds3DTile2D,
+		CheckBounds3D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5550,84 +6320,36 @@ TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		CheckBounds3DTile2D,
+		CheckBounds3D,
 		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
+static void SetTrue3D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k) {
+	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
 
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
-}
-
-TEST(Parallelize3DTile2D, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_2d(
-		threadpool.get(),
-		CheckTiling3DTile2D,
-		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
-
-TEST(Parallelize3DTile2D, MultiThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_2d(
-		threadpool.get(),
-		CheckTiling3DTile2D,
-		nullptr,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
-
-static void SetTrue3DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
-	}
-}
-
-TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -5635,8 +6357,8 @@ TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5645,18 +6367,17 @@ TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(SetTrue3D),
 		static_cast<void*>(indicators.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -5664,33 +6385,28 @@ TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment3DTile2D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void Increment3D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k) {
+	const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -5699,8 +6415,8 @@ TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5709,18 +6425,17 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
 		static_cast<void*>(counters.data()),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -5729,26 +6444,25 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d(
+		pthreadpool_parallelize_3d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-			0 /* flags */);
+			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -5758,8 +6472,8 @@ TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -5769,19 +6483,18 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d(
+		pthreadpool_parallelize_3d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+			reinterpret_cast<pthreadpool_task_3d_t>(Increment3D),
 			static_cast<void*>(counters.data()),
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-			0 /* flags */);
+			kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DRangeJ + j) * kParallelize3DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -5791,15 +6504,11 @@ TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static void IncrementSame3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize3D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5809,27 +6518,26 @@ TEST(Parallelize3DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(IncrementSame3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(IncrementSame3D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 }
 
-static void WorkImbalance3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0 && start_k == 0) {
+static void WorkImbalance3D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -5839,33 +6547,31 @@ TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d(
+	pthreadpool_parallelize_3d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(WorkImbalance3DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_t>(WorkImbalance3D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DRangeI, kParallelize3DRangeJ, kParallelize3DRangeK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DRangeI * kParallelize3DRangeJ * kParallelize3DRangeK);
 }
 
-static void ComputeNothing3DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing3DTile1D(void*, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing3DTile2DWithUArch,
+	pthreadpool_parallelize_3d_tile_1d(threadpool.get(),
+		ComputeNothing3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5873,37 +6579,36 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		ComputeNothing3DTile2DWithUArch,
+		ComputeNothing3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckUArch3DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void CheckBounds3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		CheckUArch3DTile2DWithUArch,
+		CheckBounds3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5911,83 +6616,36 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		CheckUArch3DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
-
-static void CheckBounds3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_LT(i, kParallelize3DTile2DRangeI);
-	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
-	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
-	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
-}
-
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckBounds3DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
-		0 /* flags */);
-}
-
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckBounds3DTile2DWithUArch,
+		CheckBounds3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	EXPECT_GT(tile_j, 0);
-	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
-	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
-	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
-
+static void CheckTiling3DTile1D(void*, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		CheckTiling3DTile2DWithUArch,
+		CheckTiling3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -5995,44 +6653,40 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		CheckTiling3DTile2DWithUArch,
+		CheckTiling3DTile1D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue3DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+static void SetTrue3DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -6040,8 +6694,8 @@ TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6050,19 +6704,18 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(SetTrue3DTile1D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
 					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
@@ -6070,34 +6723,31 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 	}
 }
 
-static void Increment3DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+static void Increment3DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6106,8 +6756,8 @@ TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6116,19 +6766,18 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -6137,27 +6786,26 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		pthreadpool_parallelize_3d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6167,8 +6815,8 @@ TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTime
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+TEST(Parallelize3DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6178,20 +6826,19 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		pthreadpool_parallelize_3d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(Increment3DTile1D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
-				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
 				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
 					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
 					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -6201,15 +6848,13 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 }
 
-static void IncrementSame3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	for (size_t j = start_j; j < start_j + tile_j; j++) {
-		for (size_t k = start_k; k < start_k + tile_k; k++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+static void IncrementSame3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6219,28 +6864,27 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(IncrementSame3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(IncrementSame3DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
-	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
-	if (i == 0 && start_j == 0 && start_k == 0) {
+static void WorkImbalance3DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6250,32 +6894,32 @@ TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(WorkImbalance3DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_t>(WorkImbalance3DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
-		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void ComputeNothing4D(void*, size_t, size_t, size_t, size_t) {
+static void ComputeNothing3DTile1DWithThread(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4D, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(threadpool.get(),
-		ComputeNothing4D,
+	pthreadpool_parallelize_3d_tile_1d_with_thread(threadpool.get(),
+		ComputeNothing3DTile1DWithThread,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4D, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6283,34 +6927,36 @@ TEST(Parallelize4D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		ComputeNothing4D,
+		ComputeNothing3DTile1DWithThread,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds4D(void*, size_t i, size_t j, size_t k, size_t l) {
-	EXPECT_LT(i, kParallelize4DRangeI);
-	EXPECT_LT(j, kParallelize4DRangeJ);
-	EXPECT_LT(k, kParallelize4DRangeK);
-	EXPECT_LT(l, kParallelize4DRangeL);
+static void CheckBounds3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize4D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		CheckBounds4D,
+		CheckBounds3DTile1DWithThread,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6318,47 +6964,86 @@ TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		CheckBounds4D,
+		CheckBounds3DTile1DWithThread,
 		nullptr,
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue4D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l) {
-	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckTiling3DTile1DWithThread(void*, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
 }
 
-TEST(Parallelize4D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckTiling3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		CheckTiling3DTile1DWithThread,
+		nullptr,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void SetTrue3DTile1DWithThread(std::atomic_bool* processed_indicators, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6367,60 +7052,60 @@ TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(SetTrue3DTile1DWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-static void Increment4D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l) {
-	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment3DTile1DWithThread(std::atomic_int* processed_counters, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize4D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6429,59 +7114,57 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d(
+		pthreadpool_parallelize_3d_tile_1d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
-				0 /* flags */);
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6491,34 +7174,35 @@ TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d(
+		pthreadpool_parallelize_3d_tile_1d_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(Increment3DTile1DWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
-				0 /* flags */);
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-static void IncrementSame4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6528,26 +7212,27 @@ TEST(Parallelize4D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(IncrementSame4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(IncrementSame3DTile1DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0) {
+static void WorkImbalance3DTile1DWithThread(std::atomic_int* num_processed_items, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6557,31 +7242,52 @@ TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d(
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_t>(WorkImbalance4D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(WorkImbalance3DTile1DWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void ComputeNothing4DTile1D(void*, size_t, size_t, size_t, size_t, size_t) {
+static void CheckThreadIndexValid3DTile1DWithThread(const size_t* num_threads, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithThread, MultiThreadPoolThreadIndexValid) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_thread(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_thread_t>(CheckThreadIndexValid3DTile1DWithThread),
+		static_cast<void*>(&num_threads),
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void ComputeNothing3DTile1DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(threadpool.get(),
-		ComputeNothing4DTile1D,
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(threadpool.get(),
+		ComputeNothing3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6589,37 +7295,37 @@ TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		ComputeNothing4DTile1D,
+		ComputeNothing3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile1DRangeI);
-	EXPECT_LT(j, kParallelize4DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize4DTile1DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile1DRangeL);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile1DRangeL);
+static void CheckUArch3DTile1DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds4DTile1D,
+		CheckUArch3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6627,36 +7333,38 @@ TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckBounds4DTile1D,
+		CheckUArch3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile1DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile1DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile1DTileL, kParallelize4DTile1DRangeL - start_l));
+static void CheckBounds3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckTiling4DTile1D,
+		CheckBounds3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6664,52 +7372,38 @@ TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		CheckTiling4DTile1D,
+		CheckBounds3DTile1DWithUArch,
 		nullptr,
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-	}
+static void CheckTiling3DTile1DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
-
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		CheckTiling3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
-			}
-		}
-	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
-
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6717,64 +7411,51 @@ TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		CheckTiling3DTile1DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
-			}
-		}
-	}
 }
 
-static void Increment4DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void SetTrue3DTile1DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
-		static_cast<void*>(counters.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6783,61 +7464,123 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(SetTrue3DTile1DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
+			}
+		}
+	}
+}
+
+static void Increment3DTile1DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+TEST(Parallelize3DTile1DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_1d(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-			kParallelize4DTile1DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -6847,37 +7590,36 @@ TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_1d(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(Increment3DTile1DWithUArch),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-			kParallelize4DTile1DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-static void IncrementSame4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	for (size_t l = start_l; l < start_l + tile_l; l++) {
+static void IncrementSame3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
 		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6887,27 +7629,28 @@ TEST(Parallelize4DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(IncrementSame4DTile1D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(IncrementSame3DTile1DWithUArch),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
-	num_processed_items->fetch_add(tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && start_l == 0) {
+static void WorkImbalance3DTile1DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile1DWithUArch, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -6917,32 +7660,34 @@ TEST(Parallelize4DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_1d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(WorkImbalance4DTile1D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_t>(WorkImbalance3DTile1DWithUArch),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
-		kParallelize4DTile1DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void ComputeNothing4DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(threadpool.get(),
-		ComputeNothing4DTile2D,
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(threadpool.get(),
+		ComputeNothing3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6950,38 +7695,37 @@ TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		ComputeNothing4DTile2D,
+		ComputeNothing3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile2DRangeI);
-	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
-	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+static void CheckUArch3DTile1DWithUArchWithThread(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckBounds4DTile2D,
+		CheckUArch3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -6989,41 +7733,77 @@ TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckBounds4DTile2D,
+		CheckUArch3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
+static void CheckBounds3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile1DRangeI);
+	EXPECT_LT(j, kParallelize3DTile1DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile1DRangeK);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile1DRangeK);
+}
 
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckBounds3DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
+		threadpool.get(),
+		CheckBounds3DTile1DWithUArchWithThread,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
+		0 /* flags */);
+}
+
+static void CheckTiling3DTile1DWithUArchWithThread(void*, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile1DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile1DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile1DTileK, kParallelize3DTile1DRangeK - start_k));
+}
+
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling4DTile2D,
+		CheckTiling3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7031,53 +7811,51 @@ TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		CheckTiling4DTile2D,
+		CheckTiling3DTile1DWithUArchWithThread,
 		nullptr,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+static void SetTrue3DTile1DWithUArchWithThread(std::atomic_bool* processed_indicators, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7086,66 +7864,62 @@ TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetTrue3DTile1DWithUArchWithThread),
 		static_cast<void*>(indicators.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-static void Increment4DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+static void Increment3DTile1DWithUArchWithThread(std::atomic_int* processed_counters, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+		const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7154,61 +7928,59 @@ TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 		static_cast<void*>(counters.data()),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7218,39 +7990,36 @@ TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d(
+		pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+			reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(Increment3DTile1DWithUArchWithThread),
 			static_cast<void*>(counters.data()),
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+			kParallelize3DTile1DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile1DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile1DRangeJ + j) * kParallelize3DTile1DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-static void IncrementSame4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+static void IncrementSame3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
 	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7260,27 +8029,28 @@ TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(IncrementSame4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(IncrementSame3DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-static void WorkImbalance4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+static void WorkImbalance3DTile1DWithUArchWithThread(std::atomic_int* num_processed_items, uint32_t, size_t, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	num_processed_items->fetch_add(tile_k, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7290,71 +8060,53 @@ TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(WorkImbalance4DTile2D),
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(WorkImbalance3DTile1DWithUArchWithThread),
 		static_cast<void*>(&num_processed_items),
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
-}
-
-static void ComputeNothing4DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile1DRangeI * kParallelize3DTile1DRangeJ * kParallelize3DTile1DRangeK);
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(threadpool.get(),
-		ComputeNothing4DTile2DWithUArch,
-		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
-		0 /* flags */);
+static void SetThreadTrue3DTile1DWithUArchWithThread(const size_t* num_threads, uint32_t, size_t thread_index, size_t i, size_t j, size_t start_k, size_t tile_k) {
+	EXPECT_LE(thread_index, *num_threads);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile1DWithUArchWithThread, MultiThreadPoolThreadIndexValid) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
+	size_t num_threads = pthreadpool_get_threads_count(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_1d_with_uarch_with_thread(
 		threadpool.get(),
-		ComputeNothing4DTile2DWithUArch,
-		nullptr,
+		reinterpret_cast<pthreadpool_task_3d_tile_1d_with_id_with_thread_t>(SetThreadTrue3DTile1DWithUArchWithThread),
+		static_cast<void*>(&num_threads),
 		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile1DRangeI, kParallelize3DTile1DRangeJ, kParallelize3DTile1DRangeK,
+		kParallelize3DTile1DTileK,
 		0 /* flags */);
 }
 
-static void CheckUArch4DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t, size_t) {
-	if (uarch_index != kDefaultUArchIndex) {
-		EXPECT_LE(uarch_index, kMaxUArchIndex);
-	}
+static void ComputeNothing3DTile2D(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
-		threadpool.get(),
-		CheckUArch4DTile2DWithUArch,
+	pthreadpool_parallelize_3d_tile_2d(threadpool.get(),
+		ComputeNothing3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+TEST(Parallelize3DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7362,40 +8114,37 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckUArch4DTile2DWithUArch,
+		ComputeNothing3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_LT(i, kParallelize4DTile2DRangeI);
-	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
-	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
-	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
-	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+static void CheckBounds3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
+	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckBounds4DTile2DWithUArch,
+		CheckBounds3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7403,43 +8152,41 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckBounds4DTile2DWithUArch,
+		CheckBounds3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckTiling4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	EXPECT_GT(tile_k, 0);
-	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
-	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
-	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
+static void CheckTiling3DTile2D(void*, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
 
-	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckTiling4DTile2DWithUArch,
+		CheckTiling3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+TEST(Parallelize3DTile2D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7447,55 +8194,51 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		CheckTiling4DTile2DWithUArch,
+		CheckTiling3DTile2D,
 		nullptr,
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue4DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+static void SetTrue3DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7504,68 +8247,62 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(SetTrue3DTile2D),
 		static_cast<void*>(indicators.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-static void Increment4DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
-			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+static void Increment3DTile2D(std::atomic_int* processed_counters, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
 			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7574,63 +8311,148 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedOnceMortonOrder) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON);
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
+}
+
+static void RecordTile3DTile2D(TileOrderLog* log, size_t i, size_t start_j, size_t start_k, size_t, size_t) {
+	RecordTile(log, (i * log->range_j + start_j) * log->range_k + start_k);
+}
+
+TEST(Parallelize3DTile2D, MultiThreadPoolMortonOrderStartsWithZ) {
+	const size_t kRange = 16;
+	TileOrderLog log(2, kRange, kRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(RecordTile3DTile2D),
+		static_cast<void*>(&log),
+		2, kRange, kRange,
+		1, 1,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON | PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+	/* The calling thread owns the range which starts at linear tile 0 */
+	const std::vector<size_t> sequence = ThreadTileSequence(log, std::this_thread::get_id());
+	ASSERT_GE(sequence.size(), 4);
+	EXPECT_EQ(sequence[0], 0 * kRange + 0);
+	EXPECT_EQ(sequence[1], 0 * kRange + 1);
+	EXPECT_EQ(sequence[2], 1 * kRange + 0);
+	EXPECT_EQ(sequence[3], 1 * kRange + 1);
+}
+
+TEST(Parallelize3DTile2D, MultiThreadPoolMortonOrderSkipsOutOfRangeQuadrants) {
+	const size_t kRangeI = 3;
+	TileOrderLog log(kRangeI, 3, 5);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(RecordTile3DTile2D),
+		static_cast<void*>(&log),
+		kRangeI, 3, 5,
+		1, 1,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON | PTHREADPOOL_FLAG_STATIC_SCHEDULE);
+
+	/* Every i walks the 3x5 tile grid in Z-order, and runs of tiles may cross from one i to the next */
+	std::vector<size_t> expected_order;
+	for (size_t i = 0; i < kRangeI; i++) {
+		for (size_t jk : kMortonOrder3x5) {
+			expected_order.push_back(i * 15 + jk);
+		}
+	}
+	ExpectTileRunsInOrder(log, expected_order);
+}
+
+TEST(Parallelize3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		pthreadpool_parallelize_3d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+TEST(Parallelize3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7640,40 +8462,37 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
-		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		pthreadpool_parallelize_3d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 			static_cast<void*>(counters.data()),
-			kDefaultUArchIndex, kMaxUArchIndex,
-			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
-					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
-					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
-						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
-						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-						<< "(expected: " << kIncrementIterations << ")";
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
 			}
 		}
 	}
 }
 
-static void IncrementSame4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	for (size_t k = start_k; k < start_k + tile_k; k++) {
-		for (size_t l = start_l; l < start_l + tile_l; l++) {
+static void IncrementSame3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
 			num_processed_items->fetch_add(1, std::memory_order_relaxed);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
+TEST(Parallelize3DTile2D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7683,28 +8502,27 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(IncrementSame4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(IncrementSame3DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void WorkImbalance4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
-	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+static void WorkImbalance3DTile2D(std::atomic_int* num_processed_items, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0 && start_k == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+TEST(Parallelize3DTile2D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -7714,32 +8532,33 @@ TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+	pthreadpool_parallelize_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(WorkImbalance4DTile2DWithUArch),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(WorkImbalance3DTile2D),
 		static_cast<void*>(&num_processed_items),
-		kDefaultUArchIndex, kMaxUArchIndex,
-		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
-		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void ComputeNothing5D(void*, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing3DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize5D, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(threadpool.get(),
-		ComputeNothing5D,
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing3DTile2DWithUArch,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize5D, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7747,35 +8566,37 @@ TEST(Parallelize5D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		ComputeNothing5D,
+		ComputeNothing3DTile2DWithUArch,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void CheckBounds5D(void*, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	EXPECT_LT(i, kParallelize5DRangeI);
-	EXPECT_LT(j, kParallelize5DRangeJ);
-	EXPECT_LT(k, kParallelize5DRangeK);
-	EXPECT_LT(l, kParallelize5DRangeL);
-	EXPECT_LT(m, kParallelize5DRangeM);
+static void CheckUArch3DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
 }
 
-TEST(Parallelize5D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds5D,
+		CheckUArch3DTile2DWithUArch,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7783,50 +8604,39 @@ TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds5D,
+		CheckUArch3DTile2DWithUArch,
 		nullptr,
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
 }
 
-static void SetTrue5D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckBounds3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_LT(i, kParallelize3DTile2DRangeI);
+	EXPECT_LT(start_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize3DTile2DRangeK);
+	EXPECT_LE(start_j + tile_j, kParallelize3DTile2DRangeJ);
+	EXPECT_LE(start_k + tile_k, kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize5D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
-		static_cast<void*>(indicators.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		CheckBounds3DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
-				}
-			}
-		}
-	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7834,65 +8644,43 @@ TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
-		static_cast<void*>(indicators.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		CheckBounds3DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
-				}
-			}
-		}
-	}
 }
 
-static void Increment5D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-}
+static void CheckTiling3DTile2DWithUArch(void*, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	EXPECT_GT(tile_j, 0);
+	EXPECT_LE(tile_j, kParallelize3DTile2DTileJ);
+	EXPECT_EQ(start_j % kParallelize3DTile2DTileJ, 0);
+	EXPECT_EQ(tile_j, std::min<size_t>(kParallelize3DTile2DTileJ, kParallelize3DTile2DRangeJ - start_j));
 
-TEST(Parallelize5D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize3DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize3DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize3DTile2DTileK, kParallelize3DTile2DRangeK - start_k));
+}
 
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
-		static_cast<void*>(counters.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		CheckTiling3DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
-				}
-			}
-		}
-	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -7900,63 +8688,53 @@ TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
-		static_cast<void*>(counters.data()),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		CheckTiling3DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
-				}
-			}
+static void SetTrue3DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 		}
 	}
 }
 
-TEST(Parallelize5D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
-			static_cast<void*>(counters.data()),
-			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
-				0 /* flags */);
-	}
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -7965,67 +8743,64 @@ TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
-			static_cast<void*>(counters.data()),
-			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
-				0 /* flags */);
-	}
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(SetTrue3DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
-				}
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+					<< "Element (" << i << ", " << j << ", " << k << ") not processed";
 			}
 		}
 	}
 }
 
-static void IncrementSame5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void Increment3DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(IncrementSame5D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-}
 
-static void WorkImbalance5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
 		}
 	}
 }
 
-TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8034,31 +8809,60 @@ TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_t>(WorkImbalance5D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
-}
 
-static void ComputeNothing5DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+			}
+		}
+	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolCompletes) {
+TEST(Parallelize3DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(threadpool.get(),
-		ComputeNothing5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8066,38 +8870,72 @@ TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
-		threadpool.get(),
-		ComputeNothing5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
-		0 /* flags */);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_3d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(Increment3DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+			kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize3DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize3DTile2DRangeK; k++) {
+				const size_t linear_idx = (i * kParallelize3DTile2DRangeJ + j) * kParallelize3DTile2DRangeK + k;
+				EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+					<< "Element (" << i << ", " << j << ", " << k << ") was processed "
+					<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+					<< "(expected: " << kIncrementIterations << ")";
+			}
+		}
+	}
 }
 
-static void CheckBounds5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	EXPECT_LT(i, kParallelize5DTile1DRangeI);
-	EXPECT_LT(j, kParallelize5DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize5DTile1DRangeK);
-	EXPECT_LT(l, kParallelize5DTile1DRangeL);
-	EXPECT_LT(start_m, kParallelize5DTile1DRangeM);
-	EXPECT_LE(start_m + tile_m, kParallelize5DTile1DRangeM);
+static void IncrementSame3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	for (size_t j = start_j; j < start_j + tile_j; j++) {
+		for (size_t k = start_k; k < start_k + tile_k; k++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(IncrementSame3DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
+static void WorkImbalance3DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t start_j, size_t start_k, size_t tile_j, size_t tile_k) {
+	num_processed_items->fetch_add(tile_j * tile_k, std::memory_order_relaxed);
+	if (i == 0 && start_j == 0 && start_k == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize3DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8105,36 +8943,32 @@ TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_3d_tile_2d_with_uarch(
 		threadpool.get(),
-		CheckBounds5DTile1D,
-		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_with_id_t>(WorkImbalance3DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
 		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 }
 
-static void CheckTiling5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize5DTile1DTileM);
-	EXPECT_EQ(start_m % kParallelize5DTile1DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile1DTileM, kParallelize5DTile1DRangeM - start_m));
+static void ComputeNothing4D(void*, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize4D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
-		threadpool.get(),
-		CheckTiling5DTile1D,
+	pthreadpool_parallelize_4d(threadpool.get(),
+		ComputeNothing4D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize4D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8142,54 +8976,34 @@ TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		CheckTiling5DTile1D,
+		ComputeNothing4D,
 		nullptr,
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 }
 
-static void SetTrue5DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-	}
+static void CheckBounds4D(void*, size_t i, size_t j, size_t k, size_t l) {
+	EXPECT_LT(i, kParallelize4DRangeI);
+	EXPECT_LT(j, kParallelize4DRangeJ);
+	EXPECT_LT(k, kParallelize4DRangeK);
+	EXPECT_LT(l, kParallelize4DRangeL);
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
-
+TEST(Parallelize4D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		CheckBounds4D,
+		nullptr,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
-				}
-			}
-		}
-	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
-
+TEST(Parallelize4D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8197,68 +9011,109 @@ TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		CheckBounds4D,
+		nullptr,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
+}
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
+static void SetTrue4D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l) {
+	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
+
+TEST(Parallelize4D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
+		static_cast<void*>(indicators.data()),
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
 			}
 		}
 	}
 }
 
-static void Increment5DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+TEST(Parallelize4D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_t>(SetTrue4D),
+		static_cast<void*>(indicators.data()),
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
+			}
+		}
 	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+static void Increment4D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l) {
+	const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize4D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize4D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8267,65 +9122,59 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize4D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-			kParallelize5DTile1DTileM,
-			0 /* flags */);
+			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+TEST(Parallelize4D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8334,40 +9183,35 @@ TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_1d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			reinterpret_cast<pthreadpool_task_4d_t>(Increment4D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-			kParallelize5DTile1DTileM,
-			0 /* flags */);
+			kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
+				0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
+	for (size_t i = 0; i < kParallelize4DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DRangeJ + j) * kParallelize4DRangeK + k) * kParallelize4DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
 				}
 			}
 		}
 	}
 }
 
-static void IncrementSame5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	}
+static void IncrementSame4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
+TEST(Parallelize4D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8377,27 +9221,26 @@ TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(IncrementSame5DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_t>(IncrementSame4D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 }
 
-static void WorkImbalance5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
-	num_processed_items->fetch_add(tile_m, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0) {
+static void WorkImbalance4D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize4D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8407,32 +9250,31 @@ TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_1d(
+	pthreadpool_parallelize_4d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(WorkImbalance5DTile1D),
+		reinterpret_cast<pthreadpool_task_4d_t>(WorkImbalance4D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
-		kParallelize5DTile1DTileM,
+		kParallelize4DRangeI, kParallelize4DRangeJ, kParallelize4DRangeK, kParallelize4DRangeL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DRangeI * kParallelize4DRangeJ * kParallelize4DRangeK * kParallelize4DRangeL);
 }
 
-static void ComputeNothing5DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing4DTile1D(void*, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolCompletes) {
+TEST(Parallelize4DTile1D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(threadpool.get(),
-		ComputeNothing5DTile2D,
+	pthreadpool_parallelize_4d_tile_1d(threadpool.get(),
+		ComputeNothing4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
+TEST(Parallelize4DTile1D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8440,39 +9282,37 @@ TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		ComputeNothing5DTile2D,
+		ComputeNothing4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void CheckBounds5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	EXPECT_LT(i, kParallelize5DTile2DRangeI);
-	EXPECT_LT(j, kParallelize5DTile2DRangeJ);
-	EXPECT_LT(k, kParallelize5DTile2DRangeK);
-	EXPECT_LT(start_l, kParallelize5DTile2DRangeL);
-	EXPECT_LT(start_m, kParallelize5DTile2DRangeM);
-	EXPECT_LE(start_l + tile_l, kParallelize5DTile2DRangeL);
-	EXPECT_LE(start_m + tile_m, kParallelize5DTile2DRangeM);
+static void CheckBounds4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile1DRangeI);
+	EXPECT_LT(j, kParallelize4DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize4DTile1DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile1DRangeL);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile1DRangeL);
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckBounds5DTile2D,
+		CheckBounds4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8480,41 +9320,36 @@ TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckBounds5DTile2D,
+		CheckBounds4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void CheckTiling5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+static void CheckTiling4DTile1D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
 	EXPECT_GT(tile_l, 0);
-	EXPECT_LE(tile_l, kParallelize5DTile2DTileL);
-	EXPECT_EQ(start_l % kParallelize5DTile2DTileL, 0);
-	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize5DTile2DTileL, kParallelize5DTile2DRangeL - start_l));
-
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize5DTile2DTileM);
-	EXPECT_EQ(start_m % kParallelize5DTile2DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile2DTileM, kParallelize5DTile2DRangeM - start_m));
+	EXPECT_LE(tile_l, kParallelize4DTile1DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile1DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile1DTileL, kParallelize4DTile1DRangeL - start_l));
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolUniformTiling) {
+TEST(Parallelize4DTile1D, SingleThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckTiling5DTile2D,
+		CheckTiling4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
+TEST(Parallelize4DTile1D, MultiThreadPoolUniformTiling) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8522,55 +9357,51 @@ TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		CheckTiling5DTile2D,
+		CheckTiling4DTile1D,
 		nullptr,
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 }
 
-static void SetTrue5DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+static void SetTrue4DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
 	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8579,70 +9410,64 @@ TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(SetTrue4DTile1D),
 		static_cast<void*>(indicators.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
-					}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
 			}
 		}
 	}
 }
 
-static void Increment5DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+static void Increment4DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
 	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
+		const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8651,65 +9476,61 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 		static_cast<void*>(counters.data()),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-					}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_2d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+			kParallelize4DTile1DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+TEST(Parallelize4DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8718,42 +9539,38 @@ TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
-		pthreadpool_parallelize_5d_tile_2d(
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_1d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(Increment4DTile1D),
 			static_cast<void*>(counters.data()),
-			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+			kParallelize4DTile1DTileL,
 			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
-						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
-						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
-							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
-							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-							<< "(expected: " << kIncrementIterations5D << ")";
-					}
-				}
-			}
+	for (size_t i = 0; i < kParallelize4DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile1DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile1DRangeJ + j) * kParallelize4DTile1DRangeK + k) * kParallelize4DTile1DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
 		}
 	}
 }
 
-static void IncrementSame5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+static void IncrementSame4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
 	for (size_t l = start_l; l < start_l + tile_l; l++) {
-		for (size_t m = start_m; m < start_m + tile_m; m++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
-		}
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
+TEST(Parallelize4DTile1D, MultiThreadPoolHighContention) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8763,27 +9580,27 @@ TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(IncrementSame5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(IncrementSame4DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 }
 
-static void WorkImbalance5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
-	num_processed_items->fetch_add(tile_l * tile_m, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && start_l == 0 && start_m == 0) {
+static void WorkImbalance4DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t tile_l) {
+	num_processed_items->fetch_add(tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && start_l == 0) {
 		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM) {
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL) {
 			std::atomic_thread_fence(std::memory_order_acquire);
 		}
 	}
 }
 
-TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
+TEST(Parallelize4DTile1D, MultiThreadPoolWorkStealing) {
 	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
@@ -8793,31 +9610,32 @@ TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_5d_tile_2d(
+	pthreadpool_parallelize_4d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(WorkImbalance5DTile2D),
+		reinterpret_cast<pthreadpool_task_4d_tile_1d_t>(WorkImbalance4DTile1D),
 		static_cast<void*>(&num_processed_items),
-		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
-		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		kParallelize4DTile1DRangeI, kParallelize4DTile1DRangeJ, kParallelize4DTile1DRangeK, kParallelize4DTile1DRangeL,
+		kParallelize4DTile1DTileL,
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile1DRangeI * kParallelize4DTile1DRangeJ * kParallelize4DTile1DRangeK * kParallelize4DTile1DRangeL);
 }
 
-static void ComputeNothing6D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+static void ComputeNothing4DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
 }
 
-TEST(Parallelize6D, SingleThreadPoolCompletes) {
+TEST(Parallelize4DTile2D, SingleThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(threadpool.get(),
-		ComputeNothing6D,
+	pthreadpool_parallelize_4d_tile_2d(threadpool.get(),
+		ComputeNothing4DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize6D, MultiThreadPoolCompletes) {
+TEST(Parallelize4DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8825,36 +9643,38 @@ TEST(Parallelize6D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		ComputeNothing6D,
+		ComputeNothing4DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void CheckBounds6D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	EXPECT_LT(i, kParallelize6DRangeI);
-	EXPECT_LT(j, kParallelize6DRangeJ);
-	EXPECT_LT(k, kParallelize6DRangeK);
-	EXPECT_LT(l, kParallelize6DRangeL);
-	EXPECT_LT(m, kParallelize6DRangeM);
-	EXPECT_LT(n, kParallelize6DRangeN);
+static void CheckBounds4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile2DRangeI);
+	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
+	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
 }
 
-TEST(Parallelize6D, SingleThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		CheckBounds6D,
+		CheckBounds4DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
+TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsInBounds) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -8862,51 +9682,95 @@ TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		CheckBounds6D,
+		CheckBounds4DTile2D,
 		nullptr,
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 }
 
-static void SetTrue6D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+static void CheckTiling4DTile2D(void*, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
+
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
 }
 
-TEST(Parallelize6D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize4DTile2D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		CheckTiling4DTile2D,
+		nullptr,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		CheckTiling4DTile2D,
+		nullptr,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void SetTrue4DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize4DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8915,68 +9779,2037 @@ TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(SetTrue4DTile2D),
 		static_cast<void*>(indicators.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
 				}
 			}
 		}
 	}
 }
 
-static void Increment6D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+static void Increment4DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
 }
 
-TEST(Parallelize6D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d(
+	pthreadpool_parallelize_4d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
 				}
 			}
 		}
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(Increment4DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(IncrementSame4DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+}
+
+static void WorkImbalance4DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_t>(WorkImbalance4DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+}
+
+static void ComputeNothing4DTile2DWithUArch(void*, uint32_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(threadpool.get(),
+		ComputeNothing4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		ComputeNothing4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void CheckUArch4DTile2DWithUArch(void*, uint32_t uarch_index, size_t, size_t, size_t, size_t, size_t, size_t) {
+	if (uarch_index != kDefaultUArchIndex) {
+		EXPECT_LE(uarch_index, kMaxUArchIndex);
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUArchInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckUArch4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void CheckBounds4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_LT(i, kParallelize4DTile2DRangeI);
+	EXPECT_LT(j, kParallelize4DTile2DRangeJ);
+	EXPECT_LT(start_k, kParallelize4DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize4DTile2DRangeL);
+	EXPECT_LE(start_k + tile_k, kParallelize4DTile2DRangeK);
+	EXPECT_LE(start_l + tile_l, kParallelize4DTile2DRangeL);
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckBounds4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void CheckTiling4DTile2DWithUArch(void*, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	EXPECT_GT(tile_k, 0);
+	EXPECT_LE(tile_k, kParallelize4DTile2DTileK);
+	EXPECT_EQ(start_k % kParallelize4DTile2DTileK, 0);
+	EXPECT_EQ(tile_k, std::min<size_t>(kParallelize4DTile2DTileK, kParallelize4DTile2DRangeK - start_k));
+
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize4DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize4DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize4DTile2DTileL, kParallelize4DTile2DRangeL - start_l));
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckTiling4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		CheckTiling4DTile2DWithUArch,
+		nullptr,
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+}
+
+static void SetTrue4DTile2DWithUArch(std::atomic_bool* processed_indicators, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(SetTrue4DTile2DWithUArch),
+		static_cast<void*>(indicators.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") not processed";
+				}
+			}
+		}
+	}
+}
+
+static void Increment4DTile2DWithUArch(std::atomic_int* processed_counters, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+		static_cast<void*>(counters.data()),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_parallelize_4d_tile_2d_with_uarch(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(Increment4DTile2DWithUArch),
+			static_cast<void*>(counters.data()),
+			kDefaultUArchIndex, kMaxUArchIndex,
+			kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+			kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize4DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize4DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize4DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize4DTile2DRangeL; l++) {
+					const size_t linear_idx = ((i * kParallelize4DTile2DRangeJ + j) * kParallelize4DTile2DRangeK + k) * kParallelize4DTile2DRangeL + l;
+					EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations)
+						<< "Element (" << i << ", " << j << ", " << k << ", " << l << ") was processed "
+						<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+						<< "(expected: " << kIncrementIterations << ")";
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	for (size_t k = start_k; k < start_k + tile_k; k++) {
+		for (size_t l = start_l; l < start_l + tile_l; l++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(IncrementSame4DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+}
+
+static void WorkImbalance4DTile2DWithUArch(std::atomic_int* num_processed_items, uint32_t, size_t i, size_t j, size_t start_k, size_t start_l, size_t tile_k, size_t tile_l) {
+	num_processed_items->fetch_add(tile_k * tile_l, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && start_k == 0 && start_l == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize4DTile2DWithUArch, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_4d_tile_2d_with_uarch(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_4d_tile_2d_with_id_t>(WorkImbalance4DTile2DWithUArch),
+		static_cast<void*>(&num_processed_items),
+		kDefaultUArchIndex, kMaxUArchIndex,
+		kParallelize4DTile2DRangeI, kParallelize4DTile2DRangeJ, kParallelize4DTile2DRangeK, kParallelize4DTile2DRangeL,
+		kParallelize4DTile2DTileK, kParallelize4DTile2DTileL,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize4DTile2DRangeI * kParallelize4DTile2DRangeJ * kParallelize4DTile2DRangeK * kParallelize4DTile2DRangeL);
+}
+
+static void ComputeNothing5D(void*, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize5D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d(threadpool.get(),
+		ComputeNothing5D,
+		nullptr,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		ComputeNothing5D,
+		nullptr,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+}
+
+static void CheckBounds5D(void*, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	EXPECT_LT(i, kParallelize5DRangeI);
+	EXPECT_LT(j, kParallelize5DRangeJ);
+	EXPECT_LT(k, kParallelize5DRangeK);
+	EXPECT_LT(l, kParallelize5DRangeL);
+	EXPECT_LT(m, kParallelize5DRangeM);
+}
+
+TEST(Parallelize5D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		CheckBounds5D,
+		nullptr,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		CheckBounds5D,
+		nullptr,
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+}
+
+static void SetTrue5D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
+
+TEST(Parallelize5D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(SetTrue5D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment5D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize5D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_t>(Increment5D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DRangeJ + j) * kParallelize5DRangeK + k) * kParallelize5DRangeL + l) * kParallelize5DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize5D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(IncrementSame5D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+}
+
+static void WorkImbalance5D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize5D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_t>(WorkImbalance5D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DRangeI, kParallelize5DRangeJ, kParallelize5DRangeK, kParallelize5DRangeL, kParallelize5DRangeM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DRangeI * kParallelize5DRangeJ * kParallelize5DRangeK * kParallelize5DRangeL * kParallelize5DRangeM);
+}
+
+static void ComputeNothing5DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_1d(threadpool.get(),
+		ComputeNothing5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		ComputeNothing5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+static void CheckBounds5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	EXPECT_LT(i, kParallelize5DTile1DRangeI);
+	EXPECT_LT(j, kParallelize5DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize5DTile1DRangeK);
+	EXPECT_LT(l, kParallelize5DTile1DRangeL);
+	EXPECT_LT(start_m, kParallelize5DTile1DRangeM);
+	EXPECT_LE(start_m + tile_m, kParallelize5DTile1DRangeM);
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		CheckBounds5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		CheckBounds5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+static void CheckTiling5DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize5DTile1DTileM);
+	EXPECT_EQ(start_m % kParallelize5DTile1DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile1DTileM, kParallelize5DTile1DRangeM - start_m));
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		CheckTiling5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		CheckTiling5DTile1D,
+		nullptr,
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+}
+
+static void SetTrue5DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(SetTrue5DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment5DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+			kParallelize5DTile1DTileM,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(Increment5DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+			kParallelize5DTile1DTileM,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile1DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile1DRangeJ + j) * kParallelize5DTile1DRangeK + k) * kParallelize5DTile1DRangeL + l) * kParallelize5DTile1DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(IncrementSame5DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+}
+
+static void WorkImbalance5DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t tile_m) {
+	num_processed_items->fetch_add(tile_m, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize5DTile1D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_1d_t>(WorkImbalance5DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DTile1DRangeI, kParallelize5DTile1DRangeJ, kParallelize5DTile1DRangeK, kParallelize5DTile1DRangeL, kParallelize5DTile1DRangeM,
+		kParallelize5DTile1DTileM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile1DRangeI * kParallelize5DTile1DRangeJ * kParallelize5DTile1DRangeK * kParallelize5DTile1DRangeL * kParallelize5DTile1DRangeM);
+}
+
+static void ComputeNothing5DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(threadpool.get(),
+		ComputeNothing5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		ComputeNothing5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+static void CheckBounds5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	EXPECT_LT(i, kParallelize5DTile2DRangeI);
+	EXPECT_LT(j, kParallelize5DTile2DRangeJ);
+	EXPECT_LT(k, kParallelize5DTile2DRangeK);
+	EXPECT_LT(start_l, kParallelize5DTile2DRangeL);
+	EXPECT_LT(start_m, kParallelize5DTile2DRangeM);
+	EXPECT_LE(start_l + tile_l, kParallelize5DTile2DRangeL);
+	EXPECT_LE(start_m + tile_m, kParallelize5DTile2DRangeM);
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		CheckBounds5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		CheckBounds5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+static void CheckTiling5DTile2D(void*, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	EXPECT_GT(tile_l, 0);
+	EXPECT_LE(tile_l, kParallelize5DTile2DTileL);
+	EXPECT_EQ(start_l % kParallelize5DTile2DTileL, 0);
+	EXPECT_EQ(tile_l, std::min<size_t>(kParallelize5DTile2DTileL, kParallelize5DTile2DRangeL - start_l));
+
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize5DTile2DTileM);
+	EXPECT_EQ(start_m % kParallelize5DTile2DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize5DTile2DTileM, kParallelize5DTile2DRangeM - start_m));
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		CheckTiling5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		CheckTiling5DTile2D,
+		nullptr,
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+}
+
+static void SetTrue5DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(SetTrue5DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") not processed";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment5DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations5D; iteration++) {
+		pthreadpool_parallelize_5d_tile_2d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(Increment5DTile2D),
+			static_cast<void*>(counters.data()),
+			kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+			kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize5DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize5DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize5DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize5DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize5DTile2DRangeM; m++) {
+						const size_t linear_idx = (((i * kParallelize5DTile2DRangeJ + j) * kParallelize5DTile2DRangeK + k) * kParallelize5DTile2DRangeL + l) * kParallelize5DTile2DRangeM + m;
+						EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations5D)
+							<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ") was processed "
+							<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+							<< "(expected: " << kIncrementIterations5D << ")";
+					}
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	for (size_t l = start_l; l < start_l + tile_l; l++) {
+		for (size_t m = start_m; m < start_m + tile_m; m++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(IncrementSame5DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+}
+
+static void WorkImbalance5DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t start_l, size_t start_m, size_t tile_l, size_t tile_m) {
+	num_processed_items->fetch_add(tile_l * tile_m, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && start_l == 0 && start_m == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize5DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_5d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_5d_tile_2d_t>(WorkImbalance5DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize5DTile2DRangeI, kParallelize5DTile2DRangeJ, kParallelize5DTile2DRangeK, kParallelize5DTile2DRangeL, kParallelize5DTile2DRangeM,
+		kParallelize5DTile2DTileL, kParallelize5DTile2DTileM,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize5DTile2DRangeI * kParallelize5DTile2DRangeJ * kParallelize5DTile2DRangeK * kParallelize5DTile2DRangeL * kParallelize5DTile2DRangeM);
+}
+
+static void ComputeNothing6D(void*, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize6D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d(threadpool.get(),
+		ComputeNothing6D,
+		nullptr,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		ComputeNothing6D,
+		nullptr,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+}
+
+static void CheckBounds6D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	EXPECT_LT(i, kParallelize6DRangeI);
+	EXPECT_LT(j, kParallelize6DRangeJ);
+	EXPECT_LT(k, kParallelize6DRangeK);
+	EXPECT_LT(l, kParallelize6DRangeL);
+	EXPECT_LT(m, kParallelize6DRangeM);
+	EXPECT_LT(n, kParallelize6DRangeN);
+}
+
+TEST(Parallelize6D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		CheckBounds6D,
+		nullptr,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		CheckBounds6D,
+		nullptr,
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+}
+
+static void SetTrue6D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+}
+
+TEST(Parallelize6D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_t>(SetTrue6D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment6D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize6D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			static_cast<void*>(counters.data()),
+			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			static_cast<void*>(counters.data()),
+			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+				0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+}
+
+TEST(Parallelize6D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_t>(IncrementSame6D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+}
+
+static void WorkImbalance6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
+	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && n == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -8987,18 +11820,656 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
 
 	pthreadpool_parallelize_6d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+		reinterpret_cast<pthreadpool_task_6d_t>(WorkImbalance6D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+}
+
+static void ComputeNothing6DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_1d(threadpool.get(),
+		ComputeNothing6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		ComputeNothing6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+static void CheckBounds6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	EXPECT_LT(i, kParallelize6DTile1DRangeI);
+	EXPECT_LT(j, kParallelize6DTile1DRangeJ);
+	EXPECT_LT(k, kParallelize6DTile1DRangeK);
+	EXPECT_LT(l, kParallelize6DTile1DRangeL);
+	EXPECT_LT(m, kParallelize6DTile1DRangeM);
+	EXPECT_LT(start_n, kParallelize6DTile1DRangeN);
+	EXPECT_LE(start_n + tile_n, kParallelize6DTile1DRangeN);
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		CheckBounds6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		CheckBounds6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+static void CheckTiling6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	EXPECT_GT(tile_n, 0);
+	EXPECT_LE(tile_n, kParallelize6DTile1DTileN);
+	EXPECT_EQ(start_n % kParallelize6DTile1DTileN, 0);
+	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile1DTileN, kParallelize6DTile1DRangeN - start_n));
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		CheckTiling6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		CheckTiling6DTile1D,
+		nullptr,
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+}
+
+static void SetTrue6DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment6DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+			kParallelize6DTile1DTileN,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
+		pthreadpool_parallelize_6d_tile_1d(
+			threadpool.get(),
+			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+			static_cast<void*>(counters.data()),
+			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+			kParallelize6DTile1DTileN,
+			0 /* flags */);
+	}
+
+	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
+								<< "(expected: " << kIncrementIterations6D << ")";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void IncrementSame6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	for (size_t n = start_n; n < start_n + tile_n; n++) {
+		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(IncrementSame6DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+}
+
+static void WorkImbalance6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
+	num_processed_items->fetch_add(tile_n, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && start_n == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(WorkImbalance6DTile1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
+		kParallelize6DTile1DTileN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+}
+
+static void ComputeNothing6DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(threadpool.get(),
+		ComputeNothing6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		ComputeNothing6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+static void CheckBounds6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	EXPECT_LT(i, kParallelize6DTile2DRangeI);
+	EXPECT_LT(j, kParallelize6DTile2DRangeJ);
+	EXPECT_LT(k, kParallelize6DTile2DRangeK);
+	EXPECT_LT(l, kParallelize6DTile2DRangeL);
+	EXPECT_LT(start_m, kParallelize6DTile2DRangeM);
+	EXPECT_LT(start_n, kParallelize6DTile2DRangeN);
+	EXPECT_LE(start_m + tile_m, kParallelize6DTile2DRangeM);
+	EXPECT_LE(start_n + tile_n, kParallelize6DTile2DRangeN);
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckBounds6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckBounds6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+static void CheckTiling6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	EXPECT_GT(tile_m, 0);
+	EXPECT_LE(tile_m, kParallelize6DTile2DTileM);
+	EXPECT_EQ(start_m % kParallelize6DTile2DTileM, 0);
+	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize6DTile2DTileM, kParallelize6DTile2DRangeM - start_m));
+
+	EXPECT_GT(tile_n, 0);
+	EXPECT_LE(tile_n, kParallelize6DTile2DTileN);
+	EXPECT_EQ(start_n % kParallelize6DTile2DTileN, 0);
+	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile2DTileN, kParallelize6DTile2DRangeN - start_n));
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckTiling6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolUniformTiling) {
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		CheckTiling6DTile2D,
+		nullptr,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+}
+
+static void SetTrue6DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
+	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
+		static_cast<void*>(indicators.data()),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+static void Increment6DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
+							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
+								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
+								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
@@ -9010,28 +12481,29 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedOnce) {
 	}
 }
 
-TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
 	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d(
+		pthreadpool_parallelize_6d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-				0 /* flags */);
+			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -9044,8 +12516,8 @@ TEST(Parallelize6D, SingleThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
+TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9055,21 +12527,22 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 
 	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d(
+		pthreadpool_parallelize_6d_tile_2d(
 			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_t>(Increment6D),
+			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
 			static_cast<void*>(counters.data()),
-			kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-				0 /* flags */);
+			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+			0 /* flags */);
 	}
 
-	for (size_t i = 0; i < kParallelize6DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DRangeJ + j) * kParallelize6DRangeK + k) * kParallelize6DRangeL + l) * kParallelize6DRangeM + m) * kParallelize6DRangeN + n;
+	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
+		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
+			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
+				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
+					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
+						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
+							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
 							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
 								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
 								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
@@ -9082,12 +12555,292 @@ TEST(Parallelize6D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 	}
 }
 
-static void IncrementSame6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void IncrementSame6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	for (size_t m = start_m; m < start_m + tile_m; m++) {
+		for (size_t n = start_n; n < start_n + tile_n; n++) {
+			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolHighContention) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(IncrementSame6DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+}
+
+static void WorkImbalance6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
+	num_processed_items->fetch_add(tile_m * tile_n, std::memory_order_relaxed);
+	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0 && start_n == 0) {
+		/* Spin-wait until all items are computed */
+		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN) {
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+	}
+}
+
+TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_parallelize_6d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(WorkImbalance6DTile2D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
+		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		0 /* flags */);
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+}
+
+TEST(Plan1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1D, NullThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		nullptr,
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1D, MultiThreadPoolWorkStealing) {
+	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(WorkImbalance1D),
+		static_cast<void*>(&num_processed_items),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	pthreadpool_run_plan(plan.get());
+	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize1DRange);
+}
+
+TEST(Plan1D, MultiThreadPoolMaxThreadsEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 2) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+	pthreadpool_set_plan_max_threads(plan.get(), 2);
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1D, MultiThreadPoolMaxThreadsLimitsThreads) {
+	std::vector<std::thread::id> threads(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 2) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(RecordThread1D),
+		static_cast<void*>(threads.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	pthreadpool_set_plan_max_threads(plan.get(), 2);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+		EXPECT_LE(CountDistinctThreads(threads), 2);
+	}
+
+	pthreadpool_set_plan_max_threads(plan.get(), 1);
+	pthreadpool_run_plan(plan.get());
+	EXPECT_EQ(CountDistinctThreads(threads), 1);
+	EXPECT_EQ(threads[0], std::this_thread::get_id());
+}
+
+TEST(Plan1D, MultiThreadPoolMaxThreadsInBatch) {
+	std::vector<std::thread::id> threads(kParallelize1DRange);
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 2) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t record_plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(RecordThread1D),
+		static_cast<void*>(threads.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	auto_pthreadpool_plan_t increment_plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(record_plan.get() && increment_plan.get());
+	pthreadpool_set_plan_max_threads(record_plan.get(), 2);
+
+	const pthreadpool_plan_t plans[] = { increment_plan.get(), record_plan.get(), increment_plan.get() };
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_batch(threadpool.get(), plans, 3);
+		EXPECT_LE(CountDistinctThreads(threads), 2);
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), 2 * kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << 2 * kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1D, MultiThreadPoolAdaptiveThreadsEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_t>(Increment1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_ADAPTIVE_THREADS), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Plan1D, MultiThreadPoolAdaptiveThreadsCheapItemsRunOnCallingThread) {
+	std::vector<std::thread::id> threads(kParallelize1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9096,27 +12849,52 @@ TEST(Parallelize6D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(IncrementSame6D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
-}
+		reinterpret_cast<pthreadpool_task_1d_t>(RecordThread1D),
+		static_cast<void*>(threads.data()),
+		kParallelize1DRange,
+		PTHREADPOOL_FLAG_ADAPTIVE_THREADS), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void WorkImbalance6D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t n) {
-	num_processed_items->fetch_add(1, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && n == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN) {
-			std::atomic_thread_fence(std::memory_order_acquire);
+	/* Waking up workers costs more than the whole computation, so once the item cost is learned most runs are serial */
+	size_t serial_runs = 0;
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+		if (CountDistinctThreads(threads) == 1 && threads[0] == std::this_thread::get_id()) {
+			serial_runs += 1;
 		}
 	}
+	EXPECT_GE(serial_runs, kIncrementIterations / 2);
 }
 
-TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Plan1DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
+
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d_tile_1d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
+}
+
+TEST(Plan1DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize1DTile1DRange);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9125,31 +12903,53 @@ TEST(Parallelize6D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_1d_tile_1d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_t>(WorkImbalance6D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DRangeI, kParallelize6DRangeJ, kParallelize6DRangeK, kParallelize6DRangeL, kParallelize6DRangeM, kParallelize6DRangeN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DRangeI * kParallelize6DRangeJ * kParallelize6DRangeK * kParallelize6DRangeL * kParallelize6DRangeM * kParallelize6DRangeN);
-}
+		reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(Increment1DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize1DTile1DRange, kParallelize1DTile1DTile,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void ComputeNothing6DTile1D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize1DTile1DRange; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolCompletes) {
+TEST(Plan2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(threadpool.get(),
-		ComputeNothing6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DRangeI * kParallelize2DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolCompletes) {
+TEST(Plan2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DRangeI * kParallelize2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9157,39 +12957,53 @@ TEST(Parallelize6DTile1D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d(
 		threadpool.get(),
-		ComputeNothing6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_t>(Increment2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DRangeI, kParallelize2DRangeJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void CheckBounds6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	EXPECT_LT(i, kParallelize6DTile1DRangeI);
-	EXPECT_LT(j, kParallelize6DTile1DRangeJ);
-	EXPECT_LT(k, kParallelize6DTile1DRangeK);
-	EXPECT_LT(l, kParallelize6DTile1DRangeL);
-	EXPECT_LT(m, kParallelize6DTile1DRangeM);
-	EXPECT_LT(start_n, kParallelize6DTile1DRangeN);
-	EXPECT_LE(start_n + tile_n, kParallelize6DTile1DRangeN);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DRangeI * kParallelize2DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsInBounds) {
+TEST(Plan2DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsInBounds) {
+TEST(Plan2DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9197,36 +13011,54 @@ TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d_tile_1d(
 		threadpool.get(),
-		CheckBounds6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_1d_t>(Increment2DTile1D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile1DRangeI, kParallelize2DTile1DRangeJ, kParallelize2DTile1DTileJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void CheckTiling6DTile1D(void*, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	EXPECT_GT(tile_n, 0);
-	EXPECT_LE(tile_n, kParallelize6DTile1DTileN);
-	EXPECT_EQ(start_n % kParallelize6DTile1DTileN, 0);
-	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile1DTileN, kParallelize6DTile1DRangeN - start_n));
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile1DRangeI * kParallelize2DTile1DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolUniformTiling) {
+TEST(Plan2DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d_tile_2d(
 		threadpool.get(),
-		CheckTiling6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
+	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolUniformTiling) {
+TEST(Plan2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9234,129 +13066,114 @@ TEST(Parallelize6DTile1D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d_tile_2d(
 		threadpool.get(),
-		CheckTiling6DTile1D,
-		nullptr,
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-}
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-static void SetTrue6DTile1D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-		processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(Plan2DTile2D, MultiThreadPoolEachItemProcessedMultipleTimesMortonOrder) {
+	std::vector<std::atomic_int> counters(kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_2d_tile_2d(
+		threadpool.get(),
+		reinterpret_cast<pthreadpool_task_2d_tile_2d_t>(Increment2DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize2DTile2DRangeI, kParallelize2DTile2DRangeJ,
+		kParallelize2DTile2DTileI, kParallelize2DTile2DTileJ,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
+
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize2DTile2DRangeI * kParallelize2DTile2DRangeJ; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(Plan3DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(SetTrue6DTile1D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
+		static_cast<void*>(counters.data()),
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
 	}
-}
 
-static void Increment6DTile1D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-		processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(Plan3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_1d(
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		0 /* flags */), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(Plan3DTile2D, MultiThreadPoolEachItemProcessedMultipleTimesMortonOrder) {
+	std::vector<std::atomic_int> counters(kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9365,69 +13182,51 @@ TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
+	auto_pthreadpool_plan_t plan(pthreadpool_create_plan_3d_tile_2d(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
+		reinterpret_cast<pthreadpool_task_3d_tile_2d_t>(Increment3DTile2D),
 		static_cast<void*>(counters.data()),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
+		kParallelize3DTile2DRangeI, kParallelize3DTile2DRangeJ, kParallelize3DTile2DRangeK,
+		kParallelize3DTile2DTileJ, kParallelize3DTile2DTileK,
+		PTHREADPOOL_FLAG_TILE_ORDER_MORTON), pthreadpool_destroy_plan);
+	ASSERT_TRUE(plan.get());
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
+	for (size_t iteration = 0; iteration < kIncrementIterations; iteration++) {
+		pthreadpool_run_plan(plan.get());
+	}
+
+	for (size_t i = 0; i < kParallelize3DTile2DRangeI * kParallelize3DTile2DRangeJ * kParallelize3DTile2DRangeK; i++) {
+		EXPECT_EQ(counters[i].load(std::memory_order_relaxed), kIncrementIterations)
+			<< "Element " << i << " was processed " << counters[i].load(std::memory_order_relaxed) << " times "
+			<< "(expected: " << kIncrementIterations << ")";
 	}
 }
 
-TEST(Parallelize6DTile1D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(InclusiveScanU32, SingleThreadPoolComputesPrefixSums) {
+	std::vector<uint32_t> input(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		input[i] = uint32_t(i % 7);
+	}
+	std::vector<uint32_t> output(kScanCount);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-			kParallelize6DTile1DTileN,
-			0 /* flags */);
-	}
+	pthreadpool_inclusive_scan_u32(threadpool.get(), input.data(), output.data(), kScanCount, 0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+	uint32_t sum = 0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		sum += input[i];
+		ASSERT_EQ(output[i], sum) << "at element " << i;
 	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
+TEST(InclusiveScanU32, MultiThreadPoolComputesPrefixSums) {
+	std::vector<uint32_t> input(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		input[i] = uint32_t(i % 7);
+	}
+	std::vector<uint32_t> output(kScanCount);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9436,43 +13235,20 @@ TEST(Parallelize6DTile1D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_1d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(Increment6DTile1D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-			kParallelize6DTile1DTileN,
-			0 /* flags */);
-	}
+	pthreadpool_inclusive_scan_u32(threadpool.get(), input.data(), output.data(), kScanCount, 0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile1DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile1DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile1DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile1DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile1DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile1DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile1DRangeJ + j) * kParallelize6DTile1DRangeK + k) * kParallelize6DTile1DRangeL + l) * kParallelize6DTile1DRangeM + m) * kParallelize6DTile1DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+	uint32_t sum = 0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		sum += input[i];
+		ASSERT_EQ(output[i], sum) << "at element " << i;
 	}
 }
 
-static void IncrementSame6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	for (size_t n = start_n; n < start_n + tile_n; n++) {
-		num_processed_items->fetch_add(1, std::memory_order_relaxed);
+TEST(InclusiveScanU32, MultiThreadPoolComputesPrefixSumsInPlace) {
+	std::vector<uint32_t> data(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		data[i] = uint32_t(i % 7);
 	}
-}
-
-TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9481,28 +13257,20 @@ TEST(Parallelize6DTile1D, MultiThreadPoolHighContention) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(IncrementSame6DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
-}
+	pthreadpool_inclusive_scan_u32(threadpool.get(), data.data(), data.data(), kScanCount, 0 /* flags */);
 
-static void WorkImbalance6DTile1D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t m, size_t start_n, size_t tile_n) {
-	num_processed_items->fetch_add(tile_n, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && m == 0 && start_n == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
+	uint32_t sum = 0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		sum += uint32_t(i % 7);
+		ASSERT_EQ(data[i], sum) << "at element " << i;
 	}
 }
 
-TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(ExclusiveScanU32, MultiThreadPoolComputesPrefixSumsInPlace) {
+	std::vector<uint32_t> data(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		data[i] = uint32_t(i % 7);
+	}
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9511,32 +13279,22 @@ TEST(Parallelize6DTile1D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_1d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_1d_t>(WorkImbalance6DTile1D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile1DRangeI, kParallelize6DTile1DRangeJ, kParallelize6DTile1DRangeK, kParallelize6DTile1DRangeL, kParallelize6DTile1DRangeM, kParallelize6DTile1DRangeN,
-		kParallelize6DTile1DTileN,
-		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile1DRangeI * kParallelize6DTile1DRangeJ * kParallelize6DTile1DRangeK * kParallelize6DTile1DRangeL * kParallelize6DTile1DRangeM * kParallelize6DTile1DRangeN);
-}
+	pthreadpool_exclusive_scan_u32(threadpool.get(), data.data(), data.data(), kScanCount, 0 /* flags */);
 
-static void ComputeNothing6DTile2D(void*, size_t, size_t, size_t, size_t, size_t, size_t, size_t, size_t) {
+	uint32_t sum = 0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		ASSERT_EQ(data[i], sum) << "at element " << i;
+		sum += uint32_t(i % 7);
+	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolCompletes) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_2d(threadpool.get(),
-		ComputeNothing6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-}
+TEST(InclusiveScanU64, MultiThreadPoolComputesPrefixSums) {
+	std::vector<uint64_t> input(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		input[i] = uint64_t(i) << 20;
+	}
+	std::vector<uint64_t> output(kScanCount);
 
-TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9544,40 +13302,46 @@ TEST(Parallelize6DTile2D, MultiThreadPoolCompletes) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		ComputeNothing6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-}
+	pthreadpool_inclusive_scan_u64(threadpool.get(), input.data(), output.data(), kScanCount, 0 /* flags */);
 
-static void CheckBounds6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	EXPECT_LT(i, kParallelize6DTile2DRangeI);
-	EXPECT_LT(j, kParallelize6DTile2DRangeJ);
-	EXPECT_LT(k, kParallelize6DTile2DRangeK);
-	EXPECT_LT(l, kParallelize6DTile2DRangeL);
-	EXPECT_LT(start_m, kParallelize6DTile2DRangeM);
-	EXPECT_LT(start_n, kParallelize6DTile2DRangeN);
-	EXPECT_LE(start_m + tile_m, kParallelize6DTile2DRangeM);
-	EXPECT_LE(start_n + tile_n, kParallelize6DTile2DRangeN);
+	uint64_t sum = 0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		sum += input[i];
+		ASSERT_EQ(output[i], sum) << "at element " << i;
+	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsInBounds) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
+TEST(ExclusiveScanF32, MultiThreadPoolComputesPrefixSums) {
+	/* Sums of small integers are exact in single precision, regardless of the order of additions */
+	std::vector<float> input(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		input[i] = float(i % 3);
+	}
+	std::vector<float> output(kScanCount);
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckBounds6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	ASSERT_TRUE(threadpool.get());
+
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
+	}
+
+	pthreadpool_exclusive_scan_f32(threadpool.get(), input.data(), output.data(), kScanCount, 0 /* flags */);
+
+	float sum = 0.0f;
+	for (size_t i = 0; i < kScanCount; i++) {
+		ASSERT_EQ(output[i], sum) << "at element " << i;
+		sum += input[i];
+	}
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
+TEST(InclusiveScanF64, MultiThreadPoolComputesPrefixSums) {
+	std::vector<double> input(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		input[i] = double(i % 3);
+	}
+	std::vector<double> output(kScanCount);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9585,41 +13349,42 @@ TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsInBounds) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckBounds6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+	pthreadpool_inclusive_scan_f64(threadpool.get(), input.data(), output.data(), kScanCount, 0 /* flags */);
+
+	double sum = 0.0;
+	for (size_t i = 0; i < kScanCount; i++) {
+		sum += input[i];
+		ASSERT_EQ(output[i], sum) << "at element " << i;
+	}
 }
 
-static void CheckTiling6DTile2D(void*, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	EXPECT_GT(tile_m, 0);
-	EXPECT_LE(tile_m, kParallelize6DTile2DTileM);
-	EXPECT_EQ(start_m % kParallelize6DTile2DTileM, 0);
-	EXPECT_EQ(tile_m, std::min<size_t>(kParallelize6DTile2DTileM, kParallelize6DTile2DRangeM - start_m));
+/* 2x2 matrices with wrap-around arithmetic: multiplication is associative, but not commutative */
+struct scan_matrix {
+	uint32_t a, b, c, d;
+};
 
-	EXPECT_GT(tile_n, 0);
-	EXPECT_LE(tile_n, kParallelize6DTile2DTileN);
-	EXPECT_EQ(start_n % kParallelize6DTile2DTileN, 0);
-	EXPECT_EQ(tile_n, std::min<size_t>(kParallelize6DTile2DTileN, kParallelize6DTile2DRangeN - start_n));
+static void MultiplyScanMatrix(void*, scan_matrix* accumulator, const scan_matrix* element) {
+	const scan_matrix product = {
+		accumulator->a * element->a + accumulator->b * element->c,
+		accumulator->a * element->b + accumulator->b * element->d,
+		accumulator->c * element->a + accumulator->d * element->c,
+		accumulator->c * element->b + accumulator->d * element->d,
+	};
+	*accumulator = product;
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolUniformTiling) {
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
-	ASSERT_TRUE(threadpool.get());
-
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		CheckTiling6DTile2D,
-		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
+static std::vector<scan_matrix> ScanMatrices() {
+	std::vector<scan_matrix> matrices(kScanCount);
+	for (size_t i = 0; i < kScanCount; i++) {
+		matrices[i] = scan_matrix { 1, uint32_t(i % 5), uint32_t(i % 3), 1 };
+	}
+	return matrices;
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolUniformTiling) {
+TEST(InclusiveScan, MultiThreadPoolComputesOrderedProducts) {
+	const std::vector<scan_matrix> input = ScanMatrices();
+	std::vector<scan_matrix> output(kScanCount);
+
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
@@ -9627,57 +13392,60 @@ TEST(Parallelize6DTile2D, MultiThreadPoolUniformTiling) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
+	const scan_matrix identity = { 1, 0, 0, 1 };
+	pthreadpool_inclusive_scan(
 		threadpool.get(),
-		CheckTiling6DTile2D,
+		reinterpret_cast<pthreadpool_combine_t>(MultiplyScanMatrix),
 		nullptr,
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		&identity,
+		input.data(),
+		output.data(),
+		sizeof(scan_matrix),
+		kScanCount,
 		0 /* flags */);
-}
 
-static void SetTrue6DTile2D(std::atomic_bool* processed_indicators, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-			processed_indicators[linear_idx].store(true, std::memory_order_relaxed);
-		}
+	scan_matrix product = identity;
+	for (size_t i = 0; i < kScanCount; i++) {
+		MultiplyScanMatrix(nullptr, &product, &input[i]);
+		ASSERT_EQ(output[i].a, product.a) << "at element " << i;
+		ASSERT_EQ(output[i].b, product.b) << "at element " << i;
+		ASSERT_EQ(output[i].c, product.c) << "at element " << i;
+		ASSERT_EQ(output[i].d, product.d) << "at element " << i;
 	}
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(ExclusiveScan, SingleThreadPoolComputesOrderedProducts) {
+	const std::vector<scan_matrix> input = ScanMatrices();
+	std::vector<scan_matrix> output(kScanCount);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
+	const scan_matrix identity = { 1, 0, 0, 1 };
+	pthreadpool_exclusive_scan(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_combine_t>(MultiplyScanMatrix),
+		nullptr,
+		&identity,
+		input.data(),
+		output.data(),
+		sizeof(scan_matrix),
+		kScanCount,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
+	scan_matrix product = identity;
+	for (size_t i = 0; i < kScanCount; i++) {
+		ASSERT_EQ(output[i].a, product.a) << "at element " << i;
+		ASSERT_EQ(output[i].b, product.b) << "at element " << i;
+		ASSERT_EQ(output[i].c, product.c) << "at element " << i;
+		ASSERT_EQ(output[i].d, product.d) << "at element " << i;
+		MultiplyScanMatrix(nullptr, &product, &input[i]);
 	}
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
-	std::vector<std::atomic_bool> indicators(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(ExclusiveScan, MultiThreadPoolComputesOrderedProducts) {
+	const std::vector<scan_matrix> input = ScanMatrices();
+	std::vector<scan_matrix> output(kScanCount);
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9686,74 +13454,52 @@ TEST(Parallelize6DTile2D, MultiThreadPoolAllItemsProcessed) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
+	const scan_matrix identity = { 1, 0, 0, 1 };
+	pthreadpool_exclusive_scan(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(SetTrue6DTile2D),
-		static_cast<void*>(indicators.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_combine_t>(MultiplyScanMatrix),
+		nullptr,
+		&identity,
+		input.data(),
+		output.data(),
+		sizeof(scan_matrix),
+		kScanCount,
 		0 /* flags */);
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_TRUE(indicators[linear_idx].load(std::memory_order_relaxed))
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") not processed";
-						}
-					}
-				}
-			}
-		}
+	scan_matrix product = identity;
+	for (size_t i = 0; i < kScanCount; i++) {
+		ASSERT_EQ(output[i].a, product.a) << "at element " << i;
+		ASSERT_EQ(output[i].b, product.b) << "at element " << i;
+		ASSERT_EQ(output[i].c, product.c) << "at element " << i;
+		ASSERT_EQ(output[i].d, product.d) << "at element " << i;
+		MultiplyScanMatrix(nullptr, &product, &input[i]);
 	}
 }
 
-static void Increment6DTile2D(std::atomic_int* processed_counters, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-			processed_counters[linear_idx].fetch_add(1, std::memory_order_relaxed);
-		}
-	}
+static std::vector<uint32_t> RandomSortKeysU32(uint32_t max_key) {
+	std::mt19937 rng(kSortCount);
+	std::uniform_int_distribution<uint32_t> distribution(0, max_key);
+	std::vector<uint32_t> keys(kSortCount);
+	std::generate(keys.begin(), keys.end(), [&]() { return distribution(rng); });
+	return keys;
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(SortU32, SingleThreadPoolSortsKeys) {
+	std::vector<uint32_t> keys = RandomSortKeysU32(UINT32_MAX);
+	std::vector<uint32_t> expected_keys = keys;
+	std::sort(expected_keys.begin(), expected_keys.end());
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
-	}
+	pthreadpool_sort_u32(threadpool.get(), keys.data(), keys.size(), 0 /* flags */);
+	EXPECT_EQ(keys, expected_keys);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(SortU32, MultiThreadPoolSortsKeys) {
+	std::vector<uint32_t> keys = RandomSortKeysU32(UINT32_MAX);
+	std::vector<uint32_t> expected_keys = keys;
+	std::sort(expected_keys.begin(), expected_keys.end());
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9762,69 +13508,33 @@ TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedOnce) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
-		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-		static_cast<void*>(counters.data()),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-		0 /* flags */);
-
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), 1)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times (expected: 1)";
-						}
-					}
-				}
-			}
-		}
-	}
+	pthreadpool_sort_u32(threadpool.get(), keys.data(), keys.size(), 0 /* flags */);
+	EXPECT_EQ(keys, expected_keys);
 }
 
-TEST(Parallelize6DTile2D, SingleThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(SortU32, MultiThreadPoolSortsNarrowKeys) {
+	/* Keys with an odd number of non-trivial radix passes */
+	std::vector<uint32_t> keys = RandomSortKeysU32(0xFFFFFF);
+	std::vector<uint32_t> expected_keys = keys;
+	std::sort(expected_keys.begin(), expected_keys.end());
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-			0 /* flags */);
+	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
+		GTEST_SKIP();
 	}
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
-	}
+	pthreadpool_sort_u32(threadpool.get(), keys.data(), keys.size(), 0 /* flags */);
+	EXPECT_EQ(keys, expected_keys);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
-	std::vector<std::atomic_int> counters(kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+TEST(SortU64, MultiThreadPoolSortsKeys) {
+	std::mt19937_64 rng(kSortCount);
+	std::vector<uint64_t> keys(kSortCount);
+	std::generate(keys.begin(), keys.end(), std::ref(rng));
+	std::vector<uint64_t> expected_keys = keys;
+	std::sort(expected_keys.begin(), expected_keys.end());
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9833,75 +13543,57 @@ TEST(Parallelize6DTile2D, MultiThreadPoolEachItemProcessedMultipleTimes) {
 		GTEST_SKIP();
 	}
 
-	for (size_t iteration = 0; iteration < kIncrementIterations6D; iteration++) {
-		pthreadpool_parallelize_6d_tile_2d(
-			threadpool.get(),
-			reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(Increment6DTile2D),
-			static_cast<void*>(counters.data()),
-			kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-			kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
-			0 /* flags */);
-	}
+	pthreadpool_sort_u64(threadpool.get(), keys.data(), keys.size(), 0 /* flags */);
+	EXPECT_EQ(keys, expected_keys);
+}
 
-	for (size_t i = 0; i < kParallelize6DTile2DRangeI; i++) {
-		for (size_t j = 0; j < kParallelize6DTile2DRangeJ; j++) {
-			for (size_t k = 0; k < kParallelize6DTile2DRangeK; k++) {
-				for (size_t l = 0; l < kParallelize6DTile2DRangeL; l++) {
-					for (size_t m = 0; m < kParallelize6DTile2DRangeM; m++) {
-						for (size_t n = 0; n < kParallelize6DTile2DRangeN; n++) {
-							const size_t linear_idx = ((((i * kParallelize6DTile2DRangeJ + j) * kParallelize6DTile2DRangeK + k) * kParallelize6DTile2DRangeL + l) * kParallelize6DTile2DRangeM + m) * kParallelize6DTile2DRangeN + n;
-							EXPECT_EQ(counters[linear_idx].load(std::memory_order_relaxed), kIncrementIterations6D)
-								<< "Element (" << i << ", " << j << ", " << k << ", " << l << ", " << m << ", " << n << ") was processed "
-								<< counters[linear_idx].load(std::memory_order_relaxed) << " times "
-								<< "(expected: " << kIncrementIterations6D << ")";
-						}
-					}
-				}
-			}
-		}
+struct sort_record {
+	uint32_t key;
+	uint32_t index;
+};
+
+static int CompareSortRecords(void*, const sort_record* a, const sort_record* b) {
+	return (a->key > b->key) - (a->key < b->key);
+}
+
+static std::vector<sort_record> RandomSortRecords() {
+	/* Few distinct keys, so that stability is observable */
+	const std::vector<uint32_t> keys = RandomSortKeysU32(97);
+	std::vector<sort_record> records(kSortCount);
+	for (size_t i = 0; i < kSortCount; i++) {
+		records[i] = sort_record { keys[i], uint32_t(i) };
 	}
+	return records;
 }
 
-static void IncrementSame6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	for (size_t m = start_m; m < start_m + tile_m; m++) {
-		for (size_t n = start_n; n < start_n + tile_n; n++) {
-			num_processed_items->fetch_add(1, std::memory_order_relaxed);
+static void CheckSortRecordsStablySorted(const std::vector<sort_record>& records) {
+	for (size_t i = 1; i < records.size(); i++) {
+		ASSERT_LE(records[i - 1].key, records[i].key) << "at element " << i;
+		if (records[i - 1].key == records[i].key) {
+			ASSERT_LT(records[i - 1].index, records[i].index) << "at element " << i;
 		}
 	}
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolHighContention) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Sort, SingleThreadPoolSortsStably) {
+	std::vector<sort_record> records = RandomSortRecords();
 
-	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
+	auto_pthreadpool_t threadpool(pthreadpool_create(1), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
 
-	if (pthreadpool_get_threads_count(threadpool.get()) <= 1) {
-		GTEST_SKIP();
-	}
-
-	pthreadpool_parallelize_6d_tile_2d(
+	pthreadpool_sort(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(IncrementSame6DTile2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_compare_t>(CompareSortRecords),
+		nullptr,
+		records.data(),
+		sizeof(sort_record),
+		records.size(),
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
-}
-
-static void WorkImbalance6DTile2D(std::atomic_int* num_processed_items, size_t i, size_t j, size_t k, size_t l, size_t start_m, size_t start_n, size_t tile_m, size_t tile_n) {
-	num_processed_items->fetch_add(tile_m * tile_n, std::memory_order_relaxed);
-	if (i == 0 && j == 0 && k == 0 && l == 0 && start_m == 0 && start_n == 0) {
-		/* Spin-wait until all items are computed */
-		while (num_processed_items->load(std::memory_order_relaxed) != kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN) {
-			std::atomic_thread_fence(std::memory_order_acquire);
-		}
-	}
+	CheckSortRecordsStablySorted(records);
 }
 
-TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
-	std::atomic_int num_processed_items = ATOMIC_VAR_INIT(0);
+TEST(Sort, MultiThreadPoolSortsStably) {
+	std::vector<sort_record> records = RandomSortRecords();
 
 	auto_pthreadpool_t threadpool(pthreadpool_create(0), pthreadpool_destroy);
 	ASSERT_TRUE(threadpool.get());
@@ -9910,12 +13602,13 @@ TEST(Parallelize6DTile2D, MultiThreadPoolWorkStealing) {
 		GTEST_SKIP();
 	}
 
-	pthreadpool_parallelize_6d_tile_2d(
+	pthreadpool_sort(
 		threadpool.get(),
-		reinterpret_cast<pthreadpool_task_6d_tile_2d_t>(WorkImbalance6DTile2D),
-		static_cast<void*>(&num_processed_items),
-		kParallelize6DTile2DRangeI, kParallelize6DTile2DRangeJ, kParallelize6DTile2DRangeK, kParallelize6DTile2DRangeL, kParallelize6DTile2DRangeM, kParallelize6DTile2DRangeN,
-		kParallelize6DTile2DTileM, kParallelize6DTile2DTileN,
+		reinterpret_cast<pthreadpool_compare_t>(CompareSortRecords),
+		nullptr,
+		records.data(),
+		sizeof(sort_record),
+		records.size(),
 		0 /* flags */);
-	EXPECT_EQ(num_processed_items.load(std::memory_order_relaxed), kParallelize6DTile2DRangeI * kParallelize6DTile2DRangeJ * kParallelize6DTile2DRangeK * kParallelize6DTile2DRangeL * kParallelize6DTile2DRangeM * kParallelize6DTile2DRangeN);
+	CheckSortRecordsStablySorted(records);
 }